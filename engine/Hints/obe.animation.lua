@@ -91,7 +91,8 @@ function obe.animation._Animation:reset() end
 
 --- Update the Animation (Updates the current AnimationGroup, executes the AnimationCode)
 ---
-function obe.animation._Animation:update() end
+---@param dt number #Time elapsed since the last update (in seconds)
+function obe.animation._Animation:update(dt) end
 
 --- Enables or disables anti-aliasing for textures of this animation.
 ---
@@ -247,7 +248,8 @@ function obe.animation._AnimationState:reset() end
 
 --- Update the Animation (Updates the current AnimationGroup, executes the AnimationCode)
 ---
-function obe.animation._AnimationState:update() end
+---@param dt number #Time elapsed since the last update (in seconds)
+function obe.animation._AnimationState:update(dt) end
 
 ---@return obe.animation.Animation
 function obe.animation._AnimationState:get_animation() end
@@ -311,7 +313,8 @@ function obe.animation._Animator:set_paused(pause) end
 
 --- Update the Animator and the currently played Animation.
 ---
-function obe.animation._Animator:update() end
+---@param dt number #Time elapsed since the last update (in seconds)
+function obe.animation._Animator:update(dt) end
 
 ---@param sprite obe.graphics.Sprite #
 ---@param target_scale_mode? obe.animation.AnimatorTargetScaleMode #
@@ -320,6 +323,14 @@ function obe.animation._Animator:set_target(sprite, target_scale_mode) end
 ---@return obe.system.Path
 function obe.animation._Animator:get_filesystem_path() end
 
+--- Enables or disables anti-aliasing for the textures of the Animations loaded afterwards, the anti-aliasing of the target is used instead if the Animator has one
+---
+---@param anti_aliasing boolean #should be true to enable anti-aliasing, false otherwise
+function obe.animation._Animator:set_anti_aliasing(anti_aliasing) end
+
+---@return boolean
+function obe.animation._Animator:is_anti_aliased() end
+
 ---@return obe.animation.AnimatorState
 function obe.animation._Animator:make_state() end
 
@@ -327,6 +338,11 @@ function obe.animation._Animator:make_state() end
 ---@class obe.animation.AnimatorState
 obe.animation._AnimatorState = {};
 
+--- Creates an AnimatorState without Animator, it has no Animation until an Animator is loaded.
+---
+---@return obe.animation.AnimatorState
+function obe.animation.AnimatorState() end
+
 --- obe.animation.AnimatorState constructor
 ---
 ---@param parent obe.animation.Animator #
@@ -334,10 +350,16 @@ obe.animation._AnimatorState = {};
 function obe.animation.AnimatorState(parent) end
 
 
---- Get the name of the currently played Animation.
+--- Creates the states of the Animations of the played Animator.
 ---
 function obe.animation._AnimatorState:load() end
 
+--- Plays another Animator, loaded from the given path, with the AnimatorState.
+---
+---@param path obe.system.Path #Path to the Animator directory
+---@param resources? obe.engine.ResourceManager #ResourceManager used to share the Animator with the other AnimatorStates playing it (optional)
+function obe.animation._AnimatorState:load(path, resources) end
+
 ---@return string
 function obe.animation._AnimatorState:get_current_animation_name() end
 
@@ -353,7 +375,8 @@ function obe.animation._AnimatorState:set_paused(pause) end
 
 --- Update the Animator and the currently played Animation.
 ---
-function obe.animation._AnimatorState:update() end
+---@param dt number #Time elapsed since the last update (in seconds)
+function obe.animation._AnimatorState:update(dt) end
 
 ---@param sprite obe.graphics.Sprite #
 ---@param target_scale_mode? obe.animation.AnimatorTargetScaleMode #
@@ -370,8 +393,15 @@ function obe.animation._AnimatorState:get_current_animation() end
 ---@return obe.graphics.Texture
 function obe.animation._AnimatorState:get_current_texture() end
 
----@return obe.animation.Animator
-function obe.animation._AnimatorState:get_animator() end
+--- Get the name of all the Animations of the played Animator.
+---
+---@return string[]
+function obe.animation._AnimatorState:get_all_animations_names() end
+
+--- Get the path of the played Animator.
+---
+---@return obe.system.Path
+function obe.animation._AnimatorState:get_filesystem_path() end
 
 
 ---@class obe.animation.ValueTweening
@@ -38,4 +38,22 @@ function obe.config.Version(str) end
 function obe.config._Version:string() end
 
 
+--- Get the path of the compiled version of a vili file ("scene.vili" is compiled to "scene.vilic")
+---
+---@param path string #Path of the vili file
+---@return string
+function obe.config.get_compiled_vili_path(path) end
+
+--- Loads a vili file from its compiled version when it was compiled from the current content of the file, parses the file otherwise
+---
+---@param path string #Path of the vili file
+---@return vili.node
+function obe.config.load_vili_file(path) end
+
+--- Parses a vili file and writes its compiled version next to it
+---
+---@param path string #Path of the vili file
+---@return boolean
+function obe.config.compile_vili_file(path) end
+
 return obe.config;
\ No newline at end of file
@@ -1,15 +1,95 @@
 ---@meta
 
 obe.debug = {};
+---@class obe.debug.Profiler
+obe.debug._Profiler = {};
+
+
+--- Enables or disables the recording of scopes.
+---
+---@param enabled boolean #
+function obe.debug._Profiler:set_enabled(enabled) end
+
+---@return boolean
+function obe.debug._Profiler:is_enabled() end
+
+--- Ends the current frame and starts a new one, called once per frame by the Engine.
+---
+function obe.debug._Profiler:next_frame() end
+
+--- Opens a new scope, it ends at the next call to end_scope.
+---
+---@param name string #Name of the scope, samples with the same name are summed in get_last_frame_timings
+---@param detail? string #Additional information about the scope
+function obe.debug._Profiler:begin_scope(name, detail) end
+
+--- Closes the innermost scope opened with begin_scope.
+---
+function obe.debug._Profiler:end_scope() end
+
+--- Get the scopes recorded during the last complete frame.
+---
+---@return obe.debug.ProfilerSample[]
+function obe.debug._Profiler:get_last_frame_samples() end
+
+---@return obe.time.TimeUnit
+function obe.debug._Profiler:get_last_frame_duration() end
+
+--- Get the total time spent in each scope name during the last complete frame.
+---
+---@return table<string, obe.time.TimeUnit>
+function obe.debug._Profiler:get_last_frame_timings() end
+
+--- Starts keeping every recorded scope for save_chrome_trace.
+---
+---@param max_samples? number #Amount of samples after which the capture stops
+function obe.debug._Profiler:start_capture(max_samples) end
+
+function obe.debug._Profiler:stop_capture() end
+
+---@return boolean
+function obe.debug._Profiler:is_capturing() end
+
+--- Writes the captured samples in the Chrome trace event format.
+---
+---@param path string #Path of the JSON file to write
+---@return boolean
+function obe.debug._Profiler:save_chrome_trace(path) end
+
+
+---@class obe.debug.ProfilerSample
+---@field name string #
+---@field detail string #Additional information about the scope (id of a GameObject, of a listener, ...)
+---@field start obe.time.TimeUnit #Time elapsed between the start of the frame and the start of the scope
+---@field duration obe.time.TimeUnit #
+---@field depth number #Amount of scopes enclosing this one
+obe.debug._ProfilerSample = {};
+
 
 ---@alias obe.debug.Logger spdlog.logger
 
 ---@alias obe.debug.LogLevelMeta obe.types.SmartEnum[obe.debug.LogLevel]
+
+---@alias obe.debug.LogOverflowPolicyMeta obe.types.SmartEnum[obe.debug.LogOverflowPolicy]
 --- Initialize the Logger.
 ---
 ---@param dump_log_to_file boolean #
 function obe.debug.init_logger(dump_log_to_file) end
 
+--- Moves the formatting and writing of the log messages to a background thread, the calling thread only pushes the messages in a bounded queue.
+---
+---@param queue_size number #Maximum amount of messages waiting to be written
+---@param overflow_policy? obe.debug.LogOverflowPolicy #What to do when a message is logged while the queue is full
+function obe.debug.enable_async_logging(queue_size, overflow_policy) end
+
+--- Writes every queued message, stops the background thread and goes back to synchronous logging, call it before exiting or after a crash.
+---
+function obe.debug.disable_async_logging() end
+
+--- Writes every pending message to the sinks.
+---
+function obe.debug.flush_logger() end
+
 ---@param content string #
 function obe.debug.trace(content) end
 
@@ -32,6 +112,9 @@ function obe.debug.critical(content) end
 ---@type obe.debug.Logger
 obe.debug.Log = {};
 
+---@type obe.debug.Profiler
+obe.debug.Profile = {};
+
 --- 
 ---
 ---@class obe.debug.LogLevel
@@ -51,4 +134,14 @@ obe.debug.LogLevel = {
     ---@type obe.debug.LogLevel
     Off = 6,
 };
+
+--- Behaviour of the asynchronous Logger when its queue is full
+---
+---@class obe.debug.LogOverflowPolicy
+obe.debug.LogOverflowPolicy = {
+    ---@type obe.debug.LogOverflowPolicy
+    Block = 0,
+    ---@type obe.debug.LogOverflowPolicy
+    Drop = 1,
+};
 return obe.debug;
\ No newline at end of file
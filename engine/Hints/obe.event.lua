@@ -61,6 +61,7 @@ function obe.event._EventBase:get_identifier() end
 ---
 ---@param id string #of the listener being added
 ---@param listener obe.event.ExternalEventListener #Listener to register
+---@return number
 function obe.event._EventBase:add_external_listener(id, listener) end
 
 --- Removes a Listener from the Event.
@@ -229,7 +230,8 @@ function obe.event.EventManager() end
 
 --- Updates the EventManager.
 ---
-function obe.event._EventManager:update() end
+---@param dt number #Time elapsed since the last update (in seconds)
+function obe.event._EventManager:update(dt) end
 
 --- Clears the EventManager.
 ---
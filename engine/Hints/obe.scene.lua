@@ -80,7 +80,8 @@ function obe.scene._Scene:set_future_load(data) end
 
 --- Updates all elements in the Scene.
 ---
-function obe.scene._Scene:update() end
+---@param dt number #Time elapsed since the last update (in seconds)
+function obe.scene._Scene:update(dt) end
 
 --- Draws all elements of the Scene on the screen.
 ---
@@ -1,6 +1,35 @@
 ---@meta
 
 obe.script = {};
+---@class obe.script.BytecodeCache
+obe.script._BytecodeCache = {};
+
+
+--- Sets the directory where the bytecode is stored, an empty path only keeps the bytecode in memory.
+---
+---@param directory string #
+function obe.script._BytecodeCache:set_directory(directory) end
+
+---@return string
+function obe.script._BytecodeCache:get_directory() end
+
+--- Loads a script file as a function without running it, the bytecode is reused when the script did not change.
+---
+---@param path string #Path of the script file
+---@return function?, string?
+function obe.script._BytecodeCache:load_file(path) end
+
+--- Compiles a script file and writes its bytecode in the cache directory.
+---
+---@param path string #
+---@return boolean
+function obe.script._BytecodeCache:precompile(path) end
+
+--- Forgets the bytecode kept in memory, files on disk are kept.
+---
+function obe.script._BytecodeCache:clear() end
+
+
 ---@class obe.script.DummyCast
 obe.script._DummyCast = {};
 
@@ -8,7 +37,7 @@ obe.script._DummyCast = {};
 
 ---@class obe.script.GameObject : obe.types.Identifiable, obe.types.Serializable
 ---@field deletable boolean #Delete State of the GameObject (false = not deleted)
----@field Animator obe.animation.Animator #Gets the Animator Component of the GameObject (Raises ObEngine.Script.GameObject.NoAnimator if no Animator Component)
+---@field Animator obe.animation.AnimatorState #Gets the Animator Component of the GameObject (Raises ObEngine.Script.GameObject.NoAnimator if no Animator Component)
 ---@field Collider obe.collision.ColliderComponent #Gets the Collider Component of the GameObject (Raises ObEngine.Script.GameObject.NoCollider if no Collider Component)
 ---@field Sprite obe.graphics.Sprite #Gets the Sprite Component of the GameObject (Raises ObEngine.Script.GameObject.NoSprite if no Sprite Component)
 ---@field SceneNode obe.scene.SceneNode #Gets the Scene Node of the GameObject (SceneNode that can manipulate the position of all Scene Components)
@@ -75,7 +104,8 @@ function obe.script._GameObject:load_game_object(scene, obj, resources) end
 
 --- Updates the GameObject.
 ---
-function obe.script._GameObject:update() end
+---@param dt number #Time elapsed since the last update (in seconds)
+function obe.script._GameObject:update(dt) end
 
 --- Deletes the GameObject.
 ---
@@ -135,6 +165,85 @@ function obe.script._GameObject:load_source(path, env) end
 function obe.script._GameObject:is_parent_of_component(component_id) end
 
 
+---@class obe.script.GarbageCollector
+obe.script._GarbageCollector = {};
+
+--- Configures the GarbageCollector from a vili node (enabled, budget in milliseconds, stepSize in KB, pause and limit in percents of the heap size after the last cycle).
+---
+---@param config vili.node #
+function obe.script._GarbageCollector:configure(config) end
+
+--- Stops the automatic collections of Lua and switches it to incremental mode when enabled, restarts them in their previous mode otherwise.
+---
+---@param enabled boolean #
+function obe.script._GarbageCollector:set_enabled(enabled) end
+
+---@return boolean
+function obe.script._GarbageCollector:is_enabled() end
+
+--- Sets the maximum time spent collecting in a frame.
+---
+---@param budget obe.time.TimeUnit #
+function obe.script._GarbageCollector:set_budget(budget) end
+
+---@return obe.time.TimeUnit
+function obe.script._GarbageCollector:get_budget() end
+
+--- Sets the amount of work done by each step, in KB.
+---
+---@param step_size number #
+function obe.script._GarbageCollector:set_step_size(step_size) end
+
+---@return number
+function obe.script._GarbageCollector:get_step_size() end
+
+--- Sets the heap growth, in percents of the heap size after the last cycle, from which the collector runs even without slack.
+---
+---@param pause number #
+function obe.script._GarbageCollector:set_pause(pause) end
+
+---@return number
+function obe.script._GarbageCollector:get_pause() end
+
+--- Sets the heap growth, in percents of the heap size after the last cycle, from which a full collection is done regardless of the budget, never lower than the pause.
+---
+---@param limit number #
+function obe.script._GarbageCollector:set_limit(limit) end
+
+---@return number
+function obe.script._GarbageCollector:get_limit() end
+
+--- Runs collection steps while the frame budget and the time left before the next frame allow it, can be called several times per frame.
+---
+---@param time_left obe.time.TimeUnit #Time left before the next frame
+function obe.script._GarbageCollector:collect_in_slack(time_left) end
+
+--- Ends the frame, runs collection steps within the remaining budget if the heap grew past the pause threshold, or a full collection if it grew past the limit.
+---
+function obe.script._GarbageCollector:end_frame() end
+
+--- Get the size of the Lua heap in KB.
+---
+---@return number
+function obe.script._GarbageCollector:get_heap_size() end
+
+---@return obe.script.GarbageCollectorStatistics
+function obe.script._GarbageCollector:get_statistics() end
+
+function obe.script._GarbageCollector:reset_statistics() end
+
+
+---@class obe.script.GarbageCollectorStatistics
+---@field steps number #Amount of incremental steps done
+---@field cycles number #Amount of collection cycles completed
+---@field forced_frames number #Amount of frames in which the collector ran without slack because the heap grew past the pause threshold
+---@field full_collections number #Amount of full collections done because the heap grew past the limit
+---@field last_frame_pause obe.time.TimeUnit #Time spent collecting during the last frame
+---@field max_frame_pause obe.time.TimeUnit #Longest time spent collecting in a single frame
+---@field total_pause obe.time.TimeUnit #Total time spent collecting
+obe.script._GarbageCollectorStatistics = {};
+
+
 ---@class obe.script.GameObjectDatabase
 obe.script._GameObjectDatabase = {};
 
@@ -174,6 +283,9 @@ function obe.script.sol_call_status_to_string(status) end
 function obe.script.safe_lua_call(callback, args) end
 
 
+---@type obe.script.BytecodeCache
+obe.script.ScriptCache = {};
+
 --- 
 ---
 ---@class obe.script.EnvironmentTarget
@@ -13,13 +13,6 @@ obe.tiles._AnimatedTile = {};
 function obe.tiles.AnimatedTile(tileset, tile_ids, sleeps) end
 
 
----@param quad sf.Vertex #
----@param tile_info? obe.tiles.TileInfo #
-function obe.tiles._AnimatedTile:attach_quad(quad, tile_info) end
-
----@param quad sf.Vertex #
-function obe.tiles._AnimatedTile:detach_quad(quad) end
-
 function obe.tiles._AnimatedTile:start() end
 
 function obe.tiles._AnimatedTile:stop() end
@@ -27,7 +20,20 @@ function obe.tiles._AnimatedTile:stop() end
 ---@return number
 function obe.tiles._AnimatedTile:get_id() end
 
-function obe.tiles._AnimatedTile:update() end
+--- Gets the index of the current frame of the animation.
+---
+---@return number
+function obe.tiles._AnimatedTile:get_frame_index() end
+
+--- Gets the id of the tile displayed by the current frame.
+---
+---@return number
+function obe.tiles._AnimatedTile:get_current_tile_id() end
+
+--- Advances the animation, a large delta time skips as many frames as it covers.
+---
+---@param dt number #Time elapsed since the last update (in seconds)
+function obe.tiles._AnimatedTile:update(dt) end
 
 
 ---@class obe.tiles.TileLayer : obe.graphics.Renderable
@@ -52,14 +58,21 @@ function obe.tiles.TileLayer(scene, id, layer, sublayer, x, y, width, height, da
 ---@return string
 function obe.tiles._TileLayer:get_id() end
 
+--- Creates the colliders and GameObjects of the tiles and splits the TileLayer in chunks, the chunks are built right away unless the TileScene streams them. Adjacent solid tiles share a collider when the TileScene merges colliders.
+---
 function obe.tiles._TileLayer:build() end
 
---- Draws all elements of the TileLayer on the screen.
+--- Draws the chunks of the TileLayer that are visible on the screen.
 ---
 ---@param surface obe.graphics.RenderTarget #
 ---@param camera obe.scene.Camera #
 function obe.tiles._TileLayer:draw(surface, camera) end
 
+--- Loads the chunks close to the Camera view and unloads the ones far from it when the TileScene streams chunks, then updates the animated tiles of the chunks that are drawn, drawing the TileLayer does it too.
+---
+---@param camera obe.scene.Camera #Camera the TileLayer is going to be drawn with
+function obe.tiles._TileLayer:update_chunks(camera) end
+
 ---@param x number #
 ---@param y number #
 ---@param tile_id number #
@@ -70,6 +83,16 @@ function obe.tiles._TileLayer:set_tile(x, y, tile_id) end
 ---@return number
 function obe.tiles._TileLayer:get_tile(x, y) end
 
+--- Gets the amount of chunks of the TileLayer.
+---
+---@return number
+function obe.tiles._TileLayer:get_chunks_amount() end
+
+--- Gets the amount of chunks which vertices are currently built.
+---
+---@return number
+function obe.tiles._TileLayer:get_loaded_chunks_amount() end
+
 
 ---@class obe.tiles.TileScene : obe.types.Serializable
 obe.tiles._TileScene = {};
@@ -102,7 +125,8 @@ function obe.tiles._TileScene:dump() end
 ---@param data vili.node #vili node containing the data of the object
 function obe.tiles._TileScene:load(data) end
 
-function obe.tiles._TileScene:update() end
+---@param dt number #Time elapsed since the last update (in seconds)
+function obe.tiles._TileScene:update(dt) end
 
 function obe.tiles._TileScene:clear() end
 
@@ -131,6 +155,24 @@ function obe.tiles._TileScene:get_collider_models() end
 ---@return vili.node[]
 function obe.tiles._TileScene:get_game_objects_models() end
 
+--- Gets the AnimatedTile starting with a given tile.
+---
+---@param tile_id number #Id of the tile (without the flip flags)
+---@return obe.tiles.AnimatedTile
+function obe.tiles._TileScene:get_tile_animation(tile_id) end
+
+--- Gets the collider models of a given tile.
+---
+---@param tile_id number #Id of the tile (without the flip flags)
+---@return obe.collision.ColliderComponent[]
+function obe.tiles._TileScene:get_tile_collider_models(tile_id) end
+
+--- Gets the models of the GameObjects created with a given tile.
+---
+---@param tile_id number #Id of the tile (without the flip flags)
+---@return vili.node[]
+function obe.tiles._TileScene:get_tile_game_objects_models(tile_id) end
+
 ---@return number
 function obe.tiles._TileScene:get_width() end
 
@@ -146,6 +188,26 @@ function obe.tiles._TileScene:get_tile_height() end
 ---@return boolean
 function obe.tiles._TileScene:is_anti_aliased() end
 
+--- Gets the size (in tiles) of the square chunks the layers are split in.
+---
+---@return number
+function obe.tiles._TileScene:get_chunk_size() end
+
+--- Whether the chunks of the layers are only built around the camera.
+---
+---@return boolean
+function obe.tiles._TileScene:is_streaming() end
+
+--- Gets the amount of chunks built around the visible ones when the chunks are streamed.
+---
+---@return number
+function obe.tiles._TileScene:get_streaming_margin() end
+
+--- Whether the adjacent solid tiles of the layers share their colliders.
+---
+---@return boolean
+function obe.tiles._TileScene:is_merging_colliders() end
+
 ---@return obe.scene.Scene
 function obe.tiles._TileScene:get_scene() end
 
@@ -99,6 +99,11 @@ function obe.time._FramerateManager:get_raw_delta_time() end
 ---@return number
 function obe.time._FramerateManager:get_delta_time() end
 
+--- Get the time elapsed between the last two updates multiplied by the SpeedCoefficient, updates can happen several times per rendered frame when they are not synchronized with rendering.
+---
+---@return number
+function obe.time._FramerateManager:get_update_delta_time() end
+
 --- Get the SpeedCoefficient.
 ---
 ---@return number
@@ -114,6 +119,11 @@ function obe.time._FramerateManager:is_framerate_limited() end
 ---@return number
 function obe.time._FramerateManager:get_framerate_target() end
 
+--- Get the time left before the next frame.
+---
+---@return obe.time.TimeUnit
+function obe.time._FramerateManager:get_time_before_next_frame() end
+
 --- Check if vsync is enabled or not.
 ---
 ---@return boolean
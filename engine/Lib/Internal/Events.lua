@@ -1,3 +1,28 @@
+local UpdateDispatcher = require("obe://Lib/Internal/UpdateDispatcher");
+
+local function add_listener(listener_id, namespace, group, event, callback)
+    if UpdateDispatcher.handles(namespace, group, event) then
+        UpdateDispatcher.add(listener_id, callback);
+        return;
+    end
+    local lua_listener = obe.event.LuaEventListener(callback);
+    Engine.Events:get_namespace(namespace)
+        :get_group(group)
+        :get(event)
+        :add_external_listener(listener_id, lua_listener);
+end
+
+local function remove_listener(listener_id, namespace, group, event)
+    if UpdateDispatcher.handles(namespace, group, event) then
+        UpdateDispatcher.remove(listener_id);
+        return;
+    end
+    Engine.Events:get_namespace(namespace)
+        :get_group(group)
+        :get(event)
+        :remove_external_listener(listener_id);
+end
+
 local function merge_tables(t1, t2)
     local t3 = {};
     for k, v in pairs(t1) do t3[k] = v end
@@ -21,10 +46,7 @@ local function EventHook(listener_id, namespace, group, event, callback)
             end
         end,
         clean = function(self)
-            Engine.Events:get_namespace(namespace)
-                         :get_group(group)
-                         :get(event)
-                         :remove_external_listener(self.listener_id);
+            remove_listener(self.listener_id, namespace, group, event);
         end,
         configure = function(self, config)
             self.event_emit_wrapper = config.event_emit_wrapper;
@@ -45,11 +67,7 @@ local function EventHook(listener_id, namespace, group, event, callback)
         end
         return callback(...);
     end
-    local lua_listener = obe.event.LuaEventListener(receive_wrapper_caller);
-    Engine.Events:get_namespace(namespace)
-        :get_group(group)
-        :get(event)
-        :add_external_listener(listener_id, lua_listener);
+    add_listener(listener_id, namespace, group, event, receive_wrapper_caller);
     return event_hook;
 end
 
@@ -64,10 +82,7 @@ local function EventGroupHook(listener_id, namespace, group)
             elseif type(callback) == "nil" then
                 local mt = getmetatable(object);
                 mt.__storage[event] = nil;
-                Engine.Events:get_namespace(namespace):get_group(group):get(event)
-                    :remove_external_listener(
-                        listener_id
-                    );
+                remove_listener(listener_id, namespace, group, event);
             else
                 error(
                     ("unsupported callback for event %s.%s.%s (expects <function> or <nil>)"):format(
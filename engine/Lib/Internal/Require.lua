@@ -38,7 +38,16 @@ local function make_prefix_searcher(prefix)
             local loadfile_env = setmetatable(
                 {require = make_base_require(module_prefix or prefix)}, {__index = _G}
             );
-            local func, err = loadfile(find_result:path(), "bt", loadfile_env);
+            local func, err;
+            if obe.script and obe.script.ScriptCache then
+                -- Reuses the compiled bytecode of the module when it did not change
+                func, err = obe.script.ScriptCache:load_file(find_result:path());
+                if func then
+                    debug.setupvalue(func, 1, loadfile_env);
+                end
+            else
+                func, err = loadfile(find_result:path(), "bt", loadfile_env);
+            end
             if err then
                 error(err);
             end
@@ -0,0 +1,93 @@
+-- Calls every Event.Game.Update callback from a single event listener so the
+-- engine only enters Lua once per frame instead of once per GameObject
+local UpdateDispatcher = {
+    enabled = false,
+    event_id = "Event.Game.Update",
+    _callbacks = {},
+    _listener_ids = {},
+    _indexes = {},
+    _dirty = false,
+};
+
+---@param namespace string
+---@param group string
+---@param event string
+---@return boolean
+function UpdateDispatcher.handles(namespace, group, event)
+    return UpdateDispatcher.enabled
+        and ("%s.%s.%s"):format(namespace, group, event) == UpdateDispatcher.event_id;
+end
+
+---@param listener_id string
+---@param callback function
+function UpdateDispatcher.add(listener_id, callback)
+    local index = UpdateDispatcher._indexes[listener_id];
+    if index then
+        UpdateDispatcher._callbacks[index] = callback;
+        return;
+    end
+    local callbacks = UpdateDispatcher._callbacks;
+    index = #UpdateDispatcher._listener_ids + 1;
+    callbacks[index] = callback;
+    UpdateDispatcher._listener_ids[index] = listener_id;
+    UpdateDispatcher._indexes[listener_id] = index;
+end
+
+---@param listener_id string
+function UpdateDispatcher.remove(listener_id)
+    local index = UpdateDispatcher._indexes[listener_id];
+    if index then
+        -- Slots are compacted before the next dispatch so removing a callback
+        -- while dispatching does not skip another one
+        UpdateDispatcher._callbacks[index] = false;
+        UpdateDispatcher._indexes[listener_id] = nil;
+        UpdateDispatcher._dirty = true;
+    end
+end
+
+---@return integer
+function UpdateDispatcher.count()
+    local amount = 0;
+    for _ in pairs(UpdateDispatcher._indexes) do
+        amount = amount + 1;
+    end
+    return amount;
+end
+
+local function compact()
+    local callbacks, listener_ids, indexes = {}, {}, {};
+    for index, listener_id in ipairs(UpdateDispatcher._listener_ids) do
+        local callback = UpdateDispatcher._callbacks[index];
+        if callback then
+            callbacks[#callbacks + 1] = callback;
+            listener_ids[#listener_ids + 1] = listener_id;
+            indexes[listener_id] = #listener_ids;
+        end
+    end
+    UpdateDispatcher._callbacks = callbacks;
+    UpdateDispatcher._listener_ids = listener_ids;
+    UpdateDispatcher._indexes = indexes;
+    UpdateDispatcher._dirty = false;
+end
+
+---@param event obe.events.Game.Update
+function UpdateDispatcher.dispatch(event)
+    if UpdateDispatcher._dirty then
+        compact();
+    end
+    local callbacks = UpdateDispatcher._callbacks;
+    local listener_ids = UpdateDispatcher._listener_ids;
+    -- Callbacks added while dispatching are called from the next frame
+    for index = 1, #listener_ids do
+        local callback = callbacks[index];
+        if callback then
+            local success, err = pcall(callback, event);
+            if not success then
+                error(("error in update listener '%s' : %s"):format(
+                    listener_ids[index], tostring(err)), 0);
+            end
+        end
+    end
+end
+
+return UpdateDispatcher;
@@ -0,0 +1,75 @@
+local Color = require("Lib/StdLib/ConsoleColor");
+local Commands = require("Lib/Toolkit/Commands");
+local Style = require("Lib/Toolkit/Stylesheet");
+
+local fs = obe.utils.file;
+
+local DEFAULT_CACHE_DIRECTORY = "mount://cache/bytecode";
+
+local function precompile_directory(directory, results)
+    for _, filename in pairs(fs.get_file_list(directory)) do
+        if filename:sub(-4) == ".lua" then
+            local script_path = fs.join({directory, filename});
+            if obe.script.ScriptCache:precompile(script_path) then
+                results.compiled = results.compiled + 1;
+            else
+                table.insert(results.failed, script_path);
+            end
+        end
+    end
+    for _, subdirectory in pairs(fs.get_directory_list(directory)) do
+        precompile_directory(fs.join({directory, subdirectory}), results);
+    end
+end
+
+local function _build_(path, cache_directory)
+    local directory = obe.system.Path(path):find(obe.system.PathType.Directory);
+    if not directory:success() then
+        Color.print({
+            { text = "Invalid scripts directory '", color = Style.Error},
+            { text = path, color = Style.Argument},
+            { text = "'", color = Style.Error},
+        });
+        return;
+    end
+    cache_directory = cache_directory or DEFAULT_CACHE_DIRECTORY;
+    -- The cache directory is created with the first compiled script
+    local cache_lookup = obe.system.Path(cache_directory):find(obe.system.PathType.Directory);
+    cache_directory = cache_lookup:hypothetical_path();
+    local previous_cache_directory = obe.script.ScriptCache:get_directory();
+    obe.script.ScriptCache:set_directory(cache_directory);
+    local results = { compiled = 0, failed = {} };
+    -- Cached bytecode is keyed by script path, the scripts are compiled with the
+    -- non-canonical path the Engine uses to load them
+    precompile_directory(directory:hypothetical_path(), results);
+    obe.script.ScriptCache:set_directory(previous_cache_directory);
+
+    Color.print({
+        { text = "Compiled ", color = Style.Default},
+        { text = tostring(results.compiled), color = Style.Argument},
+        { text = " scripts to '", color = Style.Default},
+        { text = cache_directory, color = Style.Argument},
+        { text = "'", color = Style.Default},
+    }, 1);
+    for _, script_path in ipairs(results.failed) do
+        Color.print({
+            { text = "Could not compile script '", color = Style.Error},
+            { text = script_path, color = Style.Argument},
+            { text = "'", color = Style.Error},
+        }, 2);
+    end
+end
+
+return {
+    build = Commands.command {
+        Commands.help "Precompiles the Lua scripts of a directory to ship their bytecode",
+        path = Commands.arg {
+            Commands.help "Directory containing the scripts to compile (subdirectories included)",
+            Commands.call(_build_),
+            cache = Commands.arg {
+                Commands.help "Directory where the bytecode is written (default: mount://cache/bytecode)",
+                Commands.call(_build_)
+            }
+        }
+    }
+};
@@ -1,6 +1,10 @@
+local Color = require("obe://Lib/StdLib/ConsoleColor");
 local Commands = require("obe://Lib/Toolkit/Commands");
+local Style = require("obe://Lib/Toolkit/Stylesheet");
 local dot_access = require("obe://Lib/StdLib/DotAccess").dot_access;
 
+local fs = obe.utils.file;
+
 local function _parse_(filename)
     print(vili.dump(vili.from_file(filename)));
 end
@@ -26,6 +30,56 @@ local function _edit_(filename, getter, newvalue)
     vili.to_file(filename, data);
 end
 
+local function compile_file(filename, results)
+    if obe.config.compile_vili_file(filename) then
+        results.compiled = results.compiled + 1;
+    else
+        table.insert(results.failed, filename);
+    end
+end
+
+local function compile_directory(directory, results)
+    for _, filename in pairs(fs.get_file_list(directory)) do
+        if filename:sub(-5) == ".vili" then
+            compile_file(fs.join({directory, filename}), results);
+        end
+    end
+    for _, subdirectory in pairs(fs.get_directory_list(directory)) do
+        compile_directory(fs.join({directory, subdirectory}), results);
+    end
+end
+
+local function _compile_(path)
+    local results = { compiled = 0, failed = {} };
+    local file = obe.system.Path(path):find(obe.system.PathType.File);
+    local directory = obe.system.Path(path):find(obe.system.PathType.Directory);
+    if file:success() then
+        compile_file(file:path(), results);
+    elseif directory:success() then
+        compile_directory(directory:path(), results);
+    else
+        Color.print({
+            { text = "Invalid vili file or directory '", color = Style.Error},
+            { text = path, color = Style.Argument},
+            { text = "'", color = Style.Error},
+        });
+        return;
+    end
+
+    Color.print({
+        { text = "Compiled ", color = Style.Default},
+        { text = tostring(results.compiled), color = Style.Argument},
+        { text = " vili documents", color = Style.Default},
+    }, 1);
+    for _, filename in ipairs(results.failed) do
+        Color.print({
+            { text = "Could not compile vili document '", color = Style.Error},
+            { text = filename, color = Style.Argument},
+            { text = "'", color = Style.Error},
+        }, 2);
+    end
+end
+
 return {
     parse = Commands.command {
         Commands.help "Parses a vili document",
@@ -50,5 +104,12 @@ return {
                 }
             }
         }
+    },
+    compile = Commands.command {
+        Commands.help "Compiles vili documents to a binary version loaded faster by the engine",
+        path = Commands.arg {
+            Commands.help "Vili document or directory of vili documents to compile (subdirectories included)",
+            Commands.call(_compile_)
+        }
     }
 };
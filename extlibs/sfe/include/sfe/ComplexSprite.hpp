@@ -1,5 +1,7 @@
 #pragma once
 
+#include <array>
+
 #include <SFML/Graphics/Export.hpp>
 #include <SFML/Graphics/Drawable.hpp>
 #include <SFML/Graphics/Vertex.hpp>
@@ -28,6 +30,7 @@ namespace sfe
         sf::FloatRect getLocalBounds() const;
         sf::FloatRect getGlobalBounds() const;
         void setVertices(std::array<sf::Vertex, 4>& vertices);
+        std::array<sf::Vertex, 4> getTransformedVertices() const;
 
     private:
         void draw(sf::RenderTarget& target, sf::RenderStates states) const override;
@@ -108,6 +108,18 @@ namespace sfe
         m_vertices[3].position = vertices[3].position;
     }
 
+    std::array<sf::Vertex, 4> ComplexSprite::getTransformedVertices() const
+    {
+        const sf::Transform& transform = getTransform();
+        std::array<sf::Vertex, 4> vertices;
+        for (std::size_t i = 0; i < 4; ++i)
+        {
+            vertices[i] = m_vertices[i];
+            vertices[i].position = transform.transformPoint(m_vertices[i].position);
+        }
+        return vertices;
+    }
+
     void ComplexSprite::draw(sf::RenderTarget& target, sf::RenderStates states) const
     {
         if (m_texture)
@@ -1,13 +1,15 @@
 #include <algorithm>
 #include <array>
 #include <bit>
+#include <cmath>
 #include <concepts>
 #include <cstdint>
+#include <cstdlib>
 #include <limits>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
-#include <vili/parser/parser_state.hpp>
-
 #include <vili-msgpack/msgpack.hpp>
 
 namespace vili::msgpack
@@ -68,9 +70,8 @@ namespace vili::msgpack
     template <std::signed_integral T>
     constexpr std::make_unsigned_t<T> complement_to_big_endian(T input)
     {
-        auto complement = static_cast<std::make_unsigned_t<T>>(std::abs(input));
-        complement = ~complement + 1;
-        return to_big_endian(complement);
+        // Conversion to unsigned gives the two's complement, even for the minimum value
+        return to_big_endian(static_cast<std::make_unsigned_t<T>>(input));
     }
 
     template <std::unsigned_integral T>
@@ -185,9 +186,7 @@ namespace vili::msgpack
             // negative fixint stores 5-bit negative integer
             if (integer >= -32)
             {
-                uint8_t complement = static_cast<uint8_t>(abs(integer));
-                complement = ~complement + 1;
-                buffer.push_back(complement);
+                buffer.push_back(static_cast<uint8_t>(integer));
                 return;
             }
             // int 8 stores a 8-bit signed integer
@@ -275,7 +274,9 @@ namespace vili::msgpack
      */
     void dump_number(MsgPackBuffer& buffer, const double number)
     {
-        if (number >= std::numeric_limits<float>::min()  && number <= std::numeric_limits<float>::max())
+        // single precision is only used when the number can be stored without loss
+        if (std::abs(number) <= std::numeric_limits<float>::max()
+            && static_cast<double>(static_cast<float>(number)) == number)
         {
             buffer.push_back(0xca);
             const uint32_t integer_repr = to_ieee754(static_cast<float>(number));
@@ -556,230 +557,151 @@ namespace vili::msgpack
         throw std::runtime_error("invalid floating point number size");
     }
 
-    struct StackFrameState
+    struct MsgPackCursor
     {
-        const uint32_t pop_counter = 0;
-        const bool is_object = false;
+        const std::string& data;
+        std::size_t position = 0;
     };
 
-    bool check_first_bits_equal_to(uint8_t check, uint8_t value)
+    std::string load_bytes(MsgPackCursor& cursor, const std::size_t length)
     {
-        const uint8_t bits_usage = std::max(1, static_cast<int>(std::floor(std::log2(check) + 1)));
-        const uint8_t bitshift = 8 - bits_usage;
-        check <<= bitshift;
-        value = (value >> bitshift) << bitshift;
-        return check == value;
+        if (length > cursor.data.size() - cursor.position)
+        {
+            throw std::runtime_error("unexpected end of msgpack data");
+        }
+        std::string bytes = cursor.data.substr(cursor.position, length);
+        cursor.position += length;
+        return bytes;
     }
 
-    vili::node from_string(const std::string& msgpack)
+    uint8_t load_code(MsgPackCursor& cursor)
+    {
+        if (cursor.position >= cursor.data.size())
+        {
+            throw std::runtime_error("unexpected end of msgpack data");
+        }
+        return static_cast<uint8_t>(cursor.data[cursor.position++]);
+    }
+
+    vili::node load_element(MsgPackCursor& cursor);
+
+    vili::node load_array(MsgPackCursor& cursor, const std::size_t array_length)
     {
-        vili::parser::state state;
-        auto logger = [&state]<class... Args>(fmt::format_string<Args...> str, Args&&... args)
-        {
-            /* const auto indent = std::string(state.depth(), ' ');
-            const auto fmtstring = fmt::format(str, std::forward<Args>(args)...);
-            // std::cout << indent << fmtstring << std::endl;*/
-        };
-        state.set_active_identifier("default");
-        std::vector<StackFrameState> stack_states;
-        bool first_element = true;
-        std::vector<uint8_t> full_code(msgpack.begin(), msgpack.end());
-        for (uint32_t idx = 0; idx < msgpack.size(); idx++)
-        {
-            const uint8_t code = msgpack[idx];
-            bool found_code = true;
-            switch (code)
+        vili::node array = vili::array {};
+        vili::array& elements = array.as<vili::array>();
+        // Each element takes at least one byte, corrupted lengths don't allocate
+        elements.reserve(std::min(array_length, cursor.data.size() - cursor.position));
+        for (std::size_t i = 0; i < array_length; i++)
+        {
+            elements.push_back(load_element(cursor));
+        }
+        return array;
+    }
+
+    vili::node load_object(MsgPackCursor& cursor, const std::size_t object_length)
+    {
+        vili::node object = vili::object {};
+        for (std::size_t i = 0; i < object_length; i++)
+        {
+            vili::node key = load_element(cursor);
+            if (!key.is_string())
             {
-            // boolean
-            case 0xc2:
-                logger("Push false");
-                state.push(false);
-                break;
-            case 0xc3:
-                logger("Push true");
-                state.push(true);
-                break;
-            // float
-            case 0xca:
-            case 0xcb:
-                {
-                    const uint8_t data_length = (code == 0xca) ? 4 : 8;
-                    auto value = load_float(msgpack.substr(idx + 1, data_length));
-                    logger("Push float {}", value);
-                    state.push(value);
-                    idx += data_length;
-                }
-                break;
-            // unsigned integer
-            case 0xcc:
-            case 0xcd:
-            case 0xce:
-            case 0xcf:
-                {
-                    const uint8_t data_length = std::pow(2, code - 0xcc);
-                    auto value = load_unsigned_integer(msgpack.substr(idx + 1, data_length));
-                    logger("Push unsigned integer {}", value);
-                    state.push(value);
-                    idx += data_length;
-                }
-                break;
-            // signed integer
-            case 0xd0:
-            case 0xd1:
-            case 0xd2:
-            case 0xd3:
-                {
-                    const uint8_t data_length = std::pow(2, code - 0xd0);
-                    auto value = load_signed_integer(msgpack.substr(idx + 1, data_length));
-                    logger("Push signed integer {}", value);
-                    state.push(value);
-                    idx += data_length;
-                }
-                break;
-            // string
-            case 0xd9:
-            case 0xda:
-            case 0xdb:
-                {
-                    const uint8_t size_header_length = std::pow(2, code - 0xd9);
-                    const auto string_length
-                        = load_unsigned_integer(msgpack.substr(idx + 1, size_header_length));
-                    std::string string_data
-                        = msgpack.substr(idx + 1 + size_header_length, string_length);
-                    if (state.get_active_identifier().empty())
-                    {
-                        logger("=> Push string (as identifier) '{}'", string_data);
-                        state.set_active_identifier(std::move(string_data));
-                    }
-                    else
-                    {
-                        logger("Push string (as data) '{}'", string_data);
-                        state.push(string_data);
-                    }
-                    idx += size_header_length + string_length;
-                }
-                break;
-            // array
-            case 0xdc:
-            case 0xdd:
-                {
-                    const uint8_t size_header_length = std::pow(2, code - 0xdb); // starts at 2 bytes min
-                    const auto array_length
-                        = load_unsigned_integer(msgpack.substr(idx + 1, size_header_length));
-                    logger("Push new array");
-                    state.push(vili::array {});
-                    state.open_block();
-                    stack_states.push_back(
-                        StackFrameState { static_cast<uint32_t>(array_length), false });
-                    idx += size_header_length;
-                }
-                break;
-            // object
-            case 0xde:
-            case 0xdf:
-                {
-                    const uint8_t size_header_length = std::pow(2, code - 0xdd); // starts at 2 bytes min
-                    const auto object_length
-                        = load_unsigned_integer(msgpack.substr(idx + 1, size_header_length));
-                    if (first_element)
-                    {
-                        first_element = false;
-                        logger("Push root object");
-                        state.set_active_identifier("");
-                    }
-                    else
-                    {
-                        logger("Push new object");
-                        state.push(vili::object {});
-                        state.open_block();
-                    }
-                    stack_states.push_back(
-                        StackFrameState { static_cast<uint32_t>(object_length), true });
-                    idx += size_header_length;
-                }
-            default:
-                found_code = false;
-                break;
-            };
-            if (!found_code)
+                throw std::runtime_error("object keys must be strings");
+            }
+            object.emplace(key.as<vili::string>(), load_element(cursor));
+        }
+        return object;
+    }
+
+    vili::node load_element(MsgPackCursor& cursor)
+    {
+        const uint8_t code = load_code(cursor);
+        // positive fixint
+        if (code <= 0x7f)
+        {
+            return vili::integer(code);
+        }
+        // negative fixint
+        if (code >= 0xe0)
+        {
+            return vili::integer(static_cast<int8_t>(code));
+        }
+        // fixstr
+        if ((code & 0b11100000) == 0b10100000)
+        {
+            return load_bytes(cursor, code & 0b00011111);
+        }
+        // fixarray
+        if ((code & 0b11110000) == 0b10010000)
+        {
+            return load_array(cursor, code & 0b00001111);
+        }
+        // fixmap
+        if ((code & 0b11110000) == 0b10000000)
+        {
+            return load_object(cursor, code & 0b00001111);
+        }
+        switch (code)
+        {
+        // nil
+        case 0xc0:
+            return vili::node {};
+        // boolean
+        case 0xc2:
+            return false;
+        case 0xc3:
+            return true;
+        // float
+        case 0xca:
+            return load_float(load_bytes(cursor, 4));
+        case 0xcb:
+            return load_float(load_bytes(cursor, 8));
+        // unsigned integer
+        case 0xcc:
+        case 0xcd:
+        case 0xce:
+        case 0xcf:
+            return load_unsigned_integer(load_bytes(cursor, std::size_t(1) << (code - 0xcc)));
+        // signed integer
+        case 0xd0:
+        case 0xd1:
+        case 0xd2:
+        case 0xd3:
+            return load_signed_integer(load_bytes(cursor, std::size_t(1) << (code - 0xd0)));
+        // string
+        case 0xd9:
+        case 0xda:
+        case 0xdb:
             {
-                // unsigned 7 bits
-                if (check_first_bits_equal_to(0b0, code))
-                {
-                    logger("Push unsigned integer (SC) {}", code);
-                    state.push(code);
-                }
-                // signed 5 bits
-                else if (check_first_bits_equal_to(0b111, code))
-                {
-                    logger("Push signed integer (SC) {}", code);
-                    state.push(static_cast<int8_t>(code));
-                }
-                // string with length <= 31 bytes
-                else if (check_first_bits_equal_to(0b101, code))
-                {
-                    const uint8_t string_length = 0b10100000 ^ code;
-                    std::string string_data = msgpack.substr(idx + 1, string_length);
-                    if (state.get_active_identifier().empty())
-                    {
-                        logger("=> Push string (SC) (as identifier) '{}'", string_data);
-                        state.set_active_identifier(std::move(string_data));
-                    }
-                    else
-                    {
-                        logger("Push string (SC) (as data) '{}'", string_data);
-                        state.push(string_data);
-                    }
-                    idx += string_length;
-                }
-                // array with up to 15 elements
-                else if (check_first_bits_equal_to(0b1001, code))
-                {
-                    const uint8_t array_length = 0b10010000 ^ code;
-                    logger("Push new array (SC)");
-                    state.push(vili::array {});
-                    state.open_block();
-                    stack_states.push_back(StackFrameState { static_cast<uint32_t>(array_length), false });
-                }
-                // object with up to 15 elements
-                else if (check_first_bits_equal_to(0b1000, code))
-                {
-                    const auto object_length = 0b10000000 ^ code;
-                    if (first_element)
-                    {
-                        first_element = false;
-                        logger("Push root object (SC)");
-                        state.set_active_identifier("");
-                    }
-                    else
-                    {
-                        state.push(vili::object {});
-                        logger("Push new object (SC)");
-                        state.open_block();
-                    }
-                    stack_states.push_back(StackFrameState { static_cast<uint32_t>(object_length), true });
-                }
-                else
-                {
-                    throw std::runtime_error("unknown instruction code");
-                }
+                const auto string_length = load_unsigned_integer(
+                    load_bytes(cursor, std::size_t(1) << (code - 0xd9)));
+                return load_bytes(cursor, static_cast<std::size_t>(string_length));
             }
-            if (first_element)
+        // array (size header starts at 2 bytes)
+        case 0xdc:
+        case 0xdd:
             {
-                first_element = false;
-                if (state.root.contains("default"))
-                {
-                    return state.root.at("default");
-                }
+                const auto array_length = load_unsigned_integer(
+                    load_bytes(cursor, std::size_t(2) << (code - 0xdc)));
+                return load_array(cursor, static_cast<std::size_t>(array_length));
             }
-            while (!stack_states.empty() && stack_states.back().pop_counter == state.top().size())
+        // object (size header starts at 2 bytes)
+        case 0xde:
+        case 0xdf:
             {
-                logger("Closing block");
-                stack_states.pop_back();
-                state.close_block();
+                const auto object_length = load_unsigned_integer(
+                    load_bytes(cursor, std::size_t(2) << (code - 0xde)));
+                return load_object(cursor, static_cast<std::size_t>(object_length));
             }
+        default:
+            throw std::runtime_error("unknown instruction code");
         }
-        return state.root;
+    }
+
+    vili::node from_string(const std::string& msgpack)
+    {
+        MsgPackCursor cursor { msgpack };
+        return load_element(cursor);
     }
 
     std::string to_string(const vili::node& node)
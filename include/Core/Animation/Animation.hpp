@@ -1,5 +1,7 @@
 #pragma once
 
+#include <deque>
+#include <limits>
 #include <unordered_map>
 
 #include <Animation/AnimationGroup.hpp>
@@ -107,7 +109,8 @@ namespace obe::animation
         std::string m_next_animation_name;
         bool m_over = false;
         AnimationStatus m_status = AnimationStatus::Play;
-        time::TimeUnit m_clock = 0;
+        // Time elapsed since the last step, a new or reset state steps on its first update
+        time::TimeUnit m_clock = std::numeric_limits<time::TimeUnit>::infinity();
         time::TimeUnit m_sleep = 0;
 
         void execute_instruction();
@@ -166,8 +169,9 @@ namespace obe::animation
         /**
          * \brief Update the Animation (Updates the current AnimationGroup,
          *        executes the AnimationCode)
+         * \param dt Time elapsed since the last update (in seconds)
          */
-        void update();
+        void update(time::TimeUnit dt);
         const Animation& get_animation() const;
 
         [[nodiscard]] uint32_t get_current_frame_index() const;
@@ -189,7 +193,8 @@ namespace obe::animation
 
         std::vector<vili::node> m_code;
 
-        std::vector<graphics::Texture> m_textures;
+        // TextureParts reference these Textures, a deque keeps them in place
+        std::deque<graphics::Texture> m_textures;
         std::vector<graphics::TexturePart> m_frames;
         std::unordered_map<uint32_t, vili::node> m_frames_metadata;
 
@@ -318,8 +323,9 @@ namespace obe::animation
         /**
          * \brief Update the Animation (Updates the current AnimationGroup,
          *        executes the AnimationCode)
+         * \param dt Time elapsed since the last update (in seconds)
          */
-        void update();
+        void update(time::TimeUnit dt);
         /**
          * \brief Enables or disables anti-aliasing for textures of this animation
          * \param anti_aliasing should be true to enable anti_aliasing, false otherwise
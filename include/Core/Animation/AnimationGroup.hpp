@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <limits>
 
 #include <Graphics/Texture.hpp>
 #include <Time/TimeUtils.hpp>
@@ -14,9 +15,10 @@ namespace obe::animation
     {
     private:
         /**
-         * \brief Stores the last epoch to wait until the AnimationGroup delay
+         * \brief Time elapsed since the last frame change, a new or reset
+         *        AnimationGroup changes frame on the first call to next
          */
-        time::TimeUnit m_group_clock = 0;
+        time::TimeUnit m_group_clock = std::numeric_limits<time::TimeUnit>::infinity();
         /**
          * \brief The delay between each frame of the AnimationGroup
          */
@@ -122,5 +124,11 @@ namespace obe::animation
          * \param loops Amount of loops to do
          */
         void set_loops(int loops) noexcept;
+        /**
+         * \brief Advances the clock of the AnimationGroup, next and previous
+         *        only change the frame once the delay has elapsed
+         * \param dt Time elapsed since the last update (in seconds)
+         */
+        void update(time::TimeUnit dt) noexcept;
     };
 } // namespace obe::animation
@@ -6,6 +6,10 @@
 
 namespace obe
 {
+    namespace engine
+    {
+        class ResourceManager;
+    } // namespace engine
     namespace graphics
     {
         class Sprite;
@@ -42,7 +46,9 @@ namespace obe::animation
     {
     private:
         std::unordered_map<std::string, std::unique_ptr<AnimationState>> m_states;
-        const Animator& m_parent;
+        const Animator* m_parent;
+        // Keeps the Animator alive when it is shared with other AnimatorStates
+        std::shared_ptr<const Animator> m_shared_parent;
         AnimationState* m_current_animation = nullptr;
         bool m_paused = false;
         graphics::Sprite* m_target = nullptr;
@@ -51,13 +57,32 @@ namespace obe::animation
         void apply_texture() const;
 
     public:
+        /**
+         * \brief Creates an AnimatorState without Animator, it has no Animation
+         *        until an Animator is loaded
+         */
+        AnimatorState();
         AnimatorState(const Animator& parent);
+        /**
+         * \nobind
+         * \brief Creates an AnimatorState playing an Animator shared with other
+         *        AnimatorStates, the Animator is kept alive by the AnimatorState
+         */
+        explicit AnimatorState(std::shared_ptr<const Animator> parent);
         /**
          * \brief Get the name of the currently played Animation
          * \return A std::string containing the name of the currently played
          *         Animation
          */
         void load();
+        /**
+         * \brief Plays another Animator, loaded from the given path, with the
+         *        AnimatorState
+         * \param path Path to the Animator directory
+         * \param resources ResourceManager used to share the Animator with the
+         *        other AnimatorStates playing it (optional)
+         */
+        void load(system::Path path, engine::ResourceManager* resources = nullptr);
         [[nodiscard]] std::string get_current_animation_name() const noexcept;
         /**
          * \brief Set the Animation to play by name
@@ -75,14 +100,28 @@ namespace obe::animation
         void set_paused(bool pause) noexcept;
         /**
          * \brief Update the Animator and the currently played Animation
+         * \param dt Time elapsed since the last update (in seconds)
          */
-        void update();
+        void update(time::TimeUnit dt);
         void set_target(graphics::Sprite& sprite,
             AnimatorTargetScaleMode target_scale_mode = AnimatorTargetScaleMode::Fit);
         void reset();
         [[nodiscard]] graphics::Sprite* get_target() const;
         [[nodiscard]] AnimationState* get_current_animation() const;
         [[nodiscard]] const graphics::TexturePart& get_current_texture() const;
+        /**
+         * \brief Get the name of all the Animations of the played Animator
+         */
+        [[nodiscard]] std::vector<std::string> get_all_animations_names() const;
+        /**
+         * \brief Get the path of the played Animator
+         */
+        [[nodiscard]] system::Path get_filesystem_path() const;
+        /**
+         * \nobind
+         * \brief Get the played Animator, it can be shared with other
+         *        AnimatorStates so it is not exposed to scripts
+         */
         [[nodiscard]] const Animator& get_animator() const;
     };
 
@@ -96,6 +135,7 @@ namespace obe::animation
         AnimatorState m_default_state;
         std::unordered_map<std::string, std::unique_ptr<Animation>> m_animations;
         system::Path m_path;
+        bool m_anti_aliasing = false;
 
         friend class AnimatorState;
 
@@ -155,13 +195,22 @@ namespace obe::animation
         void set_paused(bool pause) noexcept;
         /**
          * \brief Update the Animator and the currently played Animation
+         * \param dt Time elapsed since the last update (in seconds)
          */
-        void update();
+        void update(time::TimeUnit dt);
 
         void set_target(graphics::Sprite& sprite,
             AnimatorTargetScaleMode target_scale_mode = AnimatorTargetScaleMode::Fit);
 
         [[nodiscard]] system::Path get_filesystem_path() const;
+        /**
+         * \brief Enables or disables anti-aliasing for the textures of the
+         *        Animations loaded afterwards, the anti-aliasing of the target
+         *        is used instead if the Animator has one
+         * \param anti_aliasing should be true to enable anti-aliasing, false otherwise
+         */
+        void set_anti_aliasing(bool anti_aliasing) noexcept;
+        [[nodiscard]] bool is_anti_aliased() const noexcept;
 
         [[nodiscard]] AnimatorState make_state() const;
     };
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <sol/sol.hpp>
+
+namespace obe::bindings
+{
+    /**
+     * \nobind
+     * \brief Defines when the namespaces of the Lua bindings are loaded
+     */
+    enum class BindingsLoading
+    {
+        /**
+         * \brief Every namespace is loaded when the bindings are indexed
+         */
+        Eager,
+        /**
+         * \brief Namespaces are loaded on their first access, only obe and
+         *        obe.system are loaded when the bindings are indexed.
+         *        Iterating obe or vili with pairs loads all their namespaces
+         */
+        Lazy
+    };
+
+    /**
+     * \nobind
+     * \brief Creates the obe and vili namespaces with their bindings
+     */
+    void index_core_bindings(sol::state_view state, BindingsLoading loading = BindingsLoading::Eager);
+}
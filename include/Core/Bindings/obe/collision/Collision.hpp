@@ -11,6 +11,7 @@ namespace obe::collision::bindings
     void load_class_collider(sol::state_view state);
     void load_class_collider_component(sol::state_view state);
     void load_class_collision_data(sol::state_view state);
+    void load_class_sweep_hit(sol::state_view state);
     void load_class_collision_space(sol::state_view state);
     void load_class_complex_polygon_collider(sol::state_view state);
     void load_class_polygon_collider(sol::state_view state);
@@ -21,4 +22,5 @@ namespace obe::collision::bindings
     void load_class_collision_rejection_pair(sol::state_view state);
     void load_enum_collider_type(sol::state_view state);
     void load_function_collider_type_to_c2type(sol::state_view state);
+    void load_function_get_tag_layer(sol::state_view state);
 };
\ No newline at end of file
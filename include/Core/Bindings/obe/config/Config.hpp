@@ -8,4 +8,7 @@ namespace obe::config::bindings
 {
     void load_class_configuration_manager(sol::state_view state);
     void load_class_version(sol::state_view state);
+    void load_function_get_compiled_vili_path(sol::state_view state);
+    void load_function_load_vili_file(sol::state_view state);
+    void load_function_compile_vili_file(sol::state_view state);
 };
\ No newline at end of file
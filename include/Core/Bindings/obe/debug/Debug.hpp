@@ -6,8 +6,14 @@ namespace sol
 };
 namespace obe::debug::bindings
 {
+    void load_class_profiler(sol::state_view state);
+    void load_class_profiler_sample(sol::state_view state);
     void load_enum_log_level(sol::state_view state);
+    void load_enum_log_overflow_policy(sol::state_view state);
     void load_function_init_logger(sol::state_view state);
+    void load_function_enable_async_logging(sol::state_view state);
+    void load_function_disable_async_logging(sol::state_view state);
+    void load_function_flush_logger(sol::state_view state);
     void load_function_trace(sol::state_view state);
     void load_function_debug(sol::state_view state);
     void load_function_info(sol::state_view state);
@@ -15,4 +21,5 @@ namespace obe::debug::bindings
     void load_function_error(sol::state_view state);
     void load_function_critical(sol::state_view state);
     void load_global_log(sol::state_view state);
+    void load_global_profile(sol::state_view state);
 };
\ No newline at end of file
@@ -0,0 +1,11 @@
+#pragma once
+
+namespace sol
+{
+    class state_view;
+};
+namespace obe::events::Collision::bindings
+{
+    void load_class_began(sol::state_view state);
+    void load_class_ended(sol::state_view state);
+};
\ No newline at end of file
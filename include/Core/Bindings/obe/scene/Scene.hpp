@@ -10,4 +10,5 @@ namespace obe::scene::bindings
     void load_class_scene(sol::state_view state);
     void load_class_scene_node(sol::state_view state);
     void load_class_scene_render_options(sol::state_view state);
+    void load_class_scene_render_statistics(sol::state_view state);
 };
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <optional>
 #include <unordered_set>
 
 #include <cute/cute_c2.h>
@@ -10,6 +11,7 @@
 namespace obe::collision
 {
     class Collider;
+    class CollisionSpace;
 
     /**
      * \brief Struct containing data of a collision applied to a collider
@@ -27,6 +29,33 @@ namespace obe::collision
         transform::UnitVector offset;
     };
 
+    /**
+     * \brief Result of a continuous collision test between a moving Collider and
+     *        another Collider
+     */
+    class SweepHit
+    {
+    public:
+        /**
+         * \brief Collider hit by the moving Collider
+         */
+        const Collider* collider = nullptr;
+        /**
+         * \brief Time of impact, fraction of the offset travelled before the impact
+         *        (between 0 and 1)
+         */
+        double toi = 1;
+        /**
+         * \brief Contact normal at the time of impact, from the moving Collider
+         *        towards the hit Collider
+         */
+        transform::UnitVector normal;
+        /**
+         * \brief Offset the moving Collider can travel before the impact
+         */
+        transform::UnitVector offset;
+    };
+
     enum class ColliderType
     {
         Collider,
@@ -40,6 +69,14 @@ namespace obe::collision
 
     C2_TYPE collider_type_to_c2type(ColliderType collider_type);
 
+    /**
+     * \brief Gets the layer of a Collider tag, tags are interned the first time
+     *        they are used and keep the same layer for the lifetime of the program
+     * \param tag Tag to get the layer of (the empty tag is always layer 0)
+     * \return The compact layer id of the tag
+     */
+    std::size_t get_tag_layer(const std::string& tag);
+
     /**
      * \brief Class used for all Collisions in the engine, it's a Polygon
      * containing n points
@@ -48,12 +85,20 @@ namespace obe::collision
     {
     private:
         std::string m_tag;
+        std::size_t m_layer = 0;
+        mutable CollisionSpace* m_collision_space = nullptr;
+        mutable bool m_dirty = false;
 
         friend class CollisionSpace;
 
     protected:
         [[nodiscard]] virtual const void* get_c2_shape() const = 0;
         [[nodiscard]] virtual const c2x* get_c2_space_transform() const = 0;
+        /**
+         * \brief Notifies the owning CollisionSpace (if any) that the shape or the
+         *        position of the Collider changed
+         */
+        void notify_transform_change() const;
 
     public:
         /**
@@ -64,7 +109,16 @@ namespace obe::collision
 
         Collider() = default;
         explicit Collider(const transform::UnitVector& position);
-        ~Collider() override = default;
+        /**
+         * \brief Copies the Collider, the copy does not belong to any CollisionSpace
+         */
+        Collider(const Collider& other);
+        /**
+         * \brief Copies the shape of another Collider, the CollisionSpace the
+         *        Collider belongs to is kept
+         */
+        Collider& operator=(const Collider& other);
+        ~Collider() override;
 
         // Tags
         /**
@@ -78,6 +132,17 @@ namespace obe::collision
          *         the chosen List
          */
         [[nodiscard]] std::string get_tag() const;
+        /**
+         * \brief Gets the layer of the Collider's Tag
+         * \return The layer id obtained when interning the Tag (see get_tag_layer)
+         */
+        [[nodiscard]] std::size_t get_layer() const;
+        /**
+         * \brief Gets the CollisionSpace the Collider has been added to
+         * \return A pointer to the CollisionSpace, nullptr if the Collider is not
+         *         in any CollisionSpace
+         */
+        [[nodiscard]] CollisionSpace* get_collision_space() const;
 
         /**
          * \brief Checks if two polygons are intersecting
@@ -97,6 +162,19 @@ namespace obe::collision
             const transform::UnitVector& self_offset = transform::UnitVector(0, 0),
             const transform::UnitVector& other_offset = transform::UnitVector(0, 0)) const;
 
+        /**
+         * \brief Computes the time of impact between this Collider moving by
+         *        self_offset and another Collider moving by other_offset
+         * \param collider Collider to check the Collision with
+         * \param self_offset Distance this Collider should move to
+         * \param other_offset Distance the other Collider should move to
+         * \return The impact if the Colliders touch while getting closer to each
+         *         other, no value if they never touch or are moving apart
+         */
+        [[nodiscard]] virtual std::optional<SweepHit> sweep(const Collider& collider,
+            const transform::UnitVector& self_offset,
+            const transform::UnitVector& other_offset = transform::UnitVector(0, 0)) const;
+
         /*
          * \brief Returns the cached bounding box. Recalculates it if necessary.
          */
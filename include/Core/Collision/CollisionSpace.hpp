@@ -1,9 +1,38 @@
 #pragma once
 
+#include <cstdint>
 #include <unordered_map>
 
 #include <Collision/Collider.hpp>
 #include <Collision/Quadtree.hpp>
+#include <Event/EventGroup.hpp>
+#include <System/JobPool.hpp>
+
+namespace obe::events
+{
+    namespace Collision
+    {
+        /**
+         * \brief Triggered by CollisionSpace::step when two Colliders start colliding
+         */
+        struct Began
+        {
+            static constexpr std::string_view id = "Began";
+            const collision::Collider* collider1;
+            const collision::Collider* collider2;
+        };
+
+        /**
+         * \brief Triggered by CollisionSpace::step when two Colliders stop colliding
+         */
+        struct Ended
+        {
+            static constexpr std::string_view id = "Ended";
+            const collision::Collider* collider1;
+            const collision::Collider* collider2;
+        };
+    } // namespace Collision
+} // namespace obe::events
 
 namespace obe::collision
 {
@@ -19,19 +48,53 @@ namespace obe::collision
     };
 
     using ReachableCollider = std::pair<const Collider*, transform::UnitVector>;
+    using CollisionPair = std::pair<const Collider*, const Collider*>;
 
     class CollisionSpace
     {
     private:
         std::unordered_set<const Collider*> m_colliders;
         std::unordered_map<std::string, std::unordered_set<std::string>> m_tags_blacklists;
-        Quadtree m_quadtree;
+        // Blacklists compiled as one bitmask row per layer, symmetric so a single
+        // bit tells if two layers can collide
+        std::vector<std::uint64_t> m_collision_matrix;
+        std::size_t m_matrix_layers = 0;
+        std::size_t m_matrix_stride = 0;
+        mutable Quadtree m_quadtree;
+        mutable std::vector<const Collider*> m_dirty_colliders;
+        std::vector<CollisionPair> m_collisions;
+        event::EventGroupPtr e_collision;
+        std::size_t m_listeners_amount = 0;
+        system::JobPool* m_job_pool = nullptr;
+
+        friend class Collider;
+        void mark_as_dirty(const Collider* collider);
     protected:
-        static bool matches_any_tag(const std::unordered_set<std::string>& input_tags,
-            const std::unordered_set<std::string>& whitelist_or_blacklist);
-        bool can_collide_with(const Collider& collider1, const Collider& collider2, bool check_both_directions = true) const;
+        /**
+         * \brief Checks whether the tags of two Colliders are not blacklisted by one
+         *        another (in both directions)
+         */
+        bool can_collide_with(const Collider& collider1, const Collider& collider2) const;
+        /**
+         * \brief Rebuilds the collision matrix from the tags blacklists
+         */
+        void compile_collision_matrix();
+        /**
+         * \brief Moves the Colliders that changed since the last query to their new
+         *        Quadtree node (only if they left their previous one)
+         */
+        void update_dirty_colliders() const;
     public:
         CollisionSpace();
+        /**
+         * \brief Creates a CollisionSpace that publishes the results of step
+         *        through the given EventGroup
+         * \param events EventGroup where the Began and Ended events are added
+         */
+        explicit CollisionSpace(event::EventGroupPtr events);
+        CollisionSpace(const CollisionSpace&) = delete;
+        CollisionSpace& operator=(const CollisionSpace&) = delete;
+        ~CollisionSpace();
 
         /**
          * \brief Adds a Collider in the CollisionSpace
@@ -54,10 +117,31 @@ namespace obe::collision
          * \param collider Pointer to the collider to remove from the CollisionSpace
          */
         void remove_collider(const Collider* collider);
+        /**
+         * \brief Forces the Collider to be moved to its new Quadtree node, Colliders
+         *        added to the CollisionSpace already do this automatically before
+         *        the next query when they move
+         * \param collider Pointer to the collider to refresh
+         */
         void refresh_collider(const Collider* collider);
 
+        /**
+         * \brief Rebuilds the whole Quadtree
+         */
         void refresh_quadtree();
 
+        /**
+         * \nobind
+         * \brief Sets the JobPool used to spread the narrow phase of the queries
+         *        across several threads, results are identical to the serial ones
+         * \param job_pool Pointer to the JobPool to use, nullptr to run serially
+         */
+        void set_job_pool(system::JobPool* job_pool);
+        /**
+         * \nobind
+         */
+        [[nodiscard]] system::JobPool* get_job_pool() const;
+
         [[nodiscard]] bool collides(const Collider& collider) const;
         [[nodiscard]] transform::UnitVector get_offset_before_collision(const Collider& collider,
             const transform::UnitVector& offset = transform::UnitVector(0, 0)) const;
@@ -67,6 +151,37 @@ namespace obe::collision
             = transform::UnitVector(0, 0)) const;
         std::vector<ReachableCollider> get_reachable_colliders(const Collider& collider,
             const transform::UnitVector& offset = transform::UnitVector(0, 0)) const;
+        /**
+         * \brief Finds every Collider hit by a Collider moving by the given offset
+         *        (continuous collision, no Collider can be tunnelled through)
+         * \param collider Collider that moves
+         * \param offset Distance the Collider should move to
+         * \return A std::vector containing the hits sorted by time of impact
+         */
+        [[nodiscard]] std::vector<SweepHit> sweep(
+            const Collider& collider, const transform::UnitVector& offset) const;
+        /**
+         * \brief Finds all the pairs of Colliders currently colliding using a single
+         *        pass on the Quadtree (tags blacklists are respected)
+         * \return A std::vector containing all the colliding pairs, the Collider with
+         *         the lowest address is always the first element of a pair
+         */
+        [[nodiscard]] std::vector<CollisionPair> find_collisions() const;
+        /**
+         * \brief Computes all the colliding pairs and triggers the Began / Ended
+         *        events for the pairs that changed since the previous step
+         */
+        void step();
+        /**
+         * \brief Gets the colliding pairs found by the last call to step
+         * \return A std::vector containing all the colliding pairs
+         */
+        [[nodiscard]] const std::vector<CollisionPair>& get_collisions() const;
+        /**
+         * \brief Checks whether the Began or Ended events are listened to
+         * \return true if at least one listener is registered, false otherwise
+         */
+        [[nodiscard]] bool has_collision_listeners() const;
 
         void add_tag_to_blacklist(const std::string& source_tag, const std::string& rejected_tag);
         void remove_tag_to_blacklist(
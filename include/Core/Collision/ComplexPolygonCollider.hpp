@@ -56,6 +56,15 @@ namespace obe::collision
             const transform::UnitVector& self_offset = transform::UnitVector(0, 0),
             const transform::UnitVector& other_offset = transform::UnitVector(0, 0)) const override;
 
+        /**
+         * \brief Computes the time of impact using get_offset_before_collision,
+         *        the normal is approximated by the direction of the movement
+         */
+        [[nodiscard]] std::optional<SweepHit> sweep(const Collider& collider,
+            const transform::UnitVector& self_offset,
+            const transform::UnitVector& other_offset
+            = transform::UnitVector(0, 0)) const override;
+
         // Inherited via Collider
         virtual transform::AABB get_bounding_box() const override;
     };
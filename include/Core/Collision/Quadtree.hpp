@@ -1,7 +1,8 @@
 #pragma once
 
-#include <array>
-#include <memory>
+#include <cstdint>
+#include <limits>
+#include <unordered_map>
 #include <vector>
 
 #include <Collision/Collider.hpp>
@@ -9,43 +10,105 @@
 
 namespace obe::collision
 {
+    /**
+     * \brief Quadtree used for the broad phase of the CollisionSpace, nodes and
+     *        entries are stored in flat arrays and recycled so splitting, merging
+     *        and clearing the tree do not allocate once it reached its size
+     */
     class Quadtree
     {
+    public:
+        static constexpr std::size_t DefaultThreshold = 16;
+        static constexpr std::size_t DefaultMaxDepth = 8;
+
     private:
-        static constexpr auto Threshold = std::size_t(16);
-        static constexpr auto MaxDepth = std::size_t(8);
+        using Index = std::uint32_t;
+        static constexpr Index NoIndex = std::numeric_limits<Index>::max();
 
         struct Node
         {
-            std::array<std::unique_ptr<Node>, 4> children;
-            std::vector<const Collider*> values;
+            transform::AABB box;
+            Index parent = NoIndex;
+            // Children are stored contiguously, this is the index of the first one
+            Index first_child = NoIndex;
+            Index first_entry = NoIndex;
+            std::size_t entries_amount = 0;
+            std::size_t depth = 0;
+        };
+
+        struct Entry
+        {
+            const Collider* value = nullptr;
+            // Bounding box of the value when it was inserted or last updated
+            transform::AABB box;
+            Index node = NoIndex;
+            Index previous = NoIndex;
+            Index next = NoIndex;
         };
 
         transform::AABB m_box;
-        std::unique_ptr<Node> m_root;
+        std::size_t m_threshold;
+        std::size_t m_max_depth;
+        std::vector<Node> m_nodes;
+        std::vector<Index> m_free_children;
+        std::vector<Entry> m_entries;
+        std::vector<Index> m_free_entries;
+        std::unordered_map<const Collider*, Index> m_locations;
 
     protected:
-        bool is_leaf(const Node* node) const;
-        transform::AABB compute_box(const transform::AABB& box, int i) const;
-        int get_quadrant(const transform::AABB& nodeBox, const transform::AABB& valueBox) const;
-        void add_internal(Node* node, std::size_t depth, const transform::AABB& box, const Collider* value);
-        void split(Node* node, const transform::AABB& box);
-        bool remove_internal(Node* node, const transform::AABB& box, const Collider* value);
-        void remove_value(Node* node, const Collider* value);
-        bool try_merge(Node* node);
-        void query_internal(Node* node, const transform::AABB& box, const transform::AABB& query_box, std::vector<const Collider*>& values) const;
-        void find_all_intersections_internal(Node* node, std::vector<std::pair<const Collider*, const Collider*>>& intersections) const;
-        void find_intersections_in_descendants(Node* node, const Collider* value,
+        [[nodiscard]] bool is_leaf(Index node) const;
+        int get_quadrant(const transform::AABB& node_box, const transform::AABB& value_box) const;
+        Index allocate_entry(const Collider* value);
+        Index allocate_children(Index node);
+        void link_entry(Index node, Index entry);
+        void unlink_entry(Index entry);
+        void add_internal(Index node, Index entry);
+        void split(Index node);
+        bool try_merge(Index node);
+        void merge_ancestors(Index node);
+        void query_internal(Index node, const transform::AABB& query_box,
+            std::vector<const Collider*>& values) const;
+        void find_all_intersections_internal(
+            Index node, std::vector<std::pair<const Collider*, const Collider*>>& intersections) const;
+        void find_intersections_in_descendants(Index node, const Entry& entry,
             std::vector<std::pair<const Collider*, const Collider*>>& intersections) const;
 
     public:
-        Quadtree(const transform::AABB& box);
+        /**
+         * \brief Creates an empty Quadtree
+         * \param box Area covered by the Quadtree
+         * \param threshold Amount of values a leaf can hold before being split
+         * \param max_depth Depth at which leaves are never split anymore
+         */
+        Quadtree(const transform::AABB& box, std::size_t threshold = DefaultThreshold,
+            std::size_t max_depth = DefaultMaxDepth);
+        /**
+         * \brief Removes all the values, the memory used by the nodes is kept
+         */
         void clear();
+        /**
+         * \brief Adds a value in the Quadtree, its bounding box is cached until the
+         *        next call to update (adding a value twice updates it)
+         * \param value Value to add in the Quadtree
+         */
         void add(const Collider* value);
+        /**
+         * \brief Removes a value from the Quadtree, the value is located using the
+         *        node it was stored in so it does not matter if it moved since insertion
+         * \param value Value to remove from the Quadtree
+         */
         void remove(const Collider* value);
+        /**
+         * \brief Refreshes the cached bounding box of a value and moves it to
+         *        another node if it left the node it is currently stored in
+         * \param value Value to update
+         * \return true if the value was moved to another node, false otherwise
+         */
+        bool update(const Collider* value);
+        [[nodiscard]] bool contains(const Collider* value) const;
+        [[nodiscard]] std::size_t get_threshold() const;
+        [[nodiscard]] std::size_t get_max_depth() const;
         std::vector<const Collider*> query(const transform::AABB& box) const;
         std::vector<std::pair<const Collider*, const Collider*>> find_all_intersections() const;
     };
-
-
 }
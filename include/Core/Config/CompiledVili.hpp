@@ -0,0 +1,29 @@
+#pragma once
+
+#include <string>
+
+#include <vili/node.hpp>
+
+namespace obe::config
+{
+    /**
+     * \brief Get the path of the compiled version of a vili file
+     *        ("scene.vili" is compiled to "scene.vilic")
+     * \param path Path of the vili file
+     */
+    std::string get_compiled_vili_path(const std::string& path);
+    /**
+     * \brief Loads a vili file from its compiled version when it was compiled
+     *        from the current content of the file, parses the file otherwise
+     * \param path Path of the vili file
+     * \throw vili::exceptions::file_not_found if the file can't be opened
+     */
+    vili::node load_vili_file(const std::string& path);
+    /**
+     * \brief Parses a vili file and writes its compiled version next to it
+     * \param path Path of the vili file
+     * \return true if the compiled file was written, false if the vili file
+     *         can't be parsed or the compiled file can't be written
+     */
+    bool compile_vili_file(const std::string& path);
+} // namespace obe::config
@@ -5,6 +5,41 @@
 
 #include <Types/SmartEnum.hpp>
 
+/**
+ * \brief Lowest level of the log calls made with the OBE_TRACE / OBE_DEBUG macros
+ *        that are compiled in (0 = Trace, 1 = Debug, 2 = Info, ...), calls below
+ *        this level are removed by the preprocessor (set by the OBE_LOG_ACTIVE_LEVEL
+ *        CMake option)
+ */
+#ifndef OBE_LOG_ACTIVE_LEVEL
+#define OBE_LOG_ACTIVE_LEVEL 0
+#endif
+
+/**
+ * \brief Checks the level of the Logger before evaluating and formatting the
+ *        arguments of the call
+ */
+#define OBE_LOG_CALL(level, ...)                                                                   \
+    do                                                                                             \
+    {                                                                                              \
+        if (::obe::debug::Log && ::obe::debug::Log->should_log(level))                            \
+        {                                                                                          \
+            ::obe::debug::Log->log(level, __VA_ARGS__);                                            \
+        }                                                                                          \
+    } while (false)
+
+#if OBE_LOG_ACTIVE_LEVEL <= 0
+#define OBE_TRACE(...) OBE_LOG_CALL(::spdlog::level::trace, __VA_ARGS__)
+#else
+#define OBE_TRACE(...) static_cast<void>(0)
+#endif
+
+#if OBE_LOG_ACTIVE_LEVEL <= 1
+#define OBE_DEBUG(...) OBE_LOG_CALL(::spdlog::level::debug, __VA_ARGS__)
+#else
+#define OBE_DEBUG(...) static_cast<void>(0)
+#endif
+
 namespace obe::debug
 {
     using Logger = std::shared_ptr<spdlog::logger>;
@@ -22,11 +57,44 @@ namespace obe::debug
     };
     using LogLevelMeta = types::SmartEnum<LogLevel>;
 
+    /**
+     * \brief Behaviour of the asynchronous Logger when its queue is full
+     */
+    enum class LogOverflowPolicy
+    {
+        /**
+         * \brief The calling thread waits until the writer thread makes room
+         */
+        Block,
+        /**
+         * \brief The oldest queued message is dropped
+         */
+        Drop
+    };
+    using LogOverflowPolicyMeta = types::SmartEnum<LogOverflowPolicy>;
+
     // TODO: Create a Logger class wrapper instead of separate function with a global
     /**
      * \brief Initialize the Logger
      */
     void init_logger(bool dump_log_to_file);
+    /**
+     * \brief Moves the formatting and writing of the log messages to a background
+     *        thread, the calling thread only pushes the messages in a bounded queue
+     * \param queue_size Maximum amount of messages waiting to be written
+     * \param overflow_policy What to do when a message is logged while the queue is full
+     */
+    void enable_async_logging(
+        std::size_t queue_size, LogOverflowPolicy overflow_policy = LogOverflowPolicy::Block);
+    /**
+     * \brief Writes every queued message, stops the background thread and goes
+     *        back to synchronous logging, call it before exiting or after a crash
+     */
+    void disable_async_logging();
+    /**
+     * \brief Writes every pending message to the sinks
+     */
+    void flush_logger();
 
     void trace(const std::string& content);
     void debug(const std::string& content);
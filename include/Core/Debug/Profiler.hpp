@@ -0,0 +1,169 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include <Time/TimeUtils.hpp>
+
+/**
+ * \brief Set to 0 to remove every OBE_PROFILE_SCOPE from the build (set by the
+ *        OBE_ENABLE_PROFILER CMake option)
+ */
+#ifndef OBE_ENABLE_PROFILER
+#define OBE_ENABLE_PROFILER 1
+#endif
+
+#define OBE_PROFILE_CONCAT_IMPL(a, b) a##b
+#define OBE_PROFILE_CONCAT(a, b) OBE_PROFILE_CONCAT_IMPL(a, b)
+
+/**
+ * \brief Times the rest of the enclosing block with the global Profiler, the
+ *        arguments are the name of the scope and an optional detail (id of a
+ *        GameObject, of a listener, ...)
+ */
+#if OBE_ENABLE_PROFILER
+#define OBE_PROFILE_SCOPE(...)                                                                     \
+    const ::obe::debug::ProfilerScope OBE_PROFILE_CONCAT(obe_profile_scope_, __LINE__)(__VA_ARGS__)
+#else
+#define OBE_PROFILE_SCOPE(...) static_cast<void>(0)
+#endif
+
+namespace obe::debug
+{
+    /**
+     * \brief A timed scope recorded by the Profiler
+     */
+    struct ProfilerSample
+    {
+        std::string name;
+        /**
+         * \brief Additional information about the scope (id of a GameObject, of a listener, ...)
+         */
+        std::string detail;
+        /**
+         * \brief Time elapsed between the start of the frame and the start of the scope
+         */
+        time::TimeUnit start = 0;
+        time::TimeUnit duration = 0;
+        /**
+         * \brief Amount of scopes enclosing this one
+         */
+        std::size_t depth = 0;
+    };
+
+    /**
+     * \brief Records the time spent in named scopes for each frame and can export
+     *        them as a Chrome trace (chrome://tracing, Perfetto, ...)
+     *        Scopes must be opened and closed on the main thread, when the
+     *        Profiler is disabled opening a scope only costs a branch
+     */
+    class Profiler
+    {
+    private:
+        using Clock = std::chrono::steady_clock;
+
+        bool m_enabled = false;
+        Clock::time_point m_origin = Clock::now();
+        Clock::time_point m_frame_start = m_origin;
+        std::vector<ProfilerSample> m_samples;
+        std::vector<std::size_t> m_open_scopes;
+        std::vector<ProfilerSample> m_last_frame_samples;
+        time::TimeUnit m_last_frame_duration = 0;
+
+        bool m_capturing = false;
+        std::size_t m_capture_limit = 0;
+        // Samples of the captured frames, their start is relative to m_origin
+        std::vector<ProfilerSample> m_trace;
+
+        [[nodiscard]] time::TimeUnit elapsed_since(Clock::time_point start) const;
+        void close_open_scopes();
+
+    public:
+        /**
+         * \brief Enables or disables the recording of scopes
+         */
+        void set_enabled(bool enabled);
+        [[nodiscard]] bool is_enabled() const
+        {
+            return m_enabled;
+        }
+        /**
+         * \brief Ends the current frame and starts a new one, called once per
+         *        frame by the Engine
+         */
+        void next_frame();
+        /**
+         * \brief Opens a new scope, it ends at the next call to end_scope
+         * \param name Name of the scope, samples with the same name are summed
+         *        in get_last_frame_timings
+         * \param detail Additional information about the scope
+         */
+        void begin_scope(std::string_view name, std::string_view detail = {});
+        /**
+         * \brief Closes the innermost scope opened with begin_scope
+         */
+        void end_scope();
+        /**
+         * \brief Get the scopes recorded during the last complete frame
+         */
+        [[nodiscard]] const std::vector<ProfilerSample>& get_last_frame_samples() const;
+        [[nodiscard]] time::TimeUnit get_last_frame_duration() const;
+        /**
+         * \brief Get the total time spent in each scope name during the last
+         *        complete frame
+         */
+        [[nodiscard]] std::unordered_map<std::string, time::TimeUnit>
+        get_last_frame_timings() const;
+        /**
+         * \brief Starts keeping every recorded scope for save_chrome_trace
+         * \param max_samples Amount of samples after which the capture stops
+         */
+        void start_capture(std::size_t max_samples = 1000000);
+        void stop_capture();
+        [[nodiscard]] bool is_capturing() const;
+        /**
+         * \brief Writes the captured samples in the Chrome trace event format
+         * \param path Path of the JSON file to write
+         * \return true if the file has been written, false otherwise
+         */
+        bool save_chrome_trace(const std::string& path) const;
+    };
+
+    /**
+     * \brief Profiler used by the Engine and by OBE_PROFILE_SCOPE
+     */
+    extern Profiler Profile;
+
+    /**
+     * \nobind
+     * \brief Opens a scope of the global Profiler until destroyed
+     */
+    class ProfilerScope
+    {
+    private:
+        bool m_active = false;
+
+    public:
+        explicit ProfilerScope(std::string_view name, std::string_view detail = {})
+        {
+            if (Profile.is_enabled())
+            {
+                m_active = true;
+                Profile.begin_scope(name, detail);
+            }
+        }
+        ~ProfilerScope()
+        {
+            if (m_active)
+            {
+                Profile.end_scope();
+            }
+        }
+        ProfilerScope(const ProfilerScope&) = delete;
+        ProfilerScope& operator=(const ProfilerScope&) = delete;
+    };
+} // namespace obe::debug
@@ -1,23 +1,21 @@
 #pragma once
 
 #include <Audio/AudioManager.hpp>
+#include <Bindings/Index.hpp>
 #include <Config/Config.hpp>
 #include <Debug/Logger.hpp>
 #include <Engine/ResourceManager.hpp>
 #include <Event/EventManager.hpp>
 #include <Input/InputManager.hpp>
 #include <Scene/Scene.hpp>
+#include <Script/GarbageCollector.hpp>
 #include <Script/LuaState.hpp>
 #include <System/Cursor.hpp>
+#include <System/JobPool.hpp>
 #include <System/Plugin.hpp>
 #include <System/Window.hpp>
 #include <Time/FramerateManager.hpp>
 
-namespace obe::bindings
-{
-    void index_core_bindings(sol::state_view state);
-}
-
 namespace obe::events
 {
     namespace Game
@@ -53,10 +51,13 @@ namespace obe::engine
         bool m_initialized = false;
         std::vector<std::unique_ptr<system::Plugin>> m_plugins;
         std::unique_ptr<script::LuaState> m_lua;
+        std::unique_ptr<script::GarbageCollector> m_garbage_collector;
         std::unique_ptr<scene::Scene> m_scene;
         std::unique_ptr<system::Cursor> m_cursor;
         std::unique_ptr<system::Window> m_window;
         debug::Logger::weak_type m_log;
+        // Chrome trace written when the main loop ends, empty when not capturing
+        std::string m_profiler_trace_path;
 
         // Configuration
         vili::node m_arguments;
@@ -68,6 +69,7 @@ namespace obe::engine
         std::unique_ptr<input::InputManager> m_input {};
         std::unique_ptr<time::FramerateManager> m_framerate;
         std::unique_ptr<event::EventManager> m_events;
+        std::unique_ptr<system::JobPool> m_jobs;
         event::EventNamespace* m_event_namespace;
         event::EventNamespace* m_user_event_namespace;
 
@@ -77,7 +79,8 @@ namespace obe::engine
 
         // Initialization
         void init_config();
-        void init_logger() const;
+        void init_logger();
+        void init_profiler();
         void init_script();
         void init_events();
         void init_input();
@@ -85,6 +88,7 @@ namespace obe::engine
         void init_resources();
         void init_window();
         void init_cursor();
+        void init_jobs();
         void init_plugins();
         void init_scene();
 
@@ -153,10 +157,19 @@ namespace obe::engine
          * \asproperty
          */
         system::Window& get_window() const;
+        /**
+         * \rename{GarbageCollector}
+         * \asproperty
+         */
+        script::GarbageCollector& get_garbage_collector() const;
         /**
          * \nobind
          */
         script::LuaState& get_lua_state() const;
+        /**
+         * \nobind
+         */
+        system::JobPool& get_job_pool() const;
         /**
          * \nobind
          */
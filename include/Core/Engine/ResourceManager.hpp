@@ -3,11 +3,17 @@
 #include <Event/EventGroup.hpp>
 #include <Graphics/Font.hpp>
 #include <Graphics/Texture.hpp>
+#include <Graphics/TextureAtlas.hpp>
 #include <memory>
 #include <unordered_map>
+#include <vili/node.hpp>
 
 namespace obe
 {
+    namespace animation
+    {
+        class Animator;
+    }
     namespace system
     {
         class Path;
@@ -20,6 +26,8 @@ namespace obe::engine
     using ResourceStore = std::unordered_map<std::string, T>;
     using TexturePair
         = std::pair<std::unique_ptr<graphics::Texture>, std::unique_ptr<graphics::Texture>>;
+    using TextureAtlasPair = std::pair<std::unique_ptr<graphics::TextureAtlas>,
+        std::unique_ptr<graphics::TextureAtlas>>;
     /**
      * \brief Class that manages and caches textures}
      */
@@ -29,6 +37,24 @@ namespace obe::engine
         event::EventGroupPtr e_resources;
         ResourceStore<std::shared_ptr<graphics::Font>> m_fonts;
         ResourceStore<TexturePair> m_textures;
+        // Animator definitions shared by all GameObjects using the same animator
+        ResourceStore<std::shared_ptr<const animation::Animator>> m_animators;
+
+        // Atlases (without and with anti-aliasing) and the directories packed in them
+        TextureAtlasPair m_atlases;
+        std::vector<std::string> m_atlas_directories;
+        unsigned int m_atlas_page_size = graphics::TextureAtlas::DefaultPageSize;
+        unsigned int m_atlas_max_texture_size = 256;
+        std::string m_atlas_cache;
+        // Parts returned by get_texture_part, std::nullopt for textures outside of the atlases
+        std::pair<ResourceStore<std::optional<graphics::TexturePart>>,
+            ResourceStore<std::optional<graphics::TexturePart>>>
+            m_texture_parts;
+
+        graphics::TextureAtlas& get_atlas(bool anti_aliasing);
+        [[nodiscard]] bool is_atlased(const std::string& file_path) const;
+        std::optional<graphics::TexturePart> get_atlas_texture_part(
+            const system::Path& path, bool anti_aliasing);
 
     public:
         bool default_anti_aliasing;
@@ -45,6 +71,45 @@ namespace obe::engine
          */
         const graphics::Texture& get_texture(const system::Path& path, bool anti_aliasing);
         const graphics::Texture& get_texture(const system::Path& path);
+        /**
+         * \brief Get the texture at the given path as a TexturePart, textures
+         *        from the directories configured with configure_atlas are packed
+         *        in a shared texture atlas, other ones use get_texture
+         * \param path Relative of absolute path to the texture,
+         *        it uses the obe::System::Path loading system
+         * \param anti_aliasing Uses Anti-Aliasing for the texture when first loading it
+         * \return A TexturePart pointing either in an atlas page or on the whole texture
+         */
+        graphics::TexturePart get_texture_part(const system::Path& path, bool anti_aliasing);
+        graphics::TexturePart get_texture_part(const system::Path& path);
+        /**
+         * \nobind
+         * \brief Enables texture atlases, loading the cached atlas if there is one
+         * \param config Node containing the directories to pack ("paths"), the
+         *        page size ("pageSize"), the size above which textures are not
+         *        packed ("maxTextureSize") and the directory where the atlas is
+         *        cached between launches ("cache", optional)
+         */
+        void configure_atlas(const vili::node& config);
+        /**
+         * \brief Writes the texture atlases to the cache directory given in the
+         *        configuration (does nothing if no cache directory is configured)
+         */
+        void save_atlas() const;
+        /**
+         * \nobind
+         * \brief Get the Animator at the given path.
+         *        If it's already in cache it returns the cached version.
+         *        Otherwise it loads the Animator and caches it.
+         *        The Animator is shared and must not be modified, each user
+         *        should play it through its own AnimatorState
+         * \param path Relative of absolute path to the Animator directory,
+         *        it uses the obe::System::Path loading system
+         * \param anti_aliasing Uses Anti-Aliasing for the textures of the Animator
+         * \return A pointer to the Animator stored in the cache
+         */
+        std::shared_ptr<const animation::Animator> get_animator(
+            const system::Path& path, bool anti_aliasing);
 
         void clean();
     };
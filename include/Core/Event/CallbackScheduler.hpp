@@ -21,7 +21,7 @@ namespace obe::event
         Callback m_callback;
         time::TimeUnit m_after = 0;
         time::TimeUnit m_every = 0;
-        time::TimeUnit m_start = 0;
+        time::TimeUnit m_elapsed = 0;
         unsigned int m_times = 0;
         unsigned int m_current_times = 0;
         bool m_wait = false;
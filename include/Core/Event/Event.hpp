@@ -1,10 +1,11 @@
 #pragma once
 
 #include <Debug/Logger.hpp>
+#include <Debug/Profiler.hpp>
 #include <Event/EventListener.hpp>
 #include <Event/Exceptions.hpp>
+#include <Event/ListenerSlots.hpp>
 #include <Time/TimeUtils.hpp>
-#include <map>
 
 namespace obe::event
 {
@@ -13,8 +14,7 @@ namespace obe::event
     class EventBase
     {
     private:
-        std::map<std::string, ExternalEventListener> m_listeners;
-        std::vector<std::string> m_garbage_collector;
+        ListenerSlots<ExternalEventListener> m_listeners;
 
     protected:
         std::string m_name;
@@ -32,8 +32,6 @@ namespace obe::event
             const std::string& listener_id, ListenerType&& listener, const EventType& event);
         void on_add_listener(OnListenerChange callback);
         void on_remove_listener(OnListenerChange callback);
-        bool m_garbage_lock = false;
-        void collect_garbage();
 
         friend class EventGroup;
 
@@ -66,8 +64,10 @@ namespace obe::event
          * \brief Registers a listener that will be called when the Event is triggered
          * \param id of the listener being added
          * \param listener Listener to register
+         * \return Handle of the listener
          */
-        void add_external_listener(const std::string& id, const ExternalEventListener& listener);
+        ListenerHandle add_external_listener(
+            const std::string& id, const ExternalEventListener& listener);
         /**
          * \brief Removes a Listener from the Event
          * \param id id of the Listener to unregister
@@ -82,15 +82,13 @@ namespace obe::event
     class Event : public EventBase
     {
     private:
-        std::map<std::string, CppEventListener<EventType>> m_listeners;
-        std::vector<std::string> m_garbage_collector;
+        ListenerSlots<CppEventListener<EventType>> m_listeners;
 
     protected:
         /**
          * \brief Event callbacks
          */
         void trigger(const EventType& event);
-        void collect_garbage();
 
     public:
         /**
@@ -107,13 +105,20 @@ namespace obe::event
          * \brief Registers a listener that will be called when the Event is triggered
          * \param id id of the Listener being added
          * \param listener Listener to register
+         * \return Handle of the listener, can be used to remove it
          */
-        void add_listener(const std::string& id, const CppEventListener<EventType>& listener);
+        ListenerHandle add_listener(
+            const std::string& id, const CppEventListener<EventType>& listener);
         /**
          * \brief Removes a Listener from the Event
          * \param id id of the Listener to unregister
          */
         void remove_listener(const std::string& id);
+        /**
+         * \brief Removes a Listener from the Event
+         * \param handle Handle returned by add_listener
+         */
+        void remove_listener(ListenerHandle handle);
 
         friend class EventGroup;
     };
@@ -121,27 +126,24 @@ namespace obe::event
     template <class EventType>
     void EventBase::trigger(const EventType& event)
     {
-        for (const auto& listener : m_listeners)
-        {
-            debug::Log->trace("<Event> Calling Event Listener '{}' from Event '{}'", listener.first,
-                m_identifier);
-            if (std::holds_alternative<LuaEventListener>(listener.second))
+        m_listeners.for_each(
+            [this, &event](const std::string& listener_id, const ExternalEventListener& listener)
             {
-                this->call_listener(
-                    listener.first, std::get<LuaEventListener>(listener.second), event);
-            }
-        }
+                OBE_TRACE("<Event> Calling Event Listener '{}' from Event '{}'",
+                    listener_id, m_identifier);
+                if (const auto* lua_listener = std::get_if<LuaEventListener>(&listener))
+                {
+                    OBE_PROFILE_SCOPE("LuaEventListener", listener_id);
+                    this->call_listener(listener_id, *lua_listener, event);
+                }
+            });
     }
 
     template <class EventType, class ListenerType>
     void EventBase::call_listener(
         const std::string& listener_id, ListenerType&& listener, const EventType& event)
     {
-        if (std::find(m_garbage_collector.begin(), m_garbage_collector.end(), listener_id)
-            != m_garbage_collector.end())
-        {
-            return;
-        }
+        OBE_PROFILE_SCOPE(m_identifier, listener_id);
         try
         {
             listener(event);
@@ -155,38 +157,23 @@ namespace obe::event
     template <class EventType>
     void Event<EventType>::trigger(const EventType& event)
     {
-        debug::Log->trace("<Event> Executing Event '{}'", m_identifier);
-        m_garbage_lock = true;
+        OBE_TRACE("<Event> Executing Event '{}'", m_identifier);
 
         if (m_enabled)
         {
             m_triggered = true;
 
-            for (const auto& listener : m_listeners)
-            {
-                debug::Log->trace("<Event> Calling Event Listener '{}' from Event '{}'",
-                    listener.first, m_identifier);
-
-                this->call_listener(listener.first, listener.second, event);
-            }
+            m_listeners.for_each(
+                [this, &event](const std::string& listener_id,
+                    const CppEventListener<EventType>& listener)
+                {
+                    OBE_TRACE("<Event> Calling Event Listener '{}' from Event '{}'",
+                        listener_id, m_identifier);
+                    this->call_listener(listener_id, listener, event);
+                });
             EventBase::trigger<EventType>(event);
-            this->collect_garbage();
-            EventBase::collect_garbage();
             m_triggered = false;
         }
-
-        m_garbage_lock = false;
-    }
-
-    template <class EventType>
-    void Event<EventType>::collect_garbage()
-    {
-        debug::Log->trace("EventListeners Garbage Collection for Event {}", m_identifier);
-        for (const std::string& listener_id : m_garbage_collector)
-        {
-            m_listeners.erase(listener_id);
-        }
-        m_garbage_collector.clear();
     }
 
     template <class EventType>
@@ -197,29 +184,35 @@ namespace obe::event
     }
 
     template <class EventType>
-    void Event<EventType>::add_listener(
+    ListenerHandle Event<EventType>::add_listener(
         const std::string& id, const CppEventListener<EventType>& listener)
     {
-        debug::Log->trace("<Event> Adding new listener '{}' to Event '{}'", id, m_identifier);
-        m_listeners.emplace(id, listener);
-        if (m_on_add_listener)
+        OBE_TRACE("<Event> Adding new listener '{}' to Event '{}'", id, m_identifier);
+        const bool new_listener = !m_listeners.contains(id);
+        const ListenerHandle handle = m_listeners.add(id, listener);
+        if (new_listener && m_on_add_listener)
         {
             m_on_add_listener(ListenerChangeState::Added, id);
         }
+        return handle;
     }
 
     template <class EventType>
     void Event<EventType>::remove_listener(const std::string& id)
     {
-        debug::Log->trace("<Event> Removing listener '{}' from Event '{}'", id, m_identifier);
-
-        if (m_garbage_lock)
-            m_garbage_collector.push_back(id);
-        else
-            m_listeners.erase(id);
-        if (m_on_remove_listener)
+        OBE_TRACE("<Event> Removing listener '{}' from Event '{}'", id, m_identifier);
+        if (m_listeners.remove(id) && m_on_remove_listener)
         {
             m_on_remove_listener(ListenerChangeState::Removed, id);
         }
     }
+
+    template <class EventType>
+    void Event<EventType>::remove_listener(ListenerHandle handle)
+    {
+        if (const std::optional<std::string> id = m_listeners.get_id(handle))
+        {
+            this->remove_listener(*id);
+        }
+    }
 } // namespace obe::event
@@ -19,12 +19,34 @@ private:
 public:
     enum
     {
-        value = sizeof(test<T>(0)) == sizeof(std::true_type)
+        value = decltype(test<T>(0))::value
     };
 };
 
 namespace obe::event
 {
+    /**
+     * \nobind
+     * \brief Gives a small index to each event type, EventGroup uses it to find
+     *        the Events triggered from C++ without looking up their name
+     */
+    class EventTypeIndex
+    {
+    private:
+        static std::size_t next();
+
+    public:
+        template <class EventType>
+        static std::size_t get();
+    };
+
+    template <class EventType>
+    std::size_t EventTypeIndex::get()
+    {
+        static const std::size_t index = next();
+        return index;
+    }
+
     class EventGroup;
     class EventGroupView
     {
@@ -83,8 +105,13 @@ namespace obe::event
         std::string m_name;
         std::string m_identifier;
         std::map<std::string, std::unique_ptr<EventBase>> m_events;
+        // Events added with their type's id, indexed by EventTypeIndex
+        std::vector<EventBase*> m_typed_events;
         bool m_joinable = false;
 
+        template <class EventType>
+        [[nodiscard]] Event<EventType>* find_typed_event() const;
+
     public:
         /**
          * \brief Creates a new EventGroup
@@ -195,12 +222,23 @@ namespace obe::event
         {
             name = EventType::id;
         }
-        if (!m_events.contains(event_name))
+        const auto event = m_events.find(name);
+        if (event == m_events.end())
         {
-            throw exceptions::UnknownEvent(
-                m_identifier, event_name, this->get_events_names(), EXC_INFO);
+            throw exceptions::UnknownEvent(m_identifier, name, this->get_events_names(), EXC_INFO);
         }
-        return *static_cast<Event<EventType>*>(m_events.at(name).get());
+        return *static_cast<Event<EventType>*>(event->second.get());
+    }
+
+    template <class EventType>
+    Event<EventType>* EventGroup::find_typed_event() const
+    {
+        const std::size_t type_index = EventTypeIndex::get<EventType>();
+        if (type_index < m_typed_events.size())
+        {
+            return static_cast<Event<EventType>*>(m_typed_events[type_index]);
+        }
+        return nullptr;
     }
 
     template <class EventType>
@@ -216,8 +254,20 @@ namespace obe::event
         {
             debug::Log->debug(
                 "<EventGroup> Add Event '{}' to EventGroup '{}'", event_name, m_identifier);
-            m_events.emplace(
+            const auto [event, inserted] = m_events.emplace(
                 event_name, std::make_unique<Event<EventType>>(m_identifier, event_name));
+            if constexpr (HasId<EventType>::value)
+            {
+                if (event_name == EventType::id)
+                {
+                    const std::size_t type_index = EventTypeIndex::get<EventType>();
+                    if (type_index >= m_typed_events.size())
+                    {
+                        m_typed_events.resize(type_index + 1, nullptr);
+                    }
+                    m_typed_events[type_index] = event->second.get();
+                }
+            }
         }
         else
         {
@@ -228,20 +278,30 @@ namespace obe::event
     template <class EventType>
     typename std::enable_if_t<HasId<EventType>::value> EventGroup::trigger(EventType event)
     {
-        this->trigger(EventType::id.data(), event);
+        if (Event<EventType>* typed_event = this->find_typed_event<EventType>())
+        {
+            OBE_TRACE("<EventGroup> Triggering Event '{}' from EventGroup '{}'",
+                EventType::id, m_identifier);
+            typed_event->trigger(event);
+        }
+        else
+        {
+            this->trigger(EventType::id.data(), event);
+        }
     }
 
     template <class EventType>
     void EventGroup::trigger(const std::string& event_name, EventType event)
     {
-        if (!m_events.contains(event_name))
+        const auto found_event = m_events.find(event_name);
+        if (found_event == m_events.end())
         {
             throw exceptions::UnknownEvent(
                 m_identifier, event_name, this->get_events_names(), EXC_INFO);
         }
-        debug::Log->trace(
+        OBE_TRACE(
             "<EventGroup> Triggering Event '{}' from EventGroup '{}'", event_name, m_identifier);
-        static_cast<Event<EventType>*>(m_events.at(event_name).get())->trigger(event);
+        static_cast<Event<EventType>*>(found_event->second.get())->trigger(event);
     }
 
     using EventGroupPtr = std::shared_ptr<EventGroup>;
@@ -23,8 +23,10 @@ namespace obe::event
         explicit EventManager();
         /**
          * \brief Updates the EventManager
+         * \param dt Time elapsed since the last update (in seconds), used by
+         *        the CallbackScheduler
          */
-        void update();
+        void update(time::TimeUnit dt);
         /**
          * \brief Clears the EventManager
          */
@@ -0,0 +1,277 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace obe::event
+{
+    /**
+     * \nobind
+     * \brief Handle of a listener, stays valid until the listener is removed
+     *        The generation tells apart the successive listeners stored in the
+     *        same slot so a stale handle never refers to a newer listener
+     */
+    struct ListenerHandle
+    {
+        std::size_t index = 0;
+        std::uint32_t generation = 0;
+
+        bool operator==(const ListenerHandle& other) const = default;
+    };
+
+    /**
+     * \nobind
+     * \brief Contiguous storage of the listeners of an Event
+     *        Removed listeners leave a tombstone which is reused by the next
+     *        added listener, so listeners are called in slot order : in
+     *        insertion order, except that a new listener takes the place of
+     *        the last removed one. Listeners added or removed while the slots
+     *        are being iterated only take effect once the iteration is over
+     */
+    template <class Listener>
+    class ListenerSlots
+    {
+    private:
+        struct Slot
+        {
+            std::string id;
+            std::optional<Listener> listener;
+            bool active = false;
+            std::uint32_t generation = 0;
+        };
+
+        std::vector<Slot> m_slots;
+        // Listeners added during an iteration, appended to m_slots afterwards
+        std::vector<Slot> m_pending_slots;
+        std::vector<std::size_t> m_free_slots;
+        std::vector<std::size_t> m_removed_slots;
+        std::unordered_map<std::string, ListenerHandle> m_handles;
+        unsigned int m_iterations = 0;
+
+        /**
+         * \brief Get the slot of an active listener
+         * \return nullptr if the handle is stale or out of range
+         */
+        Slot* find_slot(ListenerHandle handle);
+        [[nodiscard]] const Slot* find_slot(ListenerHandle handle) const;
+        void release_slot(std::size_t index);
+        void release_removed_slots();
+
+    public:
+        /**
+         * \brief Adds a listener, does nothing if a listener with the same id exists
+         * \param id Identifier of the listener
+         * \param listener Listener to add
+         * \return Handle of the listener
+         */
+        ListenerHandle add(const std::string& id, Listener listener);
+        /**
+         * \brief Removes a listener using its handle
+         * \return true if the listener has been removed, false if the handle is
+         *         stale (its listener has already been removed)
+         */
+        bool remove(ListenerHandle handle);
+        /**
+         * \brief Removes a listener using its identifier
+         * \return true if the listener has been removed, false otherwise
+         */
+        bool remove(const std::string& id);
+        [[nodiscard]] bool contains(const std::string& id) const;
+        /**
+         * \brief Get the identifier of an active listener
+         * \return The identifier of the listener or std::nullopt if the handle
+         *         does not refer to an active listener
+         */
+        [[nodiscard]] std::optional<std::string> get_id(ListenerHandle handle) const;
+        [[nodiscard]] std::size_t size() const;
+        /**
+         * \brief Calls function(id, listener) for each active listener
+         */
+        template <class Function>
+        void for_each(Function&& function);
+    };
+
+    template <class Listener>
+    typename ListenerSlots<Listener>::Slot* ListenerSlots<Listener>::find_slot(
+        ListenerHandle handle)
+    {
+        return const_cast<Slot*>(std::as_const(*this).find_slot(handle));
+    }
+
+    template <class Listener>
+    const typename ListenerSlots<Listener>::Slot* ListenerSlots<Listener>::find_slot(
+        ListenerHandle handle) const
+    {
+        const Slot* slot = nullptr;
+        if (handle.index < m_slots.size())
+        {
+            slot = &m_slots[handle.index];
+        }
+        else if (handle.index - m_slots.size() < m_pending_slots.size())
+        {
+            slot = &m_pending_slots[handle.index - m_slots.size()];
+        }
+        if (slot && slot->active && slot->generation == handle.generation)
+        {
+            return slot;
+        }
+        return nullptr;
+    }
+
+    template <class Listener>
+    void ListenerSlots<Listener>::release_slot(std::size_t index)
+    {
+        Slot& slot = m_slots[index];
+        slot.id.clear();
+        slot.listener.reset();
+        // Invalidates the handles of the removed listener
+        slot.generation++;
+        m_free_slots.push_back(index);
+    }
+
+    template <class Listener>
+    void ListenerSlots<Listener>::release_removed_slots()
+    {
+        for (const std::size_t index : m_removed_slots)
+        {
+            this->release_slot(index);
+        }
+        m_removed_slots.clear();
+        for (Slot& slot : m_pending_slots)
+        {
+            m_slots.push_back(std::move(slot));
+            if (!m_slots.back().active)
+            {
+                this->release_slot(m_slots.size() - 1);
+            }
+        }
+        m_pending_slots.clear();
+    }
+
+    template <class Listener>
+    ListenerHandle ListenerSlots<Listener>::add(const std::string& id, Listener listener)
+    {
+        if (const auto existing = m_handles.find(id); existing != m_handles.end())
+        {
+            return existing->second;
+        }
+        ListenerHandle handle;
+        if (m_iterations)
+        {
+            handle.index = m_slots.size() + m_pending_slots.size();
+            m_pending_slots.push_back(Slot { id, std::move(listener), true });
+        }
+        else if (!m_free_slots.empty())
+        {
+            handle.index = m_free_slots.back();
+            m_free_slots.pop_back();
+            Slot& slot = m_slots[handle.index];
+            slot.id = id;
+            slot.listener.emplace(std::move(listener));
+            slot.active = true;
+            handle.generation = slot.generation;
+        }
+        else
+        {
+            handle.index = m_slots.size();
+            m_slots.push_back(Slot { id, std::move(listener), true });
+        }
+        m_handles.emplace(id, handle);
+        return handle;
+    }
+
+    template <class Listener>
+    bool ListenerSlots<Listener>::remove(ListenerHandle handle)
+    {
+        Slot* slot = this->find_slot(handle);
+        if (!slot)
+        {
+            return false;
+        }
+        slot->active = false;
+        m_handles.erase(slot->id);
+        if (handle.index >= m_slots.size())
+        {
+            // Pending slots are released when they are appended
+            return true;
+        }
+        if (m_iterations)
+        {
+            // The listener may be running, it is only destroyed after the iteration
+            m_removed_slots.push_back(handle.index);
+        }
+        else
+        {
+            this->release_slot(handle.index);
+        }
+        return true;
+    }
+
+    template <class Listener>
+    bool ListenerSlots<Listener>::remove(const std::string& id)
+    {
+        if (const auto handle = m_handles.find(id); handle != m_handles.end())
+        {
+            return this->remove(handle->second);
+        }
+        return false;
+    }
+
+    template <class Listener>
+    bool ListenerSlots<Listener>::contains(const std::string& id) const
+    {
+        return m_handles.contains(id);
+    }
+
+    template <class Listener>
+    std::optional<std::string> ListenerSlots<Listener>::get_id(ListenerHandle handle) const
+    {
+        if (const Slot* slot = this->find_slot(handle))
+        {
+            return slot->id;
+        }
+        return std::nullopt;
+    }
+
+    template <class Listener>
+    std::size_t ListenerSlots<Listener>::size() const
+    {
+        return m_handles.size();
+    }
+
+    template <class Listener>
+    template <class Function>
+    void ListenerSlots<Listener>::for_each(Function&& function)
+    {
+        struct IterationGuard
+        {
+            ListenerSlots& slots;
+            explicit IterationGuard(ListenerSlots& slots)
+                : slots(slots)
+            {
+                slots.m_iterations++;
+            }
+            ~IterationGuard()
+            {
+                if (--slots.m_iterations == 0)
+                {
+                    slots.release_removed_slots();
+                }
+            }
+        } guard(*this);
+
+        // m_slots is not resized during the iteration so references stay valid
+        for (Slot& slot : m_slots)
+        {
+            if (slot.active)
+            {
+                function(slot.id, *slot.listener);
+            }
+        }
+    }
+} // namespace obe::event
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <vector>
+
+#include <Graphics/Renderable.hpp>
+
+namespace obe::graphics
+{
+    /**
+     * \nobind
+     * \brief Retained list of Renderables kept sorted by layer then sublayer
+     *        (back to front), Renderables added to the list notify it when their
+     *        layer or sublayer change so only those are moved
+     */
+    class RenderList
+    {
+    private:
+        std::vector<Renderable*> m_renderables;
+        std::vector<Renderable*> m_moved_renderables;
+
+        friend class Renderable;
+        void mark_as_moved(Renderable* renderable);
+        /**
+         * \brief Moves the Renderables whose layer or sublayer changed to their
+         *        new position in the list
+         */
+        void apply_moves();
+
+    public:
+        RenderList() = default;
+        RenderList(const RenderList&) = delete;
+        RenderList& operator=(const RenderList&) = delete;
+        ~RenderList();
+
+        /**
+         * \brief Inserts a Renderable at its position in the list, Renderables
+         *        sharing the same layer and sublayer are drawn in insertion order
+         * \param renderable Renderable to add, it is moved from its previous
+         *        RenderList if it had one
+         */
+        void add(Renderable* renderable);
+        /**
+         * \brief Removes a Renderable from the list
+         * \param renderable Renderable to remove
+         */
+        void remove(Renderable* renderable);
+        /**
+         * \brief Removes all the Renderables from the list
+         */
+        void clear();
+        /**
+         * \brief Sorts the whole list again
+         */
+        void sort();
+        [[nodiscard]] std::size_t size() const;
+        /**
+         * \brief Gets the Renderables sorted in drawing order
+         * \return A std::vector containing the Renderables, from the back to the front
+         */
+        [[nodiscard]] const std::vector<Renderable*>& get_renderables();
+    };
+} // namespace obe::graphics
@@ -10,8 +10,18 @@ namespace obe::scene
 
 namespace obe::graphics
 {
+    class RenderList;
+    class SpriteBatch;
+
     class Renderable
     {
+    private:
+        RenderList* m_render_list = nullptr;
+        bool m_moved = false;
+
+        friend class RenderList;
+        void notify_layer_change();
+
     protected:
         int32_t m_layer = 1;
         int32_t m_sublayer = 1;
@@ -20,7 +30,16 @@ namespace obe::graphics
     public:
         Renderable() = default;
         Renderable(int32_t layer, int32_t sublayer);
-        virtual ~Renderable() = default;
+        /**
+         * \brief Copies the Renderable, the copy does not belong to any RenderList
+         */
+        Renderable(const Renderable& other);
+        /**
+         * \brief Copies the layers and visibility of another Renderable, the
+         *        RenderList the Renderable belongs to is kept
+         */
+        Renderable& operator=(const Renderable& other);
+        virtual ~Renderable();
 
         /**
          * \brief Get the layer of the Renderable
@@ -61,6 +80,24 @@ namespace obe::graphics
         void show();
         void hide();
 
+        /**
+         * \brief Checks if the Renderable can cover a part of the Camera view,
+         *        the Scene does not draw the Renderables outside of the view
+         * \param camera Camera the Renderable is going to be drawn with
+         * \return false if the Renderable is entirely outside of the view, true
+         *         otherwise (Renderables that can not tell are always in view)
+         */
+        [[nodiscard]] virtual bool is_in_view(const scene::Camera& camera) const;
+
         virtual void draw(RenderTarget& surface, const scene::Camera& camera) = 0;
+        /**
+         * \nobind
+         * \brief Draws the Renderable through a SpriteBatch, Renderables that can
+         *        not be batched flush the SpriteBatch then draw themselves
+         * \param batch SpriteBatch holding the quads drawn before this Renderable
+         * \param surface RenderTarget where to draw the Renderable
+         * \param camera Camera used to draw the Renderable
+         */
+        virtual void draw(SpriteBatch& batch, RenderTarget& surface, const scene::Camera& camera);
     };
 } // namespace obe::graphics
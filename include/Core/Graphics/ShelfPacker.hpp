@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+namespace obe::graphics
+{
+    /**
+     * \nobind
+     * \brief Places rectangles in square pages, rectangles are put on shelves
+     *        (rows of rectangles) and new pages are added when the existing
+     *        ones are full
+     */
+    class ShelfPacker
+    {
+    public:
+        struct Shelf
+        {
+            unsigned int y = 0;
+            unsigned int height = 0;
+            unsigned int width_used = 0;
+        };
+
+        struct Placement
+        {
+            std::size_t page = 0;
+            unsigned int x = 0;
+            unsigned int y = 0;
+        };
+
+    private:
+        struct Page
+        {
+            std::vector<Shelf> shelves;
+            unsigned int height_used = 0;
+        };
+
+        unsigned int m_page_size;
+        std::vector<Page> m_pages;
+
+    public:
+        /**
+         * \brief Creates a ShelfPacker without any page
+         * \param page_size Width and height of the pages
+         */
+        explicit ShelfPacker(unsigned int page_size);
+
+        /**
+         * \brief Finds a place for a rectangle, shelves a bit taller than the
+         *        rectangle are reused to limit the amount of shelves
+         * \param width Width of the rectangle
+         * \param height Height of the rectangle
+         * \return The place of the rectangle or std::nullopt if it is bigger than a page
+         */
+        std::optional<Placement> allocate(unsigned int width, unsigned int height);
+        /**
+         * \brief Adds a page with the given shelves, used to restore a saved state
+         * \param shelves Shelves of the page, from the top to the bottom
+         * \return false if the shelves do not fit in a page, true otherwise
+         */
+        bool add_page(std::vector<Shelf> shelves);
+        /**
+         * \brief Removes all the pages
+         */
+        void clear();
+        [[nodiscard]] const std::vector<Shelf>& get_shelves(std::size_t page) const;
+        [[nodiscard]] std::size_t get_pages_amount() const;
+        [[nodiscard]] unsigned int get_page_size() const;
+    };
+} // namespace obe::graphics
@@ -6,6 +6,7 @@
 #include <Graphics/PositionTransformers.hpp>
 #include <Graphics/Renderable.hpp>
 #include <Graphics/Shader.hpp>
+#include <Graphics/SpriteBatch.hpp>
 #include <Scene/Camera.hpp>
 #include <Transform/Rect.hpp>
 #include <Transform/Referential.hpp>
@@ -39,6 +40,10 @@ namespace obe::graphics
         bool m_vertical_flip = false;
 
         void reset_unit(transform::Units unit) override;
+        /**
+         * \brief Moves the vertices of the Sprite to their position on the screen
+         */
+        void update_vertices(RenderTarget& surface, const scene::Camera& camera);
         void refresh_vector_texture(
             const transform::UnitVector& surface_size, const std::array<sf::Vertex, 4>& vertices);
 
@@ -206,7 +211,19 @@ namespace obe::graphics
          */
         void use_texture_size();
 
+        /**
+         * \brief Checks if the bounding box of the Sprite, once moved by its
+         *        PositionTransformer (parallax included), overlaps the screen
+         * \param camera Camera the Sprite is going to be drawn with
+         * \return false if the Sprite is entirely outside of the screen, true otherwise
+         */
+        [[nodiscard]] bool is_in_view(const scene::Camera& camera) const override;
         void draw(RenderTarget& surface, const scene::Camera& camera) override;
+        /**
+         * \brief Adds the quad of the Sprite to the SpriteBatch instead of drawing it
+         */
+        void draw(
+            SpriteBatch& batch, RenderTarget& surface, const scene::Camera& camera) override;
         void attach_resource_manager(engine::ResourceManager& resources) override;
         [[nodiscard]] std::string_view type() const override;
 
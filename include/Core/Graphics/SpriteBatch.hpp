@@ -0,0 +1,70 @@
+#pragma once
+
+#include <array>
+#include <vector>
+
+#include <Graphics/RenderTarget.hpp>
+
+namespace obe::graphics
+{
+    /**
+     * \nobind
+     * \brief Accumulates consecutive quads sharing the same texture and shader
+     *        in a single vertex buffer drawn with one draw call, every Sprite
+     *        uses the default blend mode so it is not part of the batch state
+     */
+    class SpriteBatch
+    {
+    private:
+        std::vector<sf::Vertex> m_vertices;
+        const sf::Texture* m_texture = nullptr;
+        const sf::Shader* m_shader = nullptr;
+        std::size_t m_batches = 0;
+        std::size_t m_quads = 0;
+        std::size_t m_unbatched_draws = 0;
+
+    public:
+        /**
+         * \brief Adds a quad to the current batch, the batch is flushed first if
+         *        the texture or the shader differ from the ones of the batch
+         * \param surface RenderTarget where to draw the pending batch if needed
+         * \param texture Texture used by the quad
+         * \param shader Shader used by the quad (can be nullptr)
+         * \param quad Vertices of the quad in triangle strip order
+         */
+        void add(RenderTarget& surface, const sf::Texture* texture, const sf::Shader* shader,
+            const std::array<sf::Vertex, 4>& quad);
+        /**
+         * \brief Draws the pending quads, must be called before drawing anything
+         *        that does not go through the SpriteBatch
+         * \param surface RenderTarget where to draw the pending quads
+         */
+        void flush(RenderTarget& surface);
+        /**
+         * \brief Draws the pending quads before something is drawn without going
+         *        through the SpriteBatch and counts it as a draw call
+         * \param surface RenderTarget where to draw the pending quads
+         */
+        void flush_for_unbatched_draw(RenderTarget& surface);
+        /**
+         * \brief Resets the amount of batches, quads and unbatched draws
+         */
+        void reset_statistics();
+        /**
+         * \brief Get the amount of batches drawn since the last reset
+         * \return The amount of draw calls issued by the SpriteBatch
+         */
+        [[nodiscard]] std::size_t get_batches_amount() const;
+        /**
+         * \brief Get the amount of quads drawn since the last reset
+         * \return The amount of quads that went through the SpriteBatch
+         */
+        [[nodiscard]] std::size_t get_quads_amount() const;
+        /**
+         * \brief Get the amount of draws done outside of the SpriteBatch since
+         *        the last reset
+         * \return The amount of calls to flush_for_unbatched_draw
+         */
+        [[nodiscard]] std::size_t get_unbatched_draws_amount() const;
+    };
+} // namespace obe::graphics
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <SFML/Graphics/Image.hpp>
+
+#include <Graphics/ShelfPacker.hpp>
+#include <Graphics/Texture.hpp>
+
+namespace obe::graphics
+{
+    /**
+     * \nobind
+     * \brief Packs images in shared texture pages so Sprites using them can be
+     *        drawn with the same texture, images are placed on shelves (rows of
+     *        images) and surrounded by a copy of their border to avoid bleeding
+     */
+    class TextureAtlas
+    {
+    public:
+        static constexpr unsigned int DefaultPageSize = 2048;
+
+    private:
+        struct Entry
+        {
+            std::size_t page = 0;
+            unsigned int x = 0;
+            unsigned int y = 0;
+            unsigned int width = 0;
+            unsigned int height = 0;
+            std::string stamp;
+        };
+
+        bool m_anti_aliasing;
+        ShelfPacker m_packer;
+        // Stored behind pointers as TexturePart references the Texture
+        std::vector<std::unique_ptr<Texture>> m_pages;
+        std::unordered_map<std::string, Entry> m_entries;
+
+        Texture& make_page();
+        bool allocate(unsigned int width, unsigned int height, Entry& entry);
+        [[nodiscard]] TexturePart make_texture_part(const Entry& entry) const;
+        void compact();
+
+    public:
+        /**
+         * \brief Creates an empty TextureAtlas
+         * \param page_size Width and height of the texture pages
+         * \param anti_aliasing Smoothing applied to the texture pages
+         */
+        explicit TextureAtlas(unsigned int page_size = DefaultPageSize, bool anti_aliasing = false);
+
+        /**
+         * \brief Get the part of the atlas where an image has been packed
+         * \param key Key the image has been added with
+         * \return The TexturePart of the image or std::nullopt if the image is not
+         *         in the atlas
+         */
+        [[nodiscard]] std::optional<TexturePart> get(const std::string& key) const;
+        /**
+         * \brief Packs an image in the atlas, a new page is created if the image
+         *        does not fit in the existing ones
+         * \param key Key used to retrieve the image later
+         * \param image Image to pack
+         * \param stamp Identifies the version of the image (for instance the size
+         *        and modification time of its file)
+         * \return The TexturePart of the image or std::nullopt if the image is too
+         *         big to fit in a page
+         */
+        std::optional<TexturePart> add(
+            const std::string& key, const sf::Image& image, const std::string& stamp = "");
+        /**
+         * \brief Removes the images for which is_up_to_date returns false and
+         *        packs the remaining ones again so the pages do not keep the
+         *        space of the removed images, every TexturePart of the atlas is
+         *        invalidated if an image is removed
+         * \param is_up_to_date Called with the key and the stamp of every image
+         * \return The amount of images removed
+         */
+        std::size_t remove_outdated(
+            const std::function<bool(const std::string&, const std::string&)>& is_up_to_date);
+        [[nodiscard]] std::size_t get_pages_amount() const;
+        [[nodiscard]] unsigned int get_page_size() const;
+
+        /**
+         * \brief Writes the pages (as png images) and the location of every image
+         *        in the given directory
+         * \param directory Directory where to write the atlas, created if needed
+         * \return true if the atlas has been written, false otherwise
+         */
+        bool save(const std::string& directory) const;
+        /**
+         * \brief Loads an atlas written by save, replacing the current content so
+         *        it must be called before any TexturePart of the atlas is used
+         * \param directory Directory the atlas has been written to
+         * \return true if the atlas has been loaded, false if there was no atlas
+         *         (or a different page size) in the directory
+         */
+        bool load(const std::string& directory);
+    };
+} // namespace obe::graphics
@@ -5,7 +5,9 @@
 #include <Engine/ResourceManager.hpp>
 #include <Event/EventGroup.hpp>
 #include <Event/EventNamespace.hpp>
+#include <Graphics/RenderList.hpp>
 #include <Graphics/Sprite.hpp>
+#include <Graphics/SpriteBatch.hpp>
 #include <Scene/Camera.hpp>
 #include <Scene/SceneNode.hpp>
 #include <Script/GameObject.hpp>
@@ -43,6 +45,40 @@ namespace obe::scene
         bool sprites = true;
         bool collisions = false;
         bool scene_nodes = false;
+        /**
+         * \brief Skips the Renderables that are outside of the Camera view
+         */
+        bool culling = true;
+        /**
+         * \brief Draws consecutive Sprites sharing the same texture and shader
+         *        with a single draw call, disabled until it is checked against
+         *        the unbatched output on every backend
+         */
+        bool batching = false;
+    };
+
+    /**
+     * \brief Counters of the last Scene::draw call
+     */
+    struct SceneRenderStatistics
+    {
+        /**
+         * \brief Amount of Renderables that have been drawn
+         */
+        std::size_t drawn = 0;
+        /**
+         * \brief Amount of visible Renderables skipped because outside of the view
+         */
+        std::size_t culled = 0;
+        /**
+         * \brief Amount of draw calls used to draw the batched Sprites
+         */
+        std::size_t batches = 0;
+        /**
+         * \brief Amount of draw calls issued for the Renderables, Renderables drawn
+         *        without batching count as one draw call each
+         */
+        std::size_t draw_calls = 0;
     };
 
     /**
@@ -78,6 +114,8 @@ namespace obe::scene
 
         std::string m_level_file_name;
         SceneRenderOptions m_render_options;
+        SceneRenderStatistics m_render_statistics;
+        graphics::SpriteBatch m_sprite_batch;
         OnSceneLoadCallback m_on_load_callback;
         event::EventGroupPtr e_scene;
         sol::state_view m_lua;
@@ -85,7 +123,7 @@ namespace obe::scene
         std::unordered_map<std::string, component::ComponentBase*> m_components;
 
         bool m_sort_renderables = true;
-        std::vector<graphics::Renderable*> m_render_cache;
+        graphics::RenderList m_render_list;
         void _reorganize_layers();
         void _rebuild_ids();
 
@@ -132,8 +170,9 @@ namespace obe::scene
         void set_future_load(const vili::node& data);
         /**
          * \brief Updates all elements in the Scene
+         * \param dt Time elapsed since the last update (in seconds)
          */
-        void update();
+        void update(time::TimeUnit dt);
         /**
          * \brief Draws all elements of the Scene on the screen
          */
@@ -202,7 +241,9 @@ namespace obe::scene
 
         // Sprites
         /**
-         * \brief Reorganize all the Sprite (by layer and sublayer)
+         * \brief Rebuilds the whole render list at the next draw, this is not
+         *        needed when a Sprite changes layer or sublayer as the render
+         *        list already moves it
          */
         void reorganize_layers();
         /**
@@ -326,6 +367,12 @@ namespace obe::scene
         const tiles::TileScene& get_tiles() const;
         SceneRenderOptions get_render_options() const;
         void set_render_options(SceneRenderOptions options);
+        /**
+         * \brief Get the counters of the last draw of the Scene
+         * \return A SceneRenderStatistics containing the amount of Renderables
+         *         drawn and culled and the amount of draw calls
+         */
+        [[nodiscard]] SceneRenderStatistics get_render_statistics() const;
 
         // Components
         component::ComponentBase* get_component(const std::string& id) const;
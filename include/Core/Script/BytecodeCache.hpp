@@ -0,0 +1,78 @@
+#pragma once
+
+#include <string>
+#include <unordered_map>
+
+#include <sol/sol.hpp>
+
+namespace obe::script
+{
+    /**
+     * \brief Keeps the compiled bytecode of Lua scripts in memory and, when a
+     *        directory is set, on disk so the scripts are not parsed again on
+     *        the next launch
+     *        Cached files are named after a hash of the script path and one of
+     *        its contents, only the bytecode of the last version of each script
+     *        is kept. A cache built before shipping stays valid as long as the
+     *        scripts are loaded with the same relative paths
+     */
+    class BytecodeCache
+    {
+    private:
+        struct Entry
+        {
+            // Size and modification time of the script when it was cached
+            std::string stamp;
+            std::string bytecode;
+        };
+        std::unordered_map<std::string, Entry> m_entries;
+        std::string m_directory;
+
+        [[nodiscard]] std::string get_cache_file_path(
+            const std::string& path, const std::string& source) const;
+
+    public:
+        /**
+         * \brief Sets the directory where the bytecode is stored, an empty path
+         *        only keeps the bytecode in memory
+         */
+        void set_directory(const std::string& directory);
+        [[nodiscard]] std::string get_directory() const;
+        /**
+         * \brief Loads a script file as a function without running it, the
+         *        bytecode is reused when the script did not change
+         * \param lua Lua state in which the function is loaded
+         * \param file_path Path of the script file
+         */
+        sol::load_result load_file(sol::state_view lua, const std::string& file_path);
+        /**
+         * \brief Compiles a script file and writes its bytecode in the cache directory
+         * \return true if the bytecode is in the cache directory, false if no
+         *         directory is set or if the script can't be compiled
+         */
+        bool precompile(sol::state_view lua, const std::string& path);
+        /**
+         * \brief Forgets the bytecode kept in memory, files on disk are kept
+         */
+        void clear();
+    };
+
+    /**
+     * \brief Cache used to load every script of the Engine
+     */
+    extern BytecodeCache ScriptCache;
+
+    /**
+     * \nobind
+     * \brief Runs a script file using the ScriptCache
+     * \throw InvalidScript if the script can't be compiled or raises an error
+     */
+    void run_script_file(sol::state_view lua, const std::string& path);
+    /**
+     * \nobind
+     * \brief Runs a script file in an environment using the ScriptCache
+     * \throw InvalidScript if the script can't be compiled or raises an error
+     */
+    void run_script_file(
+        sol::state_view lua, const std::string& path, const sol::environment& environment);
+} // namespace obe::script
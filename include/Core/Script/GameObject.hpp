@@ -62,7 +62,9 @@ namespace obe::script
     {
     private:
         bool m_permanent = false;
-        std::unique_ptr<animation::Animator> m_animator;
+        // The Animator played by the AnimatorState is shared between GameObjects of
+        // the same type, only the AnimatorState belongs to the GameObject
+        std::unique_ptr<animation::AnimatorState> m_animator_state;
         graphics::Sprite* m_sprite = nullptr;
         collision::ColliderComponent* m_collider = nullptr;
         scene::SceneNode m_object_node;
@@ -138,9 +140,10 @@ namespace obe::script
          * \asproperty
          * \brief Gets the Animator Component of the GameObject (Raises
          *        ObEngine.Script.GameObject.NoAnimator if no Animator Component)
-         * \return A pointer to the Animator Component of the GameObject
+         * \return A reference to the AnimatorState of the GameObject, the
+         *         Animator it plays is shared with other GameObjects
          */
-        [[nodiscard]] animation::Animator& get_animator() const;
+        [[nodiscard]] animation::AnimatorState& get_animator() const;
         /**
          * \rename{Collider}
          * \asproperty
@@ -181,8 +184,9 @@ namespace obe::script
             scene::Scene& scene, vili::node& obj, engine::ResourceManager* resources = nullptr);
         /**
          * \brief Updates the GameObject
+         * \param dt Time elapsed since the last update (in seconds)
          */
-        void update();
+        void update(time::TimeUnit dt);
         /**
          * \rename{destroy}
          * \brief Deletes the GameObject
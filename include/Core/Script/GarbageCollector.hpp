@@ -0,0 +1,143 @@
+#pragma once
+
+#include <cstddef>
+
+#include <sol/sol.hpp>
+#include <vili/node.hpp>
+
+#include <Time/TimeUtils.hpp>
+
+namespace obe::script
+{
+    /**
+     * \brief Statistics of the collections done by the GarbageCollector
+     */
+    struct GarbageCollectorStatistics
+    {
+        /**
+         * \brief Amount of incremental steps done
+         */
+        std::size_t steps = 0;
+        /**
+         * \brief Amount of collection cycles completed
+         */
+        std::size_t cycles = 0;
+        /**
+         * \brief Amount of frames in which the collector ran without slack
+         *        because the heap grew past the pause threshold
+         */
+        std::size_t forced_frames = 0;
+        /**
+         * \brief Amount of full collections done because the heap grew past
+         *        the limit
+         */
+        std::size_t full_collections = 0;
+        /**
+         * \brief Time spent collecting during the last frame
+         */
+        time::TimeUnit last_frame_pause = 0;
+        /**
+         * \brief Longest time spent collecting in a single frame
+         */
+        time::TimeUnit max_frame_pause = 0;
+        /**
+         * \brief Total time spent collecting
+         */
+        time::TimeUnit total_pause = 0;
+    };
+
+    /**
+     * \brief Drives the Lua garbage collector from the main loop instead of
+     *        letting allocations trigger collections in the middle of a frame
+     *        Incremental steps are done in the slack before the next frame
+     *        within a per-frame time budget, the collector only runs without
+     *        slack when the heap grows past the pause threshold.
+     *        A full collection is done, whatever the budget, as soon as the
+     *        heap grows past the limit, which bounds the heap when scripts
+     *        allocate faster than the budget allows to collect (when loading
+     *        a scene for instance)
+     */
+    class GarbageCollector
+    {
+    private:
+        lua_State* m_lua;
+        bool m_enabled = false;
+        time::TimeUnit m_budget = 1 * time::milliseconds;
+        int m_step_size = 64;
+        int m_pause = 200;
+        int m_limit = 400;
+        // Mode of the Lua collector before it was enabled, restored when disabled
+        int m_previous_mode = LUA_GCINC;
+        bool m_cycle_running = false;
+        std::size_t m_heap_after_cycle = 0;
+        time::TimeUnit m_frame_pause = 0;
+        GarbageCollectorStatistics m_statistics;
+
+        void collect(time::TimeUnit budget);
+        /**
+         * \brief Does a full collection if the heap grew past the limit
+         */
+        void collect_past_limit();
+
+    public:
+        /**
+         * \nobind
+         */
+        explicit GarbageCollector(sol::state_view lua);
+        /**
+         * \brief Configures the GarbageCollector from a vili node
+         *        (enabled, budget in milliseconds, stepSize in KB, pause and
+         *        limit in percents of the heap size after the last cycle)
+         */
+        void configure(const vili::node& config);
+        /**
+         * \brief Stops the automatic collections of Lua and switches it to
+         *        incremental mode when enabled, restarts them in their
+         *        previous mode otherwise
+         */
+        void set_enabled(bool enabled);
+        [[nodiscard]] bool is_enabled() const;
+        /**
+         * \brief Sets the maximum time spent collecting in a frame
+         */
+        void set_budget(time::TimeUnit budget);
+        [[nodiscard]] time::TimeUnit get_budget() const;
+        /**
+         * \brief Sets the amount of work done by each step, in KB
+         */
+        void set_step_size(int step_size);
+        [[nodiscard]] int get_step_size() const;
+        /**
+         * \brief Sets the heap growth, in percents of the heap size after the
+         *        last cycle, from which the collector runs even without slack
+         */
+        void set_pause(int pause);
+        [[nodiscard]] int get_pause() const;
+        /**
+         * \brief Sets the heap growth, in percents of the heap size after the
+         *        last cycle, from which a full collection is done regardless
+         *        of the budget, never lower than the pause
+         */
+        void set_limit(int limit);
+        [[nodiscard]] int get_limit() const;
+        /**
+         * \brief Runs collection steps while the frame budget and the time
+         *        left before the next frame allow it, can be called several
+         *        times per frame
+         * \param time_left Time left before the next frame
+         */
+        void collect_in_slack(time::TimeUnit time_left);
+        /**
+         * \brief Ends the frame, runs collection steps within the remaining
+         *        budget if the heap grew past the pause threshold, or a full
+         *        collection if it grew past the limit
+         */
+        void end_frame();
+        /**
+         * \brief Get the size of the Lua heap in KB
+         */
+        [[nodiscard]] std::size_t get_heap_size() const;
+        [[nodiscard]] const GarbageCollectorStatistics& get_statistics() const;
+        void reset_statistics();
+    };
+} // namespace obe::script
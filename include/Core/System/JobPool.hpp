@@ -0,0 +1,91 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace obe::system
+{
+    /**
+     * \nobind
+     * \brief A small work-stealing thread pool, each worker owns a queue of jobs
+     *        and steals from the other workers' queues once its own is empty
+     */
+    class JobPool
+    {
+    public:
+        using Job = std::function<void()>;
+        /**
+         * \brief Job called with a [begin, end) range of indexes by parallel_for
+         */
+        using RangeJob = std::function<void(std::size_t begin, std::size_t end)>;
+
+    private:
+        struct JobQueue
+        {
+            std::mutex mutex;
+            std::deque<Job> jobs;
+        };
+
+        std::vector<std::unique_ptr<JobQueue>> m_queues;
+        std::vector<std::thread> m_workers;
+        std::atomic<std::size_t> m_pending = 0;
+        std::atomic<std::size_t> m_next_queue = 0;
+        std::mutex m_sleep_mutex;
+        std::condition_variable m_wake;
+        bool m_stop = false;
+
+        void push(Job job);
+        bool pop(std::size_t queue_index, Job& job);
+        bool steal(std::size_t thief_index, Job& job);
+        void worker_loop(std::size_t worker_index);
+
+    protected:
+        /**
+         * \brief Executes one pending job (own queue first, then stolen) if any
+         * \return true if a job has been executed, false if no job was pending
+         */
+        bool run_pending_job();
+
+    public:
+        /**
+         * \brief Creates the JobPool and starts its workers
+         * \param workers_amount Amount of worker threads, 0 <DefaultArg> uses one
+         *        worker per hardware thread minus the calling one
+         */
+        explicit JobPool(std::size_t workers_amount = 0);
+        JobPool(const JobPool&) = delete;
+        JobPool& operator=(const JobPool&) = delete;
+        /**
+         * \brief Waits for the running jobs, drops the pending ones and joins the workers
+         */
+        ~JobPool();
+
+        /**
+         * \brief Get the amount of worker threads of the JobPool
+         * \return The amount of worker threads (the calling thread is not counted)
+         */
+        [[nodiscard]] std::size_t get_workers_amount() const;
+        /**
+         * \brief Queues a job that will be executed by one of the workers, jobs
+         *        submitted from a worker are queued on that worker first
+         * \param job Job to execute, it is run immediately if the JobPool has no worker
+         */
+        void submit(Job job);
+        /**
+         * \brief Splits [0, size) in ranges of at most grain indexes and runs the job
+         *        on each range, the calling thread takes part in the work and the
+         *        function returns once every range has been processed
+         * \param size Amount of indexes to process
+         * \param grain Maximum amount of indexes given to a single call of job
+         * \param job Job to call for each range, ranges always start at a multiple
+         *        of grain so (begin / grain) can be used as a stable chunk index
+         */
+        void parallel_for(std::size_t size, std::size_t grain, const RangeJob& job);
+    };
+} // namespace obe::system
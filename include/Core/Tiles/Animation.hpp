@@ -9,26 +9,50 @@ namespace obe::tiles
 {
     class TileLayer;
 
+    /**
+     * \brief Animation shared by all the tiles starting with its first frame
+     *        Changing frame only updates the shared frame index, the TileLayers
+     *        update the quads of their visible tiles when they are drawn
+     */
     class AnimatedTile
     {
     private:
         const Tileset& m_tileset;
-        std::vector<std::pair<sf::Vertex*, TileInfo>> m_quads;
         size_t m_index = 0;
-        time::TimeUnit m_clock;
+        time::TimeUnit m_clock = 0;
         std::vector<time::TimeUnit> m_sleeps;
+        time::TimeUnit m_duration = 0;
         std::vector<uint32_t> m_tile_ids;
         bool m_started = false;
 
     public:
         AnimatedTile(const Tileset& tileset, std::vector<uint32_t> tile_ids,
             std::vector<time::TimeUnit> sleeps);
-        void attach_quad(sf::Vertex* quad, TileInfo tile_info = TileInfo {});
-        void detach_quad(sf::Vertex* quad);
         void start();
         void stop();
         [[nodiscard]] uint32_t get_id() const;
-        void update();
+        /**
+         * \brief Gets the index of the current frame of the animation
+         */
+        [[nodiscard]] std::size_t get_frame_index() const;
+        /**
+         * \brief Gets the id of the tile displayed by the current frame
+         */
+        [[nodiscard]] uint32_t get_current_tile_id() const;
+        /**
+         * \brief Sets the texture coordinates of a quad to the current frame
+         * \param quad Pointer to the first of the four vertices of the quad
+         * \param tile_info Flip flags of the tile, combined with the ones of
+         *        the frame
+         * \nobind
+         */
+        void update_quad(sf::Vertex* quad, TileInfo tile_info = TileInfo {}) const;
+        /**
+         * \brief Advances the animation, a large delta time skips as many
+         *        frames as it covers
+         * \param dt Time elapsed since the last update (in seconds)
+         */
+        void update(time::TimeUnit dt);
     };
 
     using AnimatedTiles = std::vector<AnimatedTile*>;
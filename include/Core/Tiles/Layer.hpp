@@ -2,28 +2,105 @@
 
 #include <Collision/ColliderComponent.hpp>
 #include <Graphics/Renderable.hpp>
+#include <SFML/Graphics/Rect.hpp>
 #include <SFML/Graphics/VertexArray.hpp>
-#include <sfe/SpannableVertexArray.hpp>
+#include <Tiles/Tile.hpp>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace obe::tiles
 {
+    class AnimatedTile;
     class TileScene;
 
+    /**
+     * \brief Quads of a chunk showing the same AnimatedTile
+     * \nobind
+     */
+    struct AnimatedTileQuads
+    {
+        AnimatedTile* animation = nullptr;
+        /**
+         * \brief First tile id of the tileset of the VertexArray holding the quads
+         */
+        uint32_t tileset = 0;
+        /**
+         * \brief Frame of the animation currently shown by the quads
+         */
+        std::size_t frame_index = 0;
+        /**
+         * \brief Index of the first vertex of each quad with the flip flags
+         *        of its tile
+         */
+        std::vector<std::pair<std::size_t, TileInfo>> quads;
+    };
+
+    /**
+     * \brief Square part of a TileLayer with its own vertices
+     * \nobind
+     */
+    struct TileChunk
+    {
+        /**
+         * \brief Horizontal position of the chunk (in chunks)
+         */
+        uint32_t x = 0;
+        /**
+         * \brief Vertical position of the chunk (in chunks)
+         */
+        uint32_t y = 0;
+        /**
+         * \brief Whether the vertices of the chunk are built
+         */
+        bool loaded = false;
+        /**
+         * \brief Area covered by the vertices of the chunk (in pixels)
+         */
+        sf::FloatRect bounds;
+        /**
+         * \brief Quads of the non-empty tiles of the chunk, only the tilesets
+         *        used in the chunk get a VertexArray
+         */
+        std::unordered_map<uint32_t, sf::VertexArray> vertices_by_tileset;
+        /**
+         * \brief Animated quads of the chunk, updated when the chunk is drawn
+         */
+        std::vector<AnimatedTileQuads> animations;
+    };
+
+    /**
+     * \brief Collider shared by a rectangle of adjacent solid tiles
+     * \nobind
+     */
+    struct MergedTileCollider
+    {
+        /**
+         * \brief Horizontal position of the first tile of the rectangle
+         */
+        uint32_t x = 0;
+        /**
+         * \brief Vertical position of the first tile of the rectangle
+         */
+        uint32_t y = 0;
+        /**
+         * \brief Width of the rectangle (in tiles)
+         */
+        uint32_t width = 0;
+        /**
+         * \brief Height of the rectangle (in tiles)
+         */
+        uint32_t height = 0;
+        collision::ColliderComponent* collider = nullptr;
+    };
+
     class TileLayer : public graphics::Renderable
     {
     private:
-        // instead of using x + y * m_width flat index system
-        // m_positions and m_sublayers_by_tileset are using the
-        // y + x * m_height index system
-        // since layers are often more wide than high, this allows us
-        // to gain more performance by applying a span on the VertexArray
-        std::unordered_map<uint32_t, sf::Vertex*> m_positions;
-        std::unordered_map<uint32_t, sfe::SpannableVertexArray> m_sublayers_by_tileset;
-
         const TileScene& m_scene;
-        std::unordered_map<uint32_t, collision::ColliderComponent*> m_colliders;
+        std::unordered_map<uint32_t, std::vector<collision::ColliderComponent*>> m_colliders;
+        std::vector<MergedTileCollider> m_merged_colliders;
 
         std::string m_id;
         uint32_t m_x;
@@ -34,10 +111,26 @@ namespace obe::tiles
         double m_opacity = 1.0;
         std::vector<uint32_t> m_data;
 
+        uint32_t m_chunk_size = 0;
+        uint32_t m_chunks_columns = 0;
+        std::vector<TileChunk> m_chunks;
+
         void build_tile(uint32_t x, uint32_t y, uint32_t tile_id);
         void clear_tile(uint32_t x, uint32_t y);
-        void update_quad(sf::Vertex* quad, uint32_t tile_id) const;
-        static void clear_quad(sf::Vertex* quad);
+        void clear_tiles_colliders();
+        void merge_colliders(uint32_t first_x, uint32_t first_y, uint32_t last_x, uint32_t last_y);
+        void update_merged_colliders(uint32_t x, uint32_t y);
+        void clear_merged_colliders();
+        void build_quad(sf::Vertex* quad, uint32_t x, uint32_t y, uint32_t tile_id) const;
+        [[nodiscard]] sf::FloatRect get_chunk_area(const TileChunk& chunk) const;
+        void load_chunk(TileChunk& chunk);
+        void unload_chunk(TileChunk& chunk);
+        [[nodiscard]] sf::Transform get_camera_transform(const scene::Camera& camera) const;
+        void update_streamed_chunks(const sf::FloatRect& visible_area);
+        void update_visible_chunks(const sf::FloatRect& visible_area);
+        [[nodiscard]] bool is_chunk_drawn(
+            const TileChunk& chunk, const sf::FloatRect& visible_area) const;
+        static void animate_chunk(TileChunk& chunk);
 
     public:
         TileLayer(const TileScene& scene, const std::string& id, int32_t layer, int32_t sublayer, uint32_t x,
@@ -45,13 +138,43 @@ namespace obe::tiles
 
         [[nodiscard]] std::string get_id() const;
 
+        /**
+         * \brief Creates the colliders and GameObjects of the tiles and splits
+         *        the TileLayer in chunks, the chunks are built right away unless
+         *        the TileScene streams them
+         *        Adjacent solid tiles share a collider when the TileScene
+         *        merges colliders
+         */
         void build();
         /**
-         * \brief Draws all elements of the TileLayer on the screen
+         * \brief Draws the chunks of the TileLayer that are visible on the screen
          */
         void draw(graphics::RenderTarget& surface, const scene::Camera& camera) override;
+        /**
+         * \brief Loads the chunks close to the Camera view and unloads the ones
+         *        far from it when the TileScene streams chunks, then updates the
+         *        animated tiles of the chunks that are drawn (all the loaded
+         *        ones when the Scene does not cull), drawing the TileLayer does
+         *        it too
+         * \param camera Camera the TileLayer is going to be drawn with
+         */
+        void update_chunks(const scene::Camera& camera);
 
         void set_tile(uint32_t x, uint32_t y, uint32_t tile_id);
         uint32_t get_tile(uint32_t x, uint32_t y) const;
+
+        /**
+         * \brief Gets the amount of chunks of the TileLayer
+         */
+        [[nodiscard]] std::size_t get_chunks_amount() const;
+        /**
+         * \brief Gets a chunk of the TileLayer, chunks are stored row by row
+         * \nobind
+         */
+        [[nodiscard]] const TileChunk& get_chunk(std::size_t index) const;
+        /**
+         * \brief Gets the amount of chunks which vertices are currently built
+         */
+        [[nodiscard]] std::size_t get_loaded_chunks_amount() const;
     };
 } // namespace obe::tiles
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace obe::tiles
+{
+    /**
+     * \brief Rectangle of adjacent tiles of the same collision group
+     * \nobind
+     */
+    struct TileRectangle
+    {
+        /**
+         * \brief Horizontal position of the first tile of the rectangle
+         */
+        uint32_t x = 0;
+        /**
+         * \brief Vertical position of the first tile of the rectangle
+         */
+        uint32_t y = 0;
+        /**
+         * \brief Width of the rectangle (in tiles)
+         */
+        uint32_t width = 0;
+        /**
+         * \brief Height of the rectangle (in tiles)
+         */
+        uint32_t height = 0;
+        /**
+         * \brief Collision group of the tiles of the rectangle
+         */
+        uint32_t group = 0;
+
+        bool operator==(const TileRectangle& other) const = default;
+    };
+
+    /**
+     * \brief Covers the tiles of a grid with rectangles of tiles of the same
+     *        collision group (greedy meshing), rectangles grow to the right
+     *        then downwards as long as whole rows of the same group are left
+     * \param groups Collision group of each tile of the grid, row by row,
+     *        0 for the tiles which are not solid
+     * \param width Width of the grid (in tiles)
+     * \return The rectangles, ordered by their first tile
+     * \nobind
+     */
+    std::vector<TileRectangle> merge_tiles(std::vector<uint32_t> groups, uint32_t width);
+} // namespace obe::tiles
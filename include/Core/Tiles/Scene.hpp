@@ -2,6 +2,8 @@
 
 #include <cstdint>
 #include <memory>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include <vili/node.hpp>
@@ -33,6 +35,14 @@ namespace obe::tiles
         uint32_t m_tile_width;
         uint32_t m_tile_height;
         bool m_smooth = false;
+        uint32_t m_chunk_size = 32;
+        bool m_streaming = false;
+        uint32_t m_streaming_margin = 1;
+        bool m_merge_colliders = true;
+        // Tiles which collider covers the whole tile, by collision group
+        // The tiles of the same group can be merged in a single collider
+        std::unordered_map<uint32_t, uint32_t> m_solid_tiles;
+        std::vector<std::string> m_solid_groups_tags;
 
         std::vector<std::unique_ptr<TileLayer>> m_layers;
         std::vector<std::unique_ptr<AnimatedTile>> m_animated_tiles;
@@ -40,7 +50,15 @@ namespace obe::tiles
         std::vector<vili::node> m_game_objects_models;
         TilesetCollection m_tilesets;
 
+        // Models by tile id, so building a tile does not go through all the models
+        std::unordered_map<uint32_t, AnimatedTile*> m_animated_tiles_by_tile_id;
+        std::unordered_map<uint32_t, std::vector<collision::ColliderComponent*>>
+            m_collider_models_by_tile_id;
+        std::unordered_map<uint32_t, std::vector<vili::node>> m_game_objects_models_by_tile_id;
+
         void build();
+        void add_solid_tile(uint32_t tile_id, const std::string& tag);
+        void index_models();
 
     public:
         explicit TileScene(scene::Scene& scene);
@@ -49,7 +67,7 @@ namespace obe::tiles
         [[nodiscard]] vili::node dump() const override;
         void load(const vili::node& data) override;
 
-        void update() const;
+        void update(time::TimeUnit dt) const;
         void clear();
 
         [[nodiscard]] std::vector<TileLayer*> get_all_layers() const;
@@ -60,12 +78,65 @@ namespace obe::tiles
         [[nodiscard]] std::vector<graphics::Renderable*> get_renderables() const;
         [[nodiscard]] std::vector<collision::ColliderComponent*> get_collider_models() const;
         [[nodiscard]] const std::vector<vili::node>& get_game_objects_models() const;
+        /**
+         * \brief Gets the AnimatedTile starting with a given tile
+         * \param tile_id Id of the tile (without the flip flags)
+         * \return A pointer to the AnimatedTile or nullptr if the tile is not
+         *         animated
+         */
+        [[nodiscard]] AnimatedTile* get_tile_animation(uint32_t tile_id) const;
+        /**
+         * \brief Gets the collider models of a given tile
+         * \param tile_id Id of the tile (without the flip flags)
+         */
+        [[nodiscard]] const std::vector<collision::ColliderComponent*>& get_tile_collider_models(
+            uint32_t tile_id) const;
+        /**
+         * \brief Gets the models of the GameObjects created with a given tile
+         * \param tile_id Id of the tile (without the flip flags)
+         */
+        [[nodiscard]] const std::vector<vili::node>& get_tile_game_objects_models(
+            uint32_t tile_id) const;
 
         [[nodiscard]] uint32_t get_width() const;
         [[nodiscard]] uint32_t get_height() const;
         [[nodiscard]] uint32_t get_tile_width() const;
         [[nodiscard]] uint32_t get_tile_height() const;
         [[nodiscard]] bool is_anti_aliased() const;
+        /**
+         * \brief Gets the size (in tiles) of the square chunks the layers are
+         *        split in
+         */
+        [[nodiscard]] uint32_t get_chunk_size() const;
+        /**
+         * \brief Whether the chunks of the layers are only built around the
+         *        camera
+         */
+        [[nodiscard]] bool is_streaming() const;
+        /**
+         * \brief Gets the amount of chunks built around the visible ones when
+         *        the chunks are streamed
+         */
+        [[nodiscard]] uint32_t get_streaming_margin() const;
+        /**
+         * \brief Whether the adjacent solid tiles of the layers share their
+         *        colliders
+         */
+        [[nodiscard]] bool is_merging_colliders() const;
+        /**
+         * \brief Gets the collision group of a tile which collider covers the
+         *        whole tile, solid tiles of the same group can be merged
+         * \param tile_id Id of the tile (without the flip flags)
+         * \return The collision group of the tile, 0 if the tile is not solid
+         *         or if the colliders are not merged
+         * \nobind
+         */
+        [[nodiscard]] uint32_t get_solid_group(uint32_t tile_id) const;
+        /**
+         * \brief Gets the collider tag shared by the tiles of a collision group
+         * \nobind
+         */
+        [[nodiscard]] const std::string& get_solid_group_tag(uint32_t group) const;
 
         [[nodiscard]] scene::Scene& get_scene() const;
     };
@@ -14,6 +14,12 @@ namespace obe::tiles
 
     TileInfo get_tile_info(uint32_t tile_id);
     uint32_t strip_tile_flags(uint32_t tile_id);
+    /**
+     * \brief Converts tile pixels to SceneUnits, a pixel of a tile covers a
+     *        pixel of the screen when the Camera has its default size (1)
+     * \nobind
+     */
+    double tile_pixels_to_units(double pixels);
 
     struct TextureQuadsIndex
     {
@@ -18,6 +18,8 @@ namespace obe::time
         system::Window& m_window;
         time::TimeUnit m_clock;
         double m_delta_time = 0.0;
+        time::TimeUnit m_update_clock;
+        double m_update_delta_time = 0.0;
         double m_speed_coefficient = 1.0;
         std::optional<unsigned int> m_framerate_target;
         bool m_vsync_enabled = true;
@@ -59,6 +61,13 @@ namespace obe::time
          * \return A double containing the GameSpeed
          */
         [[nodiscard]] double get_delta_time() const;
+        /**
+         * \brief Get the time elapsed between the last two updates multiplied by
+         *        the SpeedCoefficient, updates can happen several times per
+         *        rendered frame when they are not synchronized with rendering
+         * \return A double containing the update GameSpeed
+         */
+        [[nodiscard]] double get_update_delta_time() const;
         /**
          * \brief Get the SpeedCoefficient
          * \return A double containing the SpeedCoefficient
@@ -74,6 +83,12 @@ namespace obe::time
          * \return An unsigned int containing the frame per second (fps) cap
          */
         [[nodiscard]] unsigned int get_framerate_target() const;
+        /**
+         * \brief Get the time left before the next frame
+         * \return The time left before the next frame, 0 if the framerate
+         *         is not limited or if the next frame is late
+         */
+        [[nodiscard]] TimeUnit get_time_before_next_frame() const;
         /**
          * \brief Check if vsync is enabled or not
          * \return true if vsync is enabled, false otherwise
@@ -1,9 +1,10 @@
 #pragma once
 
 #include <vili/node.hpp>
-#include <vili/parser.hpp>
 #include <vld8/validator.hpp>
 
+#include <Config/CompiledVili.hpp>
+
 namespace obe::types
 {
     /**
@@ -39,7 +40,7 @@ namespace obe::types
 
     inline void Serializable::load_from_file(const std::string& path)
     {
-        const vili::node data = vili::parser::from_file(path);
+        const vili::node data = config::load_vili_file(path);
         this->validate_and_load(data);
     }
 
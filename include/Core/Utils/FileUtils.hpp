@@ -1,6 +1,8 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
 
 /**
@@ -65,6 +67,27 @@ namespace obe::utils::file
      */
     bool delete_directory(const std::string& path);
 
+    /**
+     * \brief Reads the whole content of a file in binary mode
+     * \param path Path of the file you want to read
+     * \param content String receiving the content of the file
+     * \return true if the file has been read, false otherwise
+     */
+    bool read_file(const std::string& path, std::string& content);
+    /**
+     * \brief Writes a file in binary mode, creating its parent directories if needed
+     * \param path Path of the file you want to write
+     * \param content Content of the file
+     * \return true if the file has been written, false otherwise
+     */
+    bool write_file(const std::string& path, std::string_view content);
+    /**
+     * \brief Hashes content with FNV-1a, which gives the same result on every platform
+     * \param content Content to hash, usually the content of a file
+     * \return The 64 bits hash of the content
+     */
+    std::uint64_t hash_content(std::string_view content);
+
     /**
      * \brief Get the Current Working Directory (CWD)
      * \return A std::string containing the Current Working Directory
@@ -104,7 +104,7 @@ namespace obe::animation
     void AnimationState::execute_instruction()
     {
         const vili::node& current_command = m_parent.m_code[m_code_index];
-        debug::Log->trace("<animation> Executing instruction {} / {} : {}", m_code_index,
+        OBE_TRACE("<animation> Executing instruction {} / {} : {}", m_code_index,
             m_parent.m_code.size() - 1, current_command.dump());
         const AnimationCommand command
             = AnimationCommandMeta::from_string(current_command.at("command").as_string());
@@ -146,32 +146,31 @@ namespace obe::animation
         {
             return;
         }
-        debug::Log->trace(
-            "    <animation> Updating AnimationGroup '{}'", m_current_group->get_name());
+        OBE_TRACE("    <animation> Updating AnimationGroup '{}'", m_current_group->get_name());
         m_current_group->next();
         if (m_current_group->is_over())
         {
-            debug::Log->trace(
+            OBE_TRACE(
                 "        <animation> AnimationGroup '{}' is over", m_current_group->get_name());
             if (m_code_index < m_parent.m_code.size())
             {
-                debug::Log->trace("    <animation> Restarting code execution");
+                OBE_TRACE("    <animation> Restarting code execution");
                 m_feed_instructions = true;
                 m_current_group->reset();
             }
             else
             {
-                debug::Log->trace("    <animation> animation '{}' has no more code to execute");
+                OBE_TRACE("    <animation> animation '{}' has no more code to execute");
                 if (m_parent.m_play_mode == AnimationPlayMode::OneTime)
                 {
-                    debug::Log->trace("    <animation> animation '{}' will stay on "
-                                      "the last texture");
+                    OBE_TRACE("    <animation> animation '{}' will stay on "
+                              "the last texture");
                     m_current_group->previous(true);
                     m_over = true;
                 }
                 else
                 {
-                    debug::Log->trace("    <animation> animation '{}' will reset code execution");
+                    OBE_TRACE("    <animation> animation '{}' will reset code execution");
                     m_feed_instructions = true;
                     m_current_group->reset();
                     m_code_index = 0;
@@ -196,8 +195,21 @@ namespace obe::animation
         {
             for (auto& image : source.at("images"))
             {
-                const graphics::Texture& texture = this->load_texture(image);
-                m_frames.push_back(texture.make_texture_part());
+                // Frames loaded through the ResourceManager may be packed in an atlas
+                if (m_resource_manager)
+                {
+                    const graphics::TexturePart part = m_resource_manager->get_texture_part(
+                        m_path.add(image.as<vili::string>()), m_anti_aliasing);
+                    // Keeping a copy of the Texture prevents ResourceManager::clean from
+                    // releasing it while the Animation (possibly cached) is still alive
+                    m_textures.push_back(part.get_texture());
+                    m_frames.emplace_back(m_textures.back(), part.get_texture_rect());
+                }
+                else
+                {
+                    const graphics::Texture& texture = this->load_texture(image);
+                    m_frames.push_back(texture.make_texture_part());
+                }
             }
         }
         else if (source.contains("spritesheet"))
@@ -240,24 +252,24 @@ namespace obe::animation
     {
         for (auto [group_name, group] : groups.items())
         {
-            debug::Log->trace("    <animation> Loading AnimationGroup '{}'", group_name);
+            OBE_TRACE("    <animation> Loading AnimationGroup '{}'", group_name);
             m_groups.emplace(group_name, std::make_unique<AnimationGroup>(group_name));
             for (vili::node& current_texture : group.at("content"))
             {
                 uint32_t frame_index = current_texture.as<vili::integer>();
-                debug::Log->trace("      <animation> Pushing Texture {} into group", frame_index);
+                OBE_TRACE("      <animation> Pushing Texture {} into group", frame_index);
                 m_groups[group_name]->push_frame_index(frame_index);
             }
 
             if (group.contains("framerate"))
             {
                 vili::number delay = group.at("framerate");
-                debug::Log->trace("      <animation> Setting group framerate to {}", delay);
+                OBE_TRACE("      <animation> Setting group framerate to {}", delay);
                 m_groups[group_name]->set_delay(delay);
             }
             else
             {
-                debug::Log->trace(
+                OBE_TRACE(
                     "      <animation> No framerate specified, using parent delay : {}", m_delay);
                 m_groups[group_name]->set_delay(m_delay);
             }
@@ -268,7 +280,7 @@ namespace obe::animation
     {
         for (const vili::node& command : code)
         {
-            debug::Log->trace("    <animation> Parsing animation command '{}'", command);
+            OBE_TRACE("    <animation> Parsing animation command '{}'", command);
             m_code.push_back(command);
         }
     }
@@ -276,21 +288,20 @@ namespace obe::animation
     const graphics::Texture& Animation::load_texture(const std::string& local_path)
     {
         std::string texture_name = local_path;
-        debug::Log->trace("    <animation> Loading image '{}'", texture_name);
+        OBE_TRACE("    <animation> Loading image '{}'", texture_name);
 
         std::string path_to_texture = m_path.add(texture_name).to_string();
-        debug::Log->trace("    <animation> Found Texture Path at '{}'", path_to_texture);
+        OBE_TRACE("    <animation> Found Texture Path at '{}'", path_to_texture);
         if (m_resource_manager)
         {
-            debug::Log->trace(
-                "    <animation> Loading Texture {0} (using ResourceManager)", texture_name);
+            OBE_TRACE("    <animation> Loading Texture {0} (using ResourceManager)", texture_name);
             m_textures.emplace_back(
                 m_resource_manager->get_texture(m_path.add(texture_name), m_anti_aliasing));
             return m_textures.back();
         }
         else
         {
-            debug::Log->trace("    <animation> Loading Texture {0}", texture_name);
+            OBE_TRACE("    <animation> Loading Texture {0}", texture_name);
             graphics::Texture new_texture;
             new_texture.load_from_file(m_path.add(texture_name).find(system::PathType::File));
             // TODO: Add a way to configure anti-aliasing for textures without ResourceManager
@@ -313,17 +324,22 @@ namespace obe::animation
             m_priority = parameters.at("priority");
     }
 
-    void AnimationState::update()
+    void AnimationState::update(time::TimeUnit dt)
     {
         if (!m_over)
         {
+            m_clock += dt;
+            if (m_current_group)
+            {
+                m_current_group->update(dt);
+            }
             const time::TimeUnit delay = (m_sleep) ? m_sleep : m_parent.m_delay;
-            debug::Log->trace("<animation> Delay is {} seconds", delay);
-            if (time::epoch() - m_clock > delay)
+            OBE_TRACE("<animation> Delay is {} seconds", delay);
+            if (m_clock > delay)
             {
-                m_clock = time::epoch();
+                m_clock = 0;
                 m_sleep = 0;
-                debug::Log->trace("<animation> Updating animation '{0}'", m_parent.m_name);
+                OBE_TRACE("<animation> Updating animation '{0}'", m_parent.m_name);
 
                 if (m_feed_instructions)
                 {
@@ -399,24 +415,24 @@ namespace obe::animation
         try
         {
             // Meta
-            debug::Log->trace("  <animation> Loading Animation base");
+            OBE_TRACE("  <animation> Loading Animation base");
             m_name = data.at("name");
 
-            debug::Log->trace("    <animation> animation name = '{}'", m_name);
+            OBE_TRACE("    <animation> animation name = '{}'", m_name);
             if (data.contains("framerate"))
             {
                 m_delay = 1.0 / data.at("framerate").as<vili::number>();
-                debug::Log->trace("    <animation> animation clock = {}", m_delay);
+                OBE_TRACE("    <animation> animation clock = {}", m_delay);
             }
             if (data.contains("mode"))
             {
                 m_play_mode = AnimationPlayModeMeta::from_string(data.at("mode"));
-                debug::Log->trace("    <animation> animation play-mode = '{}'",
+                OBE_TRACE("    <animation> animation play-mode = '{}'",
                     AnimationPlayModeMeta::to_string(m_play_mode));
             }
 
             // Sources
-            debug::Log->trace("  <animation> Loading Animation images");
+            OBE_TRACE("  <animation> Loading Animation images");
             if (data.contains("source"))
             {
                 load_source(data.at("source"));
@@ -428,7 +444,7 @@ namespace obe::animation
                     m_path.to_string());
             }
 
-            debug::Log->trace("  <animation> Loading Animation frames metadata");
+            OBE_TRACE("  <animation> Loading Animation frames metadata");
             if (data.contains("frames_metadata"))
             {
                 load_frames_metadata(data.at("frames_metadata"));
@@ -441,7 +457,7 @@ namespace obe::animation
             }
 
             // Groups
-            debug::Log->trace("  <animation> Loading Animation groups");
+            OBE_TRACE("  <animation> Loading Animation groups");
             if (data.contains("groups"))
             {
                 load_groups(data.at("groups"));
@@ -454,7 +470,7 @@ namespace obe::animation
             }
 
             // animation Code
-            debug::Log->trace("  <animation> Loading Animation code");
+            OBE_TRACE("  <animation> Loading Animation code");
             if (data.contains("code"))
             {
                 load_code(data.at("code"));
@@ -475,13 +491,14 @@ namespace obe::animation
 
     void AnimationState::reset() noexcept
     {
-        debug::Log->trace("<animation> Resetting animation '{}'", m_parent.m_name);
+        OBE_TRACE("<animation> Resetting animation '{}'", m_parent.m_name);
         for (auto it = m_groups.cbegin(); it != m_groups.cend(); ++it)
             it->second->reset();
         m_status = AnimationStatus::Play;
         m_code_index = 0;
         m_feed_instructions = true;
         m_over = false;
+        m_clock = std::numeric_limits<time::TimeUnit>::infinity();
     }
 
     void Animation::reset() noexcept
@@ -489,16 +506,16 @@ namespace obe::animation
         m_default_state.reset();
     }
 
-    void Animation::update()
+    void Animation::update(time::TimeUnit dt)
     {
-        m_default_state.update();
+        m_default_state.update(dt);
     }
 
     const graphics::TexturePart& Animation::get_texture_at_index(int index)
     {
         if (index < m_frames.size())
             return m_frames[index];
-        throw exceptions::AnimationFrameIndexOverflow(m_name, index, m_textures.size(), EXC_INFO);
+        throw exceptions::AnimationFrameIndexOverflow(m_name, index, m_frames.size(), EXC_INFO);
     }
 
     const graphics::TexturePart& AnimationState::get_current_texture() const
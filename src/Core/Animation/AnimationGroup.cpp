@@ -7,9 +7,9 @@ namespace obe::animation
 {
     bool AnimationGroup::is_delay_elapsed()
     {
-        if (time::epoch() - m_group_clock > m_delay)
+        if (m_group_clock > m_delay)
         {
-            m_group_clock = time::epoch();
+            m_group_clock = 0;
             return true;
         }
         return false;
@@ -23,6 +23,8 @@ namespace obe::animation
     AnimationGroup::AnimationGroup(const AnimationGroup& group)
         : m_delay(group.m_delay)
         , m_frame_indexes(group.m_frame_indexes)
+        , m_name(group.m_name)
+        , m_loop_amount(group.m_loop_amount)
     {
     }
 
@@ -38,10 +40,16 @@ namespace obe::animation
 
     void AnimationGroup::reset() noexcept
     {
-        debug::Log->trace("            <AnimationGroup> Resetting AnimationGroup '{}'", m_name);
+        OBE_TRACE("            <AnimationGroup> Resetting AnimationGroup '{}'", m_name);
         m_index = 0;
         m_over = false;
         m_loop_index = 0;
+        m_group_clock = std::numeric_limits<time::TimeUnit>::infinity();
+    }
+
+    void AnimationGroup::update(time::TimeUnit dt) noexcept
+    {
+        m_group_clock += dt;
     }
 
     void AnimationGroup::next(bool force)
@@ -61,9 +69,9 @@ namespace obe::animation
                     m_over = true;
                 }
             }
-            debug::Log->trace("            <AnimationGroup> Loading next image on group "
-                              "'{}' (image: {} / {}) "
-                              "(repeat: {} / {})",
+            OBE_TRACE("            <AnimationGroup> Loading next image on group "
+                      "'{}' (image: {} / {}) "
+                      "(repeat: {} / {})",
                 m_name, m_index, this->get_size() - 1, m_loop_index, m_loop_amount - 1);
         }
     }
@@ -79,9 +87,9 @@ namespace obe::animation
             }
             else
                 m_index--;
-            debug::Log->trace("            <AnimationGroup> Loading previous image on "
-                              "group '{}' (image: {} / {}) "
-                              "(repeat: {} / {})",
+            OBE_TRACE("            <AnimationGroup> Loading previous image on "
+                      "group '{}' (image: {} / {}) "
+                      "(repeat: {} / {})",
                 m_name, m_index, this->get_size() - 1, m_loop_index, m_loop_amount - 1);
         }
     }
@@ -1,7 +1,7 @@
-#include <vili/parser.hpp>
-
 #include <Animation/Animator.hpp>
 #include <Animation/Exceptions.hpp>
+#include <Config/CompiledVili.hpp>
+#include <Engine/ResourceManager.hpp>
 #include <Graphics/Sprite.hpp>
 #include <Transform/UnitVector.hpp>
 
@@ -9,6 +9,16 @@ using namespace std::string_literals;
 
 namespace obe::animation
 {
+    namespace
+    {
+        // Played by the AnimatorStates which did not load an Animator yet
+        const Animator& get_empty_animator()
+        {
+            static const Animator EmptyAnimator;
+            return EmptyAnimator;
+        }
+    }
+
     void AnimatorState::apply_texture() const
     {
         const graphics::TexturePart& texture = this->get_current_texture();
@@ -45,14 +55,25 @@ namespace obe::animation
             m_target->use_texture_size();
     }
 
+    AnimatorState::AnimatorState()
+        : m_parent(&get_empty_animator())
+    {
+    }
+
     AnimatorState::AnimatorState(const Animator& parent)
-        : m_parent(parent)
+        : m_parent(&parent)
+    {
+    }
+
+    AnimatorState::AnimatorState(std::shared_ptr<const Animator> parent)
+        : m_parent(parent.get())
+        , m_shared_parent(std::move(parent))
     {
     }
 
     void AnimatorState::load()
     {
-        for (const auto& [animation_name, animation] : m_parent.m_animations)
+        for (const auto& [animation_name, animation] : m_parent->m_animations)
         {
             auto state = std::make_unique<AnimationState>(*animation.get());
             state->load();
@@ -60,6 +81,26 @@ namespace obe::animation
         }
     }
 
+    void AnimatorState::load(system::Path path, engine::ResourceManager* resources)
+    {
+        const bool anti_aliasing = m_target && m_target->is_anti_aliased();
+        if (resources)
+        {
+            m_shared_parent = resources->get_animator(path, anti_aliasing);
+        }
+        else
+        {
+            auto animator = std::make_shared<Animator>();
+            animator->set_anti_aliasing(anti_aliasing);
+            animator->load(path);
+            m_shared_parent = std::move(animator);
+        }
+        m_parent = m_shared_parent.get();
+        m_states.clear();
+        m_current_animation = nullptr;
+        this->load();
+    }
+
     void AnimatorState::reset()
     {
         m_current_animation = nullptr;
@@ -82,7 +123,7 @@ namespace obe::animation
 
     void Animator::clear() noexcept
     {
-        debug::Log->trace("<Animator> Clearing Animator at '{0}'", m_path.to_string());
+        OBE_TRACE("<Animator> Clearing Animator at '{0}'", m_path.to_string());
         m_animations.clear();
         m_default_state.reset();
     }
@@ -123,10 +164,10 @@ namespace obe::animation
 
     void AnimatorState::set_animation(const std::string& key)
     {
-        if (m_parent.m_animations.find(key) == m_parent.m_animations.end())
+        if (m_parent->m_animations.find(key) == m_parent->m_animations.end())
         {
             throw exceptions::UnknownAnimation(
-                m_parent.m_path.to_string(), key, m_parent.get_all_animations_names(), EXC_INFO);
+                m_parent->m_path.to_string(), key, m_parent->get_all_animations_names(), EXC_INFO);
         }
         if (key != this->get_current_animation_name())
         {
@@ -134,7 +175,7 @@ namespace obe::animation
             if (m_current_animation != nullptr)
             {
                 if (m_current_animation->is_over()
-                    || m_parent.m_animations.at(key)->get_priority()
+                    || m_parent->m_animations.at(key)->get_priority()
                         >= m_current_animation->get_animation().get_priority())
                     change_animation = true;
             }
@@ -151,7 +192,7 @@ namespace obe::animation
 
     void Animator::set_animation(const std::string& key)
     {
-        debug::Log->trace("<Animator> Set animation Key '{0}' for Animator at {1} {2}", key,
+        OBE_TRACE("<Animator> Set animation Key '{0}' for Animator at {1} {2}", key,
             m_path.to_string(), m_animations.size());
         m_default_state.set_animation(key);
     }
@@ -175,7 +216,7 @@ namespace obe::animation
         auto found_animator_cfg = m_path.add("animator.cfg.vili").find(system::PathType::File);
         if (found_animator_cfg.success())
         {
-            animator_cfg_file = vili::parser::from_file(found_animator_cfg.path());
+            animator_cfg_file = config::load_vili_file(found_animator_cfg.path());
         }
         for (const auto& directory : directories)
         {
@@ -185,6 +226,10 @@ namespace obe::animation
             {
                 temp_animation->set_anti_aliasing(m_default_state.get_target()->is_anti_aliased());
             }
+            else
+            {
+                temp_animation->set_anti_aliasing(m_anti_aliasing);
+            }
             const std::string animation_config_file
                 = animation_path.add(animation_path.last() + ".animation.vili").find();
             try
@@ -212,24 +257,24 @@ namespace obe::animation
         m_default_state.load();
     }
 
-    void AnimatorState::update()
+    void AnimatorState::update(time::TimeUnit dt)
     {
         if (!m_paused)
         {
-            debug::Log->trace("<Animator> Updating Animator at {0}", m_parent.m_path.to_string());
+            OBE_TRACE("<Animator> Updating Animator at {0}", m_parent->m_path.to_string());
             if (m_current_animation == nullptr)
-                throw exceptions::NoSelectedAnimation(m_parent.m_path.to_string(), EXC_INFO);
+                throw exceptions::NoSelectedAnimation(m_parent->m_path.to_string(), EXC_INFO);
             if (m_current_animation->get_status() == AnimationStatus::Call)
             {
                 m_current_animation->reset();
                 const std::string next_animation = m_current_animation->get_next_animation();
-                if (m_parent.m_animations.find(next_animation) == m_parent.m_animations.end())
-                    throw exceptions::UnknownAnimation(m_parent.m_path.to_string(), next_animation,
-                        m_parent.get_all_animations_names(), EXC_INFO);
+                if (m_parent->m_animations.find(next_animation) == m_parent->m_animations.end())
+                    throw exceptions::UnknownAnimation(m_parent->m_path.to_string(), next_animation,
+                        m_parent->get_all_animations_names(), EXC_INFO);
                 m_current_animation = m_states.at(next_animation).get();
             }
             if (m_current_animation->get_status() == AnimationStatus::Play)
-                m_current_animation->update();
+                m_current_animation->update(dt);
 
             if (m_target)
             {
@@ -238,9 +283,9 @@ namespace obe::animation
         }
     }
 
-    void Animator::update()
+    void Animator::update(time::TimeUnit dt)
     {
-        m_default_state.update();
+        m_default_state.update(dt);
     }
 
     void AnimatorState::set_target(
@@ -260,6 +305,16 @@ namespace obe::animation
         return m_path;
     }
 
+    void Animator::set_anti_aliasing(bool anti_aliasing) noexcept
+    {
+        m_anti_aliasing = anti_aliasing;
+    }
+
+    bool Animator::is_anti_aliased() const noexcept
+    {
+        return m_anti_aliasing;
+    }
+
     AnimatorState Animator::make_state() const
     {
         auto state = AnimatorState(*this);
@@ -276,11 +331,22 @@ namespace obe::animation
     {
         if (m_current_animation)
             return m_current_animation->get_current_texture();
-        throw exceptions::NoSelectedAnimation(m_parent.get_filesystem_path().to_string(), EXC_INFO);
+        throw exceptions::NoSelectedAnimation(
+            m_parent->get_filesystem_path().to_string(), EXC_INFO);
+    }
+
+    std::vector<std::string> AnimatorState::get_all_animations_names() const
+    {
+        return m_parent->get_all_animations_names();
+    }
+
+    system::Path AnimatorState::get_filesystem_path() const
+    {
+        return m_parent->get_filesystem_path();
     }
 
     const Animator& AnimatorState::get_animator() const
     {
-        return m_parent;
+        return *m_parent;
     }
 } // namespace obe::animation
@@ -1,3 +1,8 @@
+#include <Bindings/Index.hpp>
+
+#include <string>
+#include <vector>
+
 #include <Bindings/Config.hpp>
 #include <Bindings/Exceptions.hpp>
 #include <Bindings/Patches.hpp>
@@ -16,6 +21,7 @@
 #include <Bindings/obe/engine/Engine.hpp>
 #include <Bindings/obe/event/Event.hpp>
 #include <Bindings/obe/events/Actions/Actions.hpp>
+#include <Bindings/obe/events/Collision/Collision.hpp>
 #include <Bindings/obe/events/Cursor/Cursor.hpp>
 #include <Bindings/obe/events/Events.hpp>
 #include <Bindings/obe/events/Game/Game.hpp>
@@ -61,530 +67,1048 @@
 #include <Bindings/vili/utils/Utils.hpp>
 #include <Bindings/vili/utils/string/String.hpp>
 #include <Bindings/vili/writer/Writer.hpp>
+#include <Debug/Logger.hpp>
+#include <Script/BytecodeCache.hpp>
+#include <System/Path.hpp>
 #include <sol/sol.hpp>
+
 namespace obe::bindings
 {
-    void index_core_bindings(sol::state_view state)
+    namespace
+    {
+        void load_obe_system(sol::state_view state)
+        {
+            state["obe"]["system"].get_or_create<sol::table>();
+            state["obe"]["system"]["project"].get_or_create<sol::table>();
+            state["obe"]["system"]["package"].get_or_create<sol::table>();
+            state["obe"]["system"]["constraints"].get_or_create<sol::table>();
+            state["obe"]["system"]["prefixes"].get_or_create<sol::table>();
+            state["obe"]["system"]["priorities"].get_or_create<sol::table>();
+            state["obe"]["system"]["project"]["Prefixes"].get_or_create<sol::table>();
+
+            obe::system::bindings::load_class_mountable_path(state);
+            obe::system::bindings::load_class_find_result(state);
+            obe::system::bindings::load_class_path(state);
+            obe::system::bindings::load_class_contextual_path_factory(state);
+            obe::system::bindings::load_class_cursor(state);
+            obe::system::bindings::load_class_cursor_model(state);
+            obe::system::bindings::load_class_plugin(state);
+            obe::system::bindings::load_class_window(state);
+            obe::system::bindings::load_enum_cursor_type(state);
+            obe::system::bindings::load_enum_mountable_path_type(state);
+            obe::system::bindings::load_enum_same_prefix_policy(state);
+            obe::system::bindings::load_enum_path_type(state);
+            obe::system::bindings::load_enum_window_context(state);
+            obe::system::bindings::load_enum_stretch_mode(state);
+            obe::system::bindings::load_enum_window_size(state);
+            obe::system::bindings::load_enum_render_size(state);
+            obe::system::bindings::load_function_split_path_and_prefix(state);
+            obe::system::project::bindings::load_class_project(state);
+            obe::system::project::bindings::load_class_project_ur_ls(state);
+            obe::system::project::bindings::load_function_get_project_location(state);
+            obe::system::project::bindings::load_function_project_exists(state);
+            obe::system::project::bindings::load_function_load(state);
+            obe::system::project::bindings::load_function_list_projects(state);
+            obe::system::package::bindings::load_function_get_package_location(state);
+            obe::system::package::bindings::load_function_package_exists(state);
+            obe::system::package::bindings::load_function_list_packages(state);
+            obe::system::package::bindings::load_function_install(state);
+            obe::system::package::bindings::load_function_load(state);
+            obe::system::constraints::bindings::load_global_default(state);
+            obe::system::prefixes::bindings::load_global_obe(state);
+            obe::system::prefixes::bindings::load_global_cwd(state);
+            obe::system::prefixes::bindings::load_global_exe(state);
+            obe::system::prefixes::bindings::load_global_cfg(state);
+            obe::system::prefixes::bindings::load_global_mount(state);
+            obe::system::prefixes::bindings::load_global_extlibs(state);
+            obe::system::prefixes::bindings::load_global_root(state);
+            obe::system::prefixes::bindings::load_global_game(state);
+            obe::system::priorities::bindings::load_global_high(state);
+            obe::system::priorities::bindings::load_global_projectmount(state);
+            obe::system::priorities::bindings::load_global_project(state);
+            obe::system::priorities::bindings::load_global_mount(state);
+            obe::system::priorities::bindings::load_global_defaults(state);
+            obe::system::priorities::bindings::load_global_low(state);
+            obe::system::project::Prefixes::bindings::load_global_objects(state);
+            obe::system::project::Prefixes::bindings::load_global_scenes(state);
+        }
+
+        void load_obe(sol::state_view state)
+        {
+            obe::bindings::load_class_base_exception(state);
+            obe::bindings::load_class_debug_info(state);
+            obe::bindings::load_function_get_type_name(state);
+            obe::bindings::load_function_init_engine(state);
+        }
+
+        void load_obe_animation(sol::state_view state)
+        {
+            state["obe"]["animation"].get_or_create<sol::table>();
+            state["obe"]["animation"]["easing"].get_or_create<sol::table>();
+            state["obe"]["animation"]["schemas"].get_or_create<sol::table>();
+
+            obe::animation::bindings::load_class_animation(state);
+            obe::animation::bindings::load_class_animation_group(state);
+            obe::animation::bindings::load_class_animation_state(state);
+            obe::animation::bindings::load_class_animator(state);
+            obe::animation::bindings::load_class_animator_state(state);
+            obe::animation::bindings::load_class_color_tweening(state);
+            obe::animation::bindings::load_class_unit_vector_tweening(state);
+            obe::animation::bindings::load_class_rect_tweening(state);
+            obe::animation::bindings::load_class_trajectory_tweening(state);
+            obe::animation::bindings::load_class_int_tweening(state);
+            obe::animation::bindings::load_class_double_tweening(state);
+            obe::animation::bindings::load_enum_animation_play_mode(state);
+            obe::animation::bindings::load_enum_animation_command(state);
+            obe::animation::bindings::load_enum_animation_status(state);
+            obe::animation::bindings::load_enum_animator_target_scale_mode(state);
+            obe::animation::bindings::load_function_template_specialization_exists_impl(state);
+            obe::animation::bindings::load_function_tween(state);
+            obe::animation::easing::bindings::load_enum_easing_type(state);
+            obe::animation::easing::bindings::load_function_linear(state);
+            obe::animation::easing::bindings::load_function_in_sine(state);
+            obe::animation::easing::bindings::load_function_out_sine(state);
+            obe::animation::easing::bindings::load_function_in_out_sine(state);
+            obe::animation::easing::bindings::load_function_in_quad(state);
+            obe::animation::easing::bindings::load_function_out_quad(state);
+            obe::animation::easing::bindings::load_function_in_out_quad(state);
+            obe::animation::easing::bindings::load_function_in_cubic(state);
+            obe::animation::easing::bindings::load_function_out_cubic(state);
+            obe::animation::easing::bindings::load_function_in_out_cubic(state);
+            obe::animation::easing::bindings::load_function_in_quart(state);
+            obe::animation::easing::bindings::load_function_out_quart(state);
+            obe::animation::easing::bindings::load_function_in_out_quart(state);
+            obe::animation::easing::bindings::load_function_in_quint(state);
+            obe::animation::easing::bindings::load_function_out_quint(state);
+            obe::animation::easing::bindings::load_function_in_out_quint(state);
+            obe::animation::easing::bindings::load_function_in_expo(state);
+            obe::animation::easing::bindings::load_function_out_expo(state);
+            obe::animation::easing::bindings::load_function_in_out_expo(state);
+            obe::animation::easing::bindings::load_function_in_circ(state);
+            obe::animation::easing::bindings::load_function_out_circ(state);
+            obe::animation::easing::bindings::load_function_in_out_circ(state);
+            obe::animation::easing::bindings::load_function_in_back(state);
+            obe::animation::easing::bindings::load_function_out_back(state);
+            obe::animation::easing::bindings::load_function_in_out_back(state);
+            obe::animation::easing::bindings::load_function_in_elastic(state);
+            obe::animation::easing::bindings::load_function_out_elastic(state);
+            obe::animation::easing::bindings::load_function_in_out_elastic(state);
+            obe::animation::easing::bindings::load_function_in_bounce(state);
+            obe::animation::easing::bindings::load_function_out_bounce(state);
+            obe::animation::easing::bindings::load_function_in_out_bounce(state);
+            obe::animation::easing::bindings::load_function_get(state);
+            obe::animation::schemas::bindings::load_global_animation_schema_str(state);
+            obe::animation::schemas::bindings::load_global_animation_schema(state);
+        }
+
+        void load_obe_audio(sol::state_view state)
+        {
+            state["obe"]["audio"].get_or_create<sol::table>();
+
+            obe::audio::bindings::load_class_audio_manager(state);
+            obe::audio::bindings::load_class_sound(state);
+            obe::audio::bindings::load_class_sound_handle(state);
+            obe::audio::bindings::load_enum_load_policy(state);
+            obe::audio::bindings::load_enum_sound_status(state);
+        }
+
+        void load_obe_collision(sol::state_view state)
+        {
+            state["obe"]["collision"].get_or_create<sol::table>();
+
+            obe::collision::bindings::load_class_capsule_collider(state);
+            obe::collision::bindings::load_class_circle_collider(state);
+            obe::collision::bindings::load_class_collider(state);
+            obe::collision::bindings::load_class_collider_component(state);
+            obe::collision::bindings::load_class_collision_data(state);
+            obe::collision::bindings::load_class_sweep_hit(state);
+            obe::collision::bindings::load_class_collision_space(state);
+            obe::collision::bindings::load_class_complex_polygon_collider(state);
+            obe::collision::bindings::load_class_polygon_collider(state);
+            obe::collision::bindings::load_class_quadtree(state);
+            obe::collision::bindings::load_class_rectangle_collider(state);
+            obe::collision::bindings::load_class_trajectory(state);
+            obe::collision::bindings::load_class_trajectory_node(state);
+            obe::collision::bindings::load_class_collision_rejection_pair(state);
+            obe::collision::bindings::load_enum_collider_type(state);
+            obe::collision::bindings::load_function_collider_type_to_c2type(state);
+            obe::collision::bindings::load_function_get_tag_layer(state);
+        }
+
+        void load_obe_component(sol::state_view state)
+        {
+            state["obe"]["component"].get_or_create<sol::table>();
+
+            obe::component::bindings::load_class_component_base(state);
+        }
+
+        void load_obe_config(sol::state_view state)
+        {
+            state["obe"]["config"].get_or_create<sol::table>();
+            state["obe"]["config"]["validators"].get_or_create<sol::table>();
+
+            obe::config::bindings::load_class_configuration_manager(state);
+            obe::config::bindings::load_class_version(state);
+            obe::config::bindings::load_function_get_compiled_vili_path(state);
+            obe::config::bindings::load_function_load_vili_file(state);
+            obe::config::bindings::load_function_compile_vili_file(state);
+            obe::config::validators::bindings::load_function_animation_validator(state);
+            obe::config::validators::bindings::load_function_config_validator(state);
+            obe::config::validators::bindings::load_function_mount_validator(state);
+            obe::config::validators::bindings::load_function_project_validator(state);
+        }
+
+        void load_obe_engine(sol::state_view state)
+        {
+            state["obe"]["engine"].get_or_create<sol::table>();
+
+            obe::engine::bindings::load_class_engine(state);
+            obe::engine::bindings::load_class_resource_managed_object(state);
+            obe::engine::bindings::load_class_resource_manager(state);
+        }
+
+        void load_obe_event(sol::state_view state)
+        {
+            state["obe"]["event"].get_or_create<sol::table>();
+
+            obe::event::bindings::load_class_callback_scheduler(state);
+            obe::event::bindings::load_class_event_base(state);
+            obe::event::bindings::load_class_event_group(state);
+            obe::event::bindings::load_class_event_group_view(state);
+            obe::event::bindings::load_class_event_manager(state);
+            obe::event::bindings::load_class_event_namespace(state);
+            obe::event::bindings::load_class_event_namespace_view(state);
+            obe::event::bindings::load_class_lua_event_listener(state);
+            obe::event::bindings::load_enum_callback_scheduler_state(state);
+            obe::event::bindings::load_enum_listener_change_state(state);
+        }
+
+        void load_obe_graphics(sol::state_view state)
+        {
+            state["obe"]["graphics"].get_or_create<sol::table>();
+            state["obe"]["graphics"]["canvas"].get_or_create<sol::table>();
+            state["obe"]["graphics"]["shapes"].get_or_create<sol::table>();
+            state["obe"]["graphics"]["utils"].get_or_create<sol::table>();
+
+            obe::graphics::bindings::load_class_color(state);
+            obe::graphics::bindings::load_class_editor_sprite(state);
+            obe::graphics::bindings::load_class_font(state);
+            obe::graphics::bindings::load_class_nine_patch(state);
+            obe::graphics::bindings::load_class_position_transformer(state);
+            obe::graphics::bindings::load_class_render_target(state);
+            obe::graphics::bindings::load_class_renderable(state);
+            obe::graphics::bindings::load_class_rich_text(state);
+            obe::graphics::bindings::load_class_shader(state);
+            obe::graphics::bindings::load_class_sprite(state);
+            obe::graphics::bindings::load_class_sprite_handle_point(state);
+            obe::graphics::bindings::load_class_spritesheet(state);
+            obe::graphics::bindings::load_class_svg_texture(state);
+            obe::graphics::bindings::load_class_text(state);
+            obe::graphics::bindings::load_class_texture(state);
+            obe::graphics::bindings::load_class_texture_part(state);
+            obe::graphics::bindings::load_class_hsv(state);
+            obe::graphics::bindings::load_enum_color_type(state);
+            obe::graphics::bindings::load_enum_sprite_handle_point_type(state);
+            obe::graphics::bindings::load_function_init_position_transformers(state);
+            obe::graphics::bindings::load_function_make_null_texture(state);
+            obe::graphics::bindings::load_global_transformers(state);
+            obe::graphics::bindings::load_global_parallax(state);
+            obe::graphics::bindings::load_global_camera(state);
+            obe::graphics::bindings::load_global_position(state);
+            obe::graphics::canvas::bindings::load_class_bezier(state);
+            obe::graphics::canvas::bindings::load_class_canvas(state);
+            obe::graphics::canvas::bindings::load_class_canvas_element(state);
+            obe::graphics::canvas::bindings::load_class_canvas_positionable(state);
+            obe::graphics::canvas::bindings::load_class_circle(state);
+            obe::graphics::canvas::bindings::load_class_line(state);
+            obe::graphics::canvas::bindings::load_class_nine_patch(state);
+            obe::graphics::canvas::bindings::load_class_polygon(state);
+            obe::graphics::canvas::bindings::load_class_rectangle(state);
+            obe::graphics::canvas::bindings::load_class_text(state);
+            obe::graphics::canvas::bindings::load_enum_canvas_element_type(state);
+            obe::graphics::canvas::bindings::load_enum_text_horizontal_align(state);
+            obe::graphics::canvas::bindings::load_enum_text_vertical_align(state);
+            obe::graphics::shapes::bindings::load_class_circle(state);
+            obe::graphics::shapes::bindings::load_class_nine_patch(state);
+            obe::graphics::shapes::bindings::load_class_polygon(state);
+            obe::graphics::shapes::bindings::load_class_rectangle(state);
+            obe::graphics::shapes::bindings::load_class_text(state);
+            obe::graphics::utils::bindings::load_class_draw_polygon_options(state);
+            obe::graphics::utils::bindings::load_function_draw_point(state);
+            obe::graphics::utils::bindings::load_function_draw_line(state);
+            obe::graphics::utils::bindings::load_function_draw_polygon(state);
+        }
+
+        void load_obe_input(sol::state_view state)
+        {
+            state["obe"]["input"].get_or_create<sol::table>();
+
+            obe::input::bindings::load_class_input_action(state);
+            obe::input::bindings::load_class_input_button_monitor(state);
+            obe::input::bindings::load_class_input_condition(state);
+            obe::input::bindings::load_class_input_manager(state);
+            obe::input::bindings::load_class_input_source(state);
+            obe::input::bindings::load_class_input_source_gamepad_axis(state);
+            obe::input::bindings::load_class_input_source_gamepad_button(state);
+            obe::input::bindings::load_class_input_source_keyboard_key(state);
+            obe::input::bindings::load_class_input_source_mouse_button(state);
+            obe::input::bindings::load_class_input_source_mouse_wheel_scroll(state);
+            obe::input::bindings::load_enum_axis_threshold_direction(state);
+            obe::input::bindings::load_enum_mouse_wheel_scroll_direction(state);
+            obe::input::bindings::load_enum_input_source_state(state);
+            obe::input::bindings::load_enum_input_type(state);
+        }
+
+        void load_obe_network(sol::state_view state)
+        {
+            state["obe"]["network"].get_or_create<sol::table>();
+
+            obe::network::bindings::load_class_lua_packet(state);
+            obe::network::bindings::load_class_network_client(state);
+            obe::network::bindings::load_class_network_event_manager(state);
+            obe::network::bindings::load_class_tcp_server(state);
+            obe::network::bindings::load_class_tcp_socket(state);
+        }
+
+        void load_obe_scene(sol::state_view state)
+        {
+            state["obe"]["scene"].get_or_create<sol::table>();
+
+            obe::scene::bindings::load_class_camera(state);
+            obe::scene::bindings::load_class_scene(state);
+            obe::scene::bindings::load_class_scene_node(state);
+            obe::scene::bindings::load_class_scene_render_options(state);
+            obe::scene::bindings::load_class_scene_render_statistics(state);
+        }
+
+        void load_obe_script(sol::state_view state)
+        {
+            state["obe"]["script"].get_or_create<sol::table>();
+            state["obe"]["script"]["Helpers"].get_or_create<sol::table>();
+            state["obe"]["script"]["vili_lua_bridge"].get_or_create<sol::table>();
+
+            obe::script::bindings::load_class_bytecode_cache(state);
+            obe::script::bindings::load_class_dummy_cast(state);
+            obe::script::bindings::load_class_game_object(state);
+            obe::script::bindings::load_class_garbage_collector(state);
+            obe::script::bindings::load_class_garbage_collector_statistics(state);
+            obe::script::bindings::load_class_game_object_database(state);
+            obe::script::bindings::load_class_lua_state(state);
+            obe::script::bindings::load_enum_environment_target(state);
+            obe::script::bindings::load_function_cast(state);
+            obe::script::bindings::load_function_sol_call_status_to_string(state);
+            obe::script::bindings::load_function_safe_lua_call(state);
+            obe::script::bindings::load_global_script_cache(state);
+            obe::script::Helpers::bindings::load_function_make_all_helpers(state);
+            obe::script::Helpers::bindings::load_function_fetch_from_one_of(state);
+            obe::script::Helpers::bindings::load_function_rawget_from(state);
+            obe::script::Helpers::bindings::load_function_len_from(state);
+            obe::script::Helpers::bindings::load_function_pairs_from(state);
+            obe::script::vili_lua_bridge::bindings::load_function_vili_to_lua(state);
+            obe::script::vili_lua_bridge::bindings::load_function_lua_to_vili(state);
+            obe::script::vili_lua_bridge::bindings::load_function_vili_object_to_lua_table(state);
+            obe::script::vili_lua_bridge::bindings::load_function_vili_primitive_to_lua_value(state);
+            obe::script::vili_lua_bridge::bindings::load_function_vili_array_to_lua_table(state);
+            obe::script::vili_lua_bridge::bindings::load_function_lua_table_to_vili_object(state);
+            obe::script::vili_lua_bridge::bindings::load_function_lua_value_to_vili_primitive(state);
+            obe::script::vili_lua_bridge::bindings::load_function_lua_table_to_vili_array(state);
+        }
+
+        void load_obe_tiles(sol::state_view state)
+        {
+            state["obe"]["tiles"].get_or_create<sol::table>();
+
+            obe::tiles::bindings::load_class_animated_tile(state);
+            obe::tiles::bindings::load_class_tile_layer(state);
+            obe::tiles::bindings::load_class_tile_scene(state);
+            obe::tiles::bindings::load_class_tileset(state);
+            obe::tiles::bindings::load_class_tileset_collection(state);
+            obe::tiles::bindings::load_class_texture_quads_index(state);
+            obe::tiles::bindings::load_class_tile_info(state);
+            obe::tiles::bindings::load_function_get_tile_info(state);
+            obe::tiles::bindings::load_function_strip_tile_flags(state);
+            obe::tiles::bindings::load_function_apply_texture_quads_transforms(state);
+        }
+
+        void load_obe_time(sol::state_view state)
+        {
+            state["obe"]["time"].get_or_create<sol::table>();
+
+            obe::time::bindings::load_class_chronometer(state);
+            obe::time::bindings::load_class_framerate_counter(state);
+            obe::time::bindings::load_class_framerate_manager(state);
+            obe::time::bindings::load_function_epoch(state);
+            obe::time::bindings::load_global_seconds(state);
+            obe::time::bindings::load_global_milliseconds(state);
+            obe::time::bindings::load_global_microseconds(state);
+            obe::time::bindings::load_global_minutes(state);
+            obe::time::bindings::load_global_hours(state);
+            obe::time::bindings::load_global_days(state);
+            obe::time::bindings::load_global_weeks(state);
+        }
+
+        void load_obe_transform(sol::state_view state)
+        {
+            state["obe"]["transform"].get_or_create<sol::table>();
+
+            obe::transform::bindings::load_class_aabb(state);
+            obe::transform::bindings::load_class_matrix2_d(state);
+            obe::transform::bindings::load_class_movable(state);
+            obe::transform::bindings::load_class_polygon(state);
+            obe::transform::bindings::load_class_polygon_point(state);
+            obe::transform::bindings::load_class_polygon_segment(state);
+            obe::transform::bindings::load_class_rect(state);
+            obe::transform::bindings::load_class_referential(state);
+            obe::transform::bindings::load_class_unit_based_object(state);
+            obe::transform::bindings::load_class_unit_vector(state);
+            obe::transform::bindings::load_class_screen_struct(state);
+            obe::transform::bindings::load_class_view_struct(state);
+            obe::transform::bindings::load_enum_referential_conversion_type(state);
+            obe::transform::bindings::load_enum_flip_axis(state);
+            obe::transform::bindings::load_enum_units(state);
+            obe::transform::bindings::load_enum_relative_position_from(state);
+        }
+
+        void load_obe_types(sol::state_view state)
+        {
+            state["obe"]["types"].get_or_create<sol::table>();
+
+            obe::types::bindings::load_class_identifiable(state);
+            obe::types::bindings::load_class_protected_identifiable(state);
+            obe::types::bindings::load_class_selectable(state);
+            obe::types::bindings::load_class_serializable(state);
+            obe::types::bindings::load_class_togglable(state);
+            obe::types::bindings::load_class_unique_identifiable(state);
+            obe::types::bindings::load_class_unknown_enum_entry(state);
+        }
+
+        void load_obe_utils(sol::state_view state)
+        {
+            state["obe"]["utils"].get_or_create<sol::table>();
+            state["obe"]["utils"]["exec"].get_or_create<sol::table>();
+            state["obe"]["utils"]["argparser"].get_or_create<sol::table>();
+            state["obe"]["utils"]["base64"].get_or_create<sol::table>();
+            state["obe"]["utils"]["file"].get_or_create<sol::table>();
+            state["obe"]["utils"]["math"].get_or_create<sol::table>();
+            state["obe"]["utils"]["string"].get_or_create<sol::table>();
+            state["obe"]["utils"]["vector"].get_or_create<sol::table>();
+            state["obe"]["utils"]["argparser"]["exceptions"].get_or_create<sol::table>();
+
+            obe::utils::argparser::exceptions::bindings::load_class_invalid_argument_format(state);
+            obe::utils::exec::bindings::load_class_run_args_parser(state);
+            obe::utils::argparser::bindings::load_function_parse_args(state);
+            obe::utils::base64::bindings::load_function_encode(state);
+            obe::utils::base64::bindings::load_function_decode(state);
+            obe::utils::base64::bindings::load_global_base64_chars(state);
+            obe::utils::file::bindings::load_function_get_directory_list(state);
+            obe::utils::file::bindings::load_function_get_file_list(state);
+            obe::utils::file::bindings::load_function_file_exists(state);
+            obe::utils::file::bindings::load_function_directory_exists(state);
+            obe::utils::file::bindings::load_function_create_directory(state);
+            obe::utils::file::bindings::load_function_create_file(state);
+            obe::utils::file::bindings::load_function_copy(state);
+            obe::utils::file::bindings::load_function_delete_file(state);
+            obe::utils::file::bindings::load_function_delete_directory(state);
+            obe::utils::file::bindings::load_function_get_current_directory(state);
+            obe::utils::file::bindings::load_function_separator(state);
+            obe::utils::file::bindings::load_function_get_executable_directory(state);
+            obe::utils::file::bindings::load_function_get_executable_path(state);
+            obe::utils::file::bindings::load_function_normalize_path(state);
+            obe::utils::file::bindings::load_function_canonical_path(state);
+            obe::utils::file::bindings::load_function_join(state);
+            obe::utils::math::bindings::load_function_randint(state);
+            obe::utils::math::bindings::load_function_randfloat(state);
+            obe::utils::math::bindings::load_function_get_min(state);
+            obe::utils::math::bindings::load_function_get_max(state);
+            obe::utils::math::bindings::load_function_is_between(state);
+            obe::utils::math::bindings::load_function_is_double_int(state);
+            obe::utils::math::bindings::load_function_sign(state);
+            obe::utils::math::bindings::load_function_convert_to_radian(state);
+            obe::utils::math::bindings::load_function_convert_to_degrees(state);
+            obe::utils::math::bindings::load_function_normalize(state);
+            obe::utils::math::bindings::load_global_pi(state);
+            obe::utils::string::bindings::load_function_split(state);
+            obe::utils::string::bindings::load_function_occurences_in_string(state);
+            obe::utils::string::bindings::load_function_is_string_alpha(state);
+            obe::utils::string::bindings::load_function_is_string_alpha_numeric(state);
+            obe::utils::string::bindings::load_function_is_string_numeric(state);
+            obe::utils::string::bindings::load_function_is_string_int(state);
+            obe::utils::string::bindings::load_function_is_string_float(state);
+            obe::utils::string::bindings::load_function_replace(state);
+            obe::utils::string::bindings::load_function_is_surrounded_by(state);
+            obe::utils::string::bindings::load_function_get_random_key(state);
+            obe::utils::string::bindings::load_function_contains(state);
+            obe::utils::string::bindings::load_function_starts_with(state);
+            obe::utils::string::bindings::load_function_ends_with(state);
+            obe::utils::string::bindings::load_function_distance(state);
+            obe::utils::string::bindings::load_function_sort_by_distance(state);
+            obe::utils::string::bindings::load_function_quote(state);
+            obe::utils::string::bindings::load_function_titleize(state);
+            obe::utils::string::bindings::load_global_alphabet(state);
+            obe::utils::string::bindings::load_global_numbers(state);
+            obe::utils::vector::bindings::load_function_contains(state);
+            obe::utils::vector::bindings::load_function_join(state);
+        }
+
+        void load_vili(sol::state_view state)
+        {
+            state["vili"]["parser"].get_or_create<sol::table>();
+            state["vili"]["writer"].get_or_create<sol::table>();
+            state["vili"]["msgpack"].get_or_create<sol::table>();
+            state["vili"]["utils"].get_or_create<sol::table>();
+            state["vili"]["msgpack"]["exceptions"].get_or_create<sol::table>();
+            state["vili"]["parser"]["rules"].get_or_create<sol::table>();
+            state["vili"]["utils"]["string"].get_or_create<sol::table>();
+
+            vili::bindings::load_class_const_node_iterator(state);
+            vili::bindings::load_class_node(state);
+            vili::bindings::load_class_node_iterator(state);
+            vili::bindings::load_enum_node_type(state);
+            vili::bindings::load_function_from_string(state);
+            vili::bindings::load_function_to_string(state);
+            vili::bindings::load_global_permissive_cast(state);
+            vili::bindings::load_global_verbose_exceptions(state);
+            vili::bindings::load_global_true_value(state);
+            vili::bindings::load_global_false_value(state);
+            vili::bindings::load_global_null_typename(state);
+            vili::bindings::load_global_boolean_typename(state);
+            vili::bindings::load_global_integer_typename(state);
+            vili::bindings::load_global_number_typename(state);
+            vili::bindings::load_global_string_typename(state);
+            vili::bindings::load_global_object_typename(state);
+            vili::bindings::load_global_array_typename(state);
+            vili::bindings::load_global_unknown_typename(state);
+            vili::bindings::load_global_container_typename(state);
+            vili::parser::bindings::load_class_node_in_stack(state);
+            vili::parser::bindings::load_class_state(state);
+            vili::parser::bindings::load_function_from_string(state);
+            vili::parser::bindings::load_function_from_file(state);
+            vili::parser::rules::bindings::load_class_affectation(state);
+            vili::parser::rules::bindings::load_class_affectation_separator(state);
+            vili::parser::rules::bindings::load_class_array(state);
+            vili::parser::rules::bindings::load_class_array_elements(state);
+            vili::parser::rules::bindings::load_class_array_separator(state);
+            vili::parser::rules::bindings::load_class_block(state);
+            vili::parser::rules::bindings::load_class_boolean(state);
+            vili::parser::rules::bindings::load_class_brace_based_object(state);
+            vili::parser::rules::bindings::load_class_char_(state);
+            vili::parser::rules::bindings::load_class_close_array(state);
+            vili::parser::rules::bindings::load_class_close_object(state);
+            vili::parser::rules::bindings::load_class_comment(state);
+            vili::parser::rules::bindings::load_class_data(state);
+            vili::parser::rules::bindings::load_class_digits(state);
+            vili::parser::rules::bindings::load_class_element(state);
+            vili::parser::rules::bindings::load_class_empty_line(state);
+            vili::parser::rules::bindings::load_class_endline(state);
+            vili::parser::rules::bindings::load_class_escaped(state);
+            vili::parser::rules::bindings::load_class_escaped_char(state);
+            vili::parser::rules::bindings::load_class_false_(state);
+            vili::parser::rules::bindings::load_class_floating_point(state);
+            vili::parser::rules::bindings::load_class_full_node(state);
+            vili::parser::rules::bindings::load_class_grammar(state);
+            vili::parser::rules::bindings::load_class_identifier(state);
+            vili::parser::rules::bindings::load_class_indent(state);
+            vili::parser::rules::bindings::load_class_indent_based_object(state);
+            vili::parser::rules::bindings::load_class_inline_comment(state);
+            vili::parser::rules::bindings::load_class_inline_element(state);
+            vili::parser::rules::bindings::load_class_inline_node(state);
+            vili::parser::rules::bindings::load_class_integer(state);
+            vili::parser::rules::bindings::load_class_multiline_comment(state);
+            vili::parser::rules::bindings::load_class_multiline_comment_block(state);
+            vili::parser::rules::bindings::load_class_node(state);
+            vili::parser::rules::bindings::load_class_number(state);
+            vili::parser::rules::bindings::load_class_object(state);
+            vili::parser::rules::bindings::load_class_object_elements(state);
+            vili::parser::rules::bindings::load_class_object_separator(state);
+            vili::parser::rules::bindings::load_class_open_array(state);
+            vili::parser::rules::bindings::load_class_open_object(state);
+            vili::parser::rules::bindings::load_class_sign(state);
+            vili::parser::rules::bindings::load_class_space_or_comment(state);
+            vili::parser::rules::bindings::load_class_string(state);
+            vili::parser::rules::bindings::load_class_string_content(state);
+            vili::parser::rules::bindings::load_class_string_delimiter(state);
+            vili::parser::rules::bindings::load_class_true_(state);
+            vili::parser::rules::bindings::load_class_unescaped(state);
+            vili::parser::rules::bindings::load_class_unicode(state);
+            vili::parser::rules::bindings::load_class_vili_grammar(state);
+            vili::parser::rules::bindings::load_class_xdigit(state);
+            vili::writer::bindings::load_class_dump_options(state);
+            vili::writer::bindings::load_class__array(state);
+            vili::writer::bindings::load_class__items_per_line(state);
+            vili::writer::bindings::load_class__object(state);
+            vili::writer::bindings::load_class_dump_state(state);
+            vili::writer::bindings::load_enum_delimiter_newline_policy(state);
+            vili::writer::bindings::load_enum_object_style(state);
+            vili::writer::bindings::load_function_dump_integer(state);
+            vili::writer::bindings::load_function_dump_number(state);
+            vili::writer::bindings::load_function_dump_boolean(state);
+            vili::writer::bindings::load_function_dump_string(state);
+            vili::writer::bindings::load_function_dump_array(state);
+            vili::writer::bindings::load_function_dump_object(state);
+            vili::writer::bindings::load_function_dump(state);
+            vili::msgpack::bindings::load_function_from_string(state);
+            vili::msgpack::bindings::load_function_to_string(state);
+            vili::msgpack::bindings::load_function_dump_element(state);
+            vili::utils::string::bindings::load_function_replace(state);
+            vili::utils::string::bindings::load_function_is_int(state);
+            vili::utils::string::bindings::load_function_is_float(state);
+            vili::utils::string::bindings::load_function_truncate_float(state);
+            vili::utils::string::bindings::load_function_quote(state);
+            vili::utils::string::bindings::load_function_to_double(state);
+            vili::utils::string::bindings::load_function_to_long(state);
+            vili::utils::string::bindings::load_function_indent(state);
+            vili::utils::string::bindings::load_function_distance(state);
+            vili::utils::string::bindings::load_function_sort_by_distance(state);
+        }
+
+        void load_obe_debug(sol::state_view state)
+        {
+            state["obe"]["debug"].get_or_create<sol::table>();
+            state["obe"]["debug"]["render"].get_or_create<sol::table>();
+
+            obe::debug::render::bindings::load_class_collider_render_options(state);
+            obe::debug::render::bindings::load_function_draw_polygon(state);
+            obe::debug::render::bindings::load_function_draw_collider(state);
+            obe::debug::bindings::load_class_profiler(state);
+            obe::debug::bindings::load_class_profiler_sample(state);
+            obe::debug::bindings::load_enum_log_level(state);
+            obe::debug::bindings::load_enum_log_overflow_policy(state);
+            obe::debug::bindings::load_function_init_logger(state);
+            obe::debug::bindings::load_function_enable_async_logging(state);
+            obe::debug::bindings::load_function_disable_async_logging(state);
+            obe::debug::bindings::load_function_flush_logger(state);
+            obe::debug::bindings::load_function_trace(state);
+            obe::debug::bindings::load_function_debug(state);
+            obe::debug::bindings::load_function_info(state);
+            obe::debug::bindings::load_function_warn(state);
+            obe::debug::bindings::load_function_error(state);
+            obe::debug::bindings::load_function_critical(state);
+            obe::debug::bindings::load_global_log(state);
+            obe::debug::bindings::load_global_profile(state);
+        }
+
+        void load_obe_events(sol::state_view state)
+        {
+            state["obe"]["events"].get_or_create<sol::table>();
+            state["obe"]["events"]["Actions"].get_or_create<sol::table>();
+            state["obe"]["events"]["Collision"].get_or_create<sol::table>();
+            state["obe"]["events"]["Cursor"].get_or_create<sol::table>();
+            state["obe"]["events"]["Game"].get_or_create<sol::table>();
+            state["obe"]["events"]["Input"].get_or_create<sol::table>();
+            state["obe"]["events"]["Keys"].get_or_create<sol::table>();
+            state["obe"]["events"]["Network"].get_or_create<sol::table>();
+            state["obe"]["events"]["Scene"].get_or_create<sol::table>();
+
+            obe::events::Actions::bindings::load_class_action(state);
+            obe::events::Collision::bindings::load_class_began(state);
+            obe::events::Collision::bindings::load_class_ended(state);
+            obe::events::Cursor::bindings::load_class_hold(state);
+            obe::events::Cursor::bindings::load_class_move(state);
+            obe::events::Cursor::bindings::load_class_press(state);
+            obe::events::Cursor::bindings::load_class_release(state);
+            obe::events::Game::bindings::load_class_end(state);
+            obe::events::Game::bindings::load_class_render(state);
+            obe::events::Game::bindings::load_class_start(state);
+            obe::events::Game::bindings::load_class_update(state);
+            obe::events::Input::bindings::load_class_text_entered(state);
+            obe::events::Keys::bindings::load_class_pressed(state);
+            obe::events::Keys::bindings::load_class_state_changed(state);
+            obe::events::Network::bindings::load_class_client_rename(state);
+            obe::events::Network::bindings::load_class_connected(state);
+            obe::events::Network::bindings::load_class_disconnected(state);
+            obe::events::Network::bindings::load_class_message(state);
+            obe::events::Scene::bindings::load_class_loaded(state);
+        }
+
+        void load_obe_bindings(sol::state_view state)
+        {
+            state["obe"]["bindings"].get_or_create<sol::table>();
+
+            obe::bindings::bindings::load_function_index_core_bindings(state);
+        }
+
+        struct BindingsGroup
+        {
+            // Namespace table filled by the group, "obe" for the root namespace
+            std::string_view name;
+            // Groups of the base classes used by the usertypes of the group,
+            // checked against the binding sources by BindingsGroupsTests
+            std::vector<std::string_view> dependencies;
+            void (*load)(sol::state_view state);
+        };
+
+        // Eager loading follows this order
+        const std::vector<BindingsGroup> Groups = {
+            { "obe.system", { "obe.types" }, &load_obe_system },
+            { "obe", {}, &load_obe },
+            { "obe.animation", { "obe.types" }, &load_obe_animation },
+            { "obe.audio", {}, &load_obe_audio },
+            { "obe.collision", { "obe.component", "obe.transform", "obe.types" },
+                &load_obe_collision },
+            { "obe.component", { "obe.types" }, &load_obe_component },
+            { "obe.config", { "vili" }, &load_obe_config },
+            { "obe.engine", {}, &load_obe_engine },
+            { "obe.event", {}, &load_obe_event },
+            { "obe.graphics", { "obe.component", "obe.engine", "obe.transform", "obe.types" },
+                &load_obe_graphics },
+            { "obe.input", { "obe.types" }, &load_obe_input },
+            { "obe.network", {}, &load_obe_network },
+            { "obe.scene", { "obe.engine", "obe.transform", "obe.types" }, &load_obe_scene },
+            { "obe.script", { "obe.types" }, &load_obe_script },
+            { "obe.tiles", { "obe.graphics", "obe.types" }, &load_obe_tiles },
+            { "obe.time", {}, &load_obe_time },
+            { "obe.transform", {}, &load_obe_transform },
+            { "obe.types", {}, &load_obe_types },
+            { "obe.utils", {}, &load_obe_utils },
+            { "vili", {}, &load_vili },
+            { "obe.debug", {}, &load_obe_debug },
+            { "obe.events", {}, &load_obe_events },
+            { "obe.bindings", {}, &load_obe_bindings },
+        };
+
+        // Tables created by the scripts of a group instead of its loaders
+        const std::vector<std::pair<std::string_view, std::string_view>> GroupAliases = {
+            { "obe.canvas", "obe.graphics" },
+        };
+
+        constexpr const char* LoadedGroupsKey = "obe.bindings.loaded";
+
+        const BindingsGroup* find_group(std::string_view name)
+        {
+            for (const auto& [alias, group_name] : GroupAliases)
+            {
+                if (alias == name)
+                {
+                    name = group_name;
+                }
+            }
+            for (const BindingsGroup& group : Groups)
+            {
+                if (group.name == name)
+                {
+                    return &group;
+                }
+            }
+            return nullptr;
+        }
+
+        enum class GroupState
+        {
+            Unloaded,
+            Loading,
+            Loaded
+        };
+
+        // Group states are stored in the registry with raw accesses only so
+        // the registry hook is never triggered while checking them
+        GroupState get_group_state(lua_State* L, std::string_view name)
+        {
+            lua_pushstring(L, LoadedGroupsKey);
+            lua_rawget(L, LUA_REGISTRYINDEX);
+            GroupState state = GroupState::Unloaded;
+            if (lua_istable(L, -1))
+            {
+                lua_pushlstring(L, name.data(), name.size());
+                lua_rawget(L, -2);
+                state = static_cast<GroupState>(lua_tointeger(L, -1));
+                lua_pop(L, 1);
+            }
+            lua_pop(L, 1);
+            return state;
+        }
+
+        void set_group_state(lua_State* L, std::string_view name, GroupState state)
+        {
+            lua_pushstring(L, LoadedGroupsKey);
+            lua_rawget(L, LUA_REGISTRYINDEX);
+            if (!lua_istable(L, -1))
+            {
+                lua_pop(L, 1);
+                lua_newtable(L);
+                lua_pushstring(L, LoadedGroupsKey);
+                lua_pushvalue(L, -2);
+                lua_rawset(L, LUA_REGISTRYINDEX);
+            }
+            lua_pushlstring(L, name.data(), name.size());
+            if (state == GroupState::Unloaded)
+            {
+                lua_pushnil(L);
+            }
+            else
+            {
+                lua_pushinteger(L, static_cast<lua_Integer>(state));
+            }
+            lua_rawset(L, -3);
+            lua_pop(L, 1);
+        }
+
+        void load_group(sol::state_view state, const BindingsGroup& group)
+        {
+            lua_State* L = state.lua_state();
+            if (get_group_state(L, group.name) != GroupState::Unloaded)
+            {
+                return;
+            }
+            // Marked first so the namespace lookups done by the loaders do
+            // not load the group a second time
+            set_group_state(L, group.name, GroupState::Loading);
+            try
+            {
+                for (const std::string_view dependency : group.dependencies)
+                {
+                    load_group(state, *find_group(dependency));
+                }
+                OBE_TRACE("<Bindings> Loading bindings of namespace {}", group.name);
+                group.load(state);
+            }
+            catch (...)
+            {
+                // A failed group is loaded again on its next access
+                set_group_state(L, group.name, GroupState::Unloaded);
+                throw;
+            }
+            set_group_state(L, group.name, GroupState::Loaded);
+        }
+
+        // Runs a group loader from a C function, errors are raised once the
+        // C++ frames are left so no destructor is skipped
+        void load_group_from_lua(lua_State* L, std::string_view name)
+        {
+            const BindingsGroup* group = find_group(name);
+            if (!group || get_group_state(L, group->name) != GroupState::Unloaded)
+            {
+                return;
+            }
+            std::string error;
+            try
+            {
+                load_group(L, *group);
+            }
+            catch (const std::exception& exc)
+            {
+                error = exc.what();
+            }
+            if (!error.empty())
+            {
+                lua_pushstring(L, error.c_str());
+                lua_error(L);
+            }
+        }
+
+        // __index of the obe table, loads the namespace that is accessed
+        int index_obe_namespace(lua_State* L)
+        {
+            if (lua_type(L, 2) == LUA_TSTRING)
+            {
+                load_group_from_lua(L, std::string("obe.") + lua_tostring(L, 2));
+            }
+            lua_settop(L, 2);
+            lua_rawget(L, 1);
+            return 1;
+        }
+
+        // __index of the vili table, any access loads the whole vili namespace
+        int index_vili_namespace(lua_State* L)
+        {
+            load_group_from_lua(L, "vili");
+            lua_settop(L, 2);
+            lua_rawget(L, 1);
+            return 1;
+        }
+
+        // Finds the group of a sol metatable name ("sol.obe::graphics::Sprite*")
+        const BindingsGroup* find_usertype_group(std::string_view metatable_name)
+        {
+            if (!metatable_name.starts_with("sol.") || metatable_name.ends_with(".user")
+                || metatable_name.find("\xE2\x99\xBB") != std::string_view::npos)
+            {
+                return nullptr;
+            }
+            const std::size_t obe_position = metatable_name.find("obe::");
+            const std::size_t vili_position = metatable_name.find("vili::");
+            if (vili_position < obe_position)
+            {
+                return find_group("vili");
+            }
+            if (obe_position == std::string_view::npos)
+            {
+                return nullptr;
+            }
+            const std::string_view path = metatable_name.substr(obe_position + 5);
+            const std::size_t namespace_end = path.find("::");
+            if (namespace_end == std::string_view::npos)
+            {
+                return nullptr;
+            }
+            return find_group("obe." + std::string(path.substr(0, namespace_end)));
+        }
+
+        int load_usertype_group(lua_State* L);
+
+        // Sets the stubs on the metatable at the top of the stack, the stubs
+        // keep the registry key of the metatable
+        void set_usertype_stubs(
+            lua_State* L, std::string_view group_name, std::string_view metatable_key)
+        {
+            for (const char* metamethod : { "__index", "__newindex" })
+            {
+                lua_pushlstring(L, group_name.data(), group_name.size());
+                lua_pushlstring(L, metatable_key.data(), metatable_key.size());
+                lua_pushcclosure(L, &load_usertype_group, 2);
+                lua_setfield(L, -2, metamethod);
+            }
+        }
+
+        // sol replaces the metatables of a usertype registered a second time
+        // (after a failed load), the fields of the registered metatable are
+        // copied to the metatable at the top of the stack so the values
+        // pushed before keep working
+        void copy_registered_metatable(lua_State* L, std::string_view metatable_key)
+        {
+            const int metatable = lua_gettop(L);
+            lua_pushlstring(L, metatable_key.data(), metatable_key.size());
+            lua_rawget(L, LUA_REGISTRYINDEX);
+            if (lua_istable(L, -1) && !lua_rawequal(L, -1, metatable))
+            {
+                lua_pushnil(L);
+                while (lua_next(L, -2))
+                {
+                    lua_pushvalue(L, -2);
+                    lua_insert(L, -2);
+                    lua_rawset(L, metatable);
+                }
+            }
+            lua_pop(L, 1);
+        }
+
+        // Stub __index / __newindex of the metatable of a usertype which was
+        // pushed before its namespace was loaded
+        int load_usertype_group(lua_State* L)
+        {
+            const bool is_assignment = lua_gettop(L) >= 3;
+            const std::string group_name = lua_tostring(L, lua_upvalueindex(1));
+            const std::string metatable_key = lua_tostring(L, lua_upvalueindex(2));
+            if (!lua_getmetatable(L, 1))
+            {
+                return luaL_error(L, "missing metatable of %s", metatable_key.c_str());
+            }
+            lua_pushnil(L);
+            lua_setfield(L, -2, "__index");
+            lua_pushnil(L);
+            lua_setfield(L, -2, "__newindex");
+            // The metatable is kept in the registry as the stack is not
+            // usable anymore once a loader failed
+            const int metatable = luaL_ref(L, LUA_REGISTRYINDEX);
+            try
+            {
+                load_group_from_lua(L, group_name);
+            }
+            catch (...)
+            {
+                // Lua is compiled as C++, its errors unwind this frame so the
+                // stubs are restored and the next access loads the group again
+                lua_rawgeti(L, LUA_REGISTRYINDEX, metatable);
+                set_usertype_stubs(L, group_name, metatable_key);
+                lua_pop(L, 1);
+                luaL_unref(L, LUA_REGISTRYINDEX, metatable);
+                throw;
+            }
+            lua_rawgeti(L, LUA_REGISTRYINDEX, metatable);
+            copy_registered_metatable(L, metatable_key);
+            lua_pop(L, 1);
+            luaL_unref(L, LUA_REGISTRYINDEX, metatable);
+            // The usertype metatable is now complete, the access is done again
+            if (is_assignment)
+            {
+                lua_settop(L, 3);
+                lua_settable(L, 1);
+                return 0;
+            }
+            lua_settop(L, 2);
+            lua_gettable(L, 1);
+            return 1;
+        }
+
+        // __newindex of the registry, sol pushes values of a usertype which is
+        // not bound yet with a new metatable, stubs are added to that metatable
+        // so the namespace of the usertype is loaded on first use.
+        // The usertype reuses the same metatable once it is bound
+        int hook_usertype_metatables(lua_State* L)
+        {
+            lua_settop(L, 3);
+            lua_pushvalue(L, 2);
+            lua_pushvalue(L, 3);
+            lua_rawset(L, 1);
+            if (lua_type(L, 2) != LUA_TSTRING || !lua_istable(L, 3))
+            {
+                return 0;
+            }
+            const BindingsGroup* group = find_usertype_group(lua_tostring(L, 2));
+            if (!group || get_group_state(L, group->name) != GroupState::Unloaded)
+            {
+                return 0;
+            }
+            set_usertype_stubs(L, group->name, lua_tostring(L, 2));
+            return 0;
+        }
+
+        // __pairs of the obe and vili tables, the namespaces which are not
+        // loaded yet are loaded first so pairs lists all of them
+        int pairs_namespace(lua_State* L)
+        {
+            const std::string root = lua_tostring(L, lua_upvalueindex(1));
+            for (const BindingsGroup& group : Groups)
+            {
+                if (group.name == root || group.name.starts_with(root + "."))
+                {
+                    load_group_from_lua(L, group.name);
+                }
+            }
+            lua_getglobal(L, "next");
+            lua_pushvalue(L, 1);
+            lua_pushnil(L);
+            return 3;
+        }
+
+        void set_namespace_loader(lua_State* L, const char* name, lua_CFunction loader)
+        {
+            lua_getglobal(L, name);
+            lua_createtable(L, 0, 2);
+            lua_pushcfunction(L, loader);
+            lua_setfield(L, -2, "__index");
+            lua_pushstring(L, name);
+            lua_pushcclosure(L, &pairs_namespace, 1);
+            lua_setfield(L, -2, "__pairs");
+            lua_setmetatable(L, -2);
+            lua_pop(L, 1);
+        }
+    }
+
+    void index_core_bindings(sol::state_view state, BindingsLoading loading)
     {
         state["obe"].get_or_create<sol::table>();
         state["vili"].get_or_create<sol::table>();
-        state["obe"]["animation"].get_or_create<sol::table>();
-        state["obe"]["audio"].get_or_create<sol::table>();
-        state["obe"]["collision"].get_or_create<sol::table>();
-        state["obe"]["component"].get_or_create<sol::table>();
-        state["obe"]["config"].get_or_create<sol::table>();
-        state["obe"]["engine"].get_or_create<sol::table>();
-        state["obe"]["event"].get_or_create<sol::table>();
-        state["obe"]["graphics"].get_or_create<sol::table>();
-        state["obe"]["input"].get_or_create<sol::table>();
-        state["obe"]["network"].get_or_create<sol::table>();
-        state["obe"]["scene"].get_or_create<sol::table>();
-        state["obe"]["script"].get_or_create<sol::table>();
-        state["obe"]["system"].get_or_create<sol::table>();
-        state["obe"]["tiles"].get_or_create<sol::table>();
-        state["obe"]["time"].get_or_create<sol::table>();
-        state["obe"]["transform"].get_or_create<sol::table>();
-        state["obe"]["types"].get_or_create<sol::table>();
-        state["obe"]["utils"].get_or_create<sol::table>();
-        state["vili"]["parser"].get_or_create<sol::table>();
-        state["vili"]["writer"].get_or_create<sol::table>();
-        state["obe"]["debug"].get_or_create<sol::table>();
-        state["obe"]["bindings"].get_or_create<sol::table>();
-        state["vili"]["msgpack"].get_or_create<sol::table>();
-        state["obe"]["events"].get_or_create<sol::table>();
-        state["vili"]["utils"].get_or_create<sol::table>();
-        state["obe"]["graphics"]["canvas"].get_or_create<sol::table>();
-        state["obe"]["graphics"]["shapes"].get_or_create<sol::table>();
-        state["obe"]["system"]["project"].get_or_create<sol::table>();
-        state["obe"]["utils"]["exec"].get_or_create<sol::table>();
-        state["vili"]["msgpack"]["exceptions"].get_or_create<sol::table>();
-        state["obe"]["debug"]["render"].get_or_create<sol::table>();
-        state["obe"]["events"]["Actions"].get_or_create<sol::table>();
-        state["obe"]["events"]["Cursor"].get_or_create<sol::table>();
-        state["obe"]["events"]["Game"].get_or_create<sol::table>();
-        state["obe"]["events"]["Input"].get_or_create<sol::table>();
-        state["obe"]["events"]["Keys"].get_or_create<sol::table>();
-        state["obe"]["events"]["Network"].get_or_create<sol::table>();
-        state["obe"]["events"]["Scene"].get_or_create<sol::table>();
-        state["obe"]["graphics"]["utils"].get_or_create<sol::table>();
-        state["vili"]["parser"]["rules"].get_or_create<sol::table>();
-        state["obe"]["animation"]["easing"].get_or_create<sol::table>();
-        state["obe"]["config"]["validators"].get_or_create<sol::table>();
-        state["obe"]["script"]["Helpers"].get_or_create<sol::table>();
-        state["obe"]["script"]["vili_lua_bridge"].get_or_create<sol::table>();
-        state["obe"]["system"]["package"].get_or_create<sol::table>();
-        state["obe"]["utils"]["argparser"].get_or_create<sol::table>();
-        state["obe"]["utils"]["base64"].get_or_create<sol::table>();
-        state["obe"]["utils"]["file"].get_or_create<sol::table>();
-        state["obe"]["utils"]["math"].get_or_create<sol::table>();
-        state["obe"]["utils"]["string"].get_or_create<sol::table>();
-        state["obe"]["utils"]["vector"].get_or_create<sol::table>();
-        state["vili"]["utils"]["string"].get_or_create<sol::table>();
-        state["obe"]["animation"]["schemas"].get_or_create<sol::table>();
-        state["obe"]["system"]["constraints"].get_or_create<sol::table>();
-        state["obe"]["system"]["prefixes"].get_or_create<sol::table>();
-        state["obe"]["system"]["priorities"].get_or_create<sol::table>();
-        state["obe"]["utils"]["argparser"]["exceptions"].get_or_create<sol::table>();
-        state["obe"]["system"]["project"]["Prefixes"].get_or_create<sol::table>();
-
-        obe::system::bindings::load_class_mountable_path(state);
-        obe::system::bindings::load_class_find_result(state);
-        obe::system::bindings::load_class_path(state);
-        obe::bindings::load_class_base_exception(state);
-        obe::bindings::load_class_debug_info(state);
-        obe::bindings::load_function_get_type_name(state);
-        obe::bindings::load_function_init_engine(state);
-        obe::animation::bindings::load_class_animation(state);
-        obe::animation::bindings::load_class_animation_group(state);
-        obe::animation::bindings::load_class_animation_state(state);
-        obe::animation::bindings::load_class_animator(state);
-        obe::animation::bindings::load_class_animator_state(state);
-        obe::animation::bindings::load_class_color_tweening(state);
-        obe::animation::bindings::load_class_unit_vector_tweening(state);
-        obe::animation::bindings::load_class_rect_tweening(state);
-        obe::animation::bindings::load_class_trajectory_tweening(state);
-        obe::animation::bindings::load_class_int_tweening(state);
-        obe::animation::bindings::load_class_double_tweening(state);
-        obe::animation::bindings::load_enum_animation_play_mode(state);
-        obe::animation::bindings::load_enum_animation_command(state);
-        obe::animation::bindings::load_enum_animation_status(state);
-        obe::animation::bindings::load_enum_animator_target_scale_mode(state);
-        obe::animation::bindings::load_function_template_specialization_exists_impl(state);
-        obe::animation::bindings::load_function_tween(state);
-        obe::audio::bindings::load_class_audio_manager(state);
-        obe::audio::bindings::load_class_sound(state);
-        obe::audio::bindings::load_class_sound_handle(state);
-        obe::audio::bindings::load_enum_load_policy(state);
-        obe::audio::bindings::load_enum_sound_status(state);
-        obe::collision::bindings::load_class_capsule_collider(state);
-        obe::collision::bindings::load_class_circle_collider(state);
-        obe::collision::bindings::load_class_collider(state);
-        obe::collision::bindings::load_class_collider_component(state);
-        obe::collision::bindings::load_class_collision_data(state);
-        obe::collision::bindings::load_class_collision_space(state);
-        obe::collision::bindings::load_class_complex_polygon_collider(state);
-        obe::collision::bindings::load_class_polygon_collider(state);
-        obe::collision::bindings::load_class_quadtree(state);
-        obe::collision::bindings::load_class_rectangle_collider(state);
-        obe::collision::bindings::load_class_trajectory(state);
-        obe::collision::bindings::load_class_trajectory_node(state);
-        obe::collision::bindings::load_class_collision_rejection_pair(state);
-        obe::collision::bindings::load_enum_collider_type(state);
-        obe::collision::bindings::load_function_collider_type_to_c2type(state);
-        obe::component::bindings::load_class_component_base(state);
-        obe::config::bindings::load_class_configuration_manager(state);
-        obe::config::bindings::load_class_version(state);
-        obe::engine::bindings::load_class_engine(state);
-        obe::engine::bindings::load_class_resource_managed_object(state);
-        obe::engine::bindings::load_class_resource_manager(state);
-        obe::event::bindings::load_class_callback_scheduler(state);
-        obe::event::bindings::load_class_event_base(state);
-        obe::event::bindings::load_class_event_group(state);
-        obe::event::bindings::load_class_event_group_view(state);
-        obe::event::bindings::load_class_event_manager(state);
-        obe::event::bindings::load_class_event_namespace(state);
-        obe::event::bindings::load_class_event_namespace_view(state);
-        obe::event::bindings::load_class_lua_event_listener(state);
-        obe::event::bindings::load_enum_callback_scheduler_state(state);
-        obe::event::bindings::load_enum_listener_change_state(state);
-        obe::graphics::bindings::load_class_color(state);
-        obe::graphics::bindings::load_class_editor_sprite(state);
-        obe::graphics::bindings::load_class_font(state);
-        obe::graphics::bindings::load_class_nine_patch(state);
-        obe::graphics::bindings::load_class_position_transformer(state);
-        obe::graphics::bindings::load_class_render_target(state);
-        obe::graphics::bindings::load_class_renderable(state);
-        obe::graphics::bindings::load_class_rich_text(state);
-        obe::graphics::bindings::load_class_shader(state);
-        obe::graphics::bindings::load_class_sprite(state);
-        obe::graphics::bindings::load_class_sprite_handle_point(state);
-        obe::graphics::bindings::load_class_spritesheet(state);
-        obe::graphics::bindings::load_class_svg_texture(state);
-        obe::graphics::bindings::load_class_text(state);
-        obe::graphics::bindings::load_class_texture(state);
-        obe::graphics::bindings::load_class_texture_part(state);
-        obe::graphics::bindings::load_class_hsv(state);
-        obe::graphics::bindings::load_enum_color_type(state);
-        obe::graphics::bindings::load_enum_sprite_handle_point_type(state);
-        obe::graphics::bindings::load_function_init_position_transformers(state);
-        obe::graphics::bindings::load_function_make_null_texture(state);
-        obe::graphics::bindings::load_global_transformers(state);
-        obe::graphics::bindings::load_global_parallax(state);
-        obe::graphics::bindings::load_global_camera(state);
-        obe::graphics::bindings::load_global_position(state);
-        obe::graphics::canvas::bindings::load_class_bezier(state);
-        obe::graphics::canvas::bindings::load_class_canvas(state);
-        obe::graphics::canvas::bindings::load_class_canvas_element(state);
-        obe::graphics::canvas::bindings::load_class_canvas_positionable(state);
-        obe::graphics::canvas::bindings::load_class_circle(state);
-        obe::graphics::canvas::bindings::load_class_line(state);
-        obe::graphics::canvas::bindings::load_class_nine_patch(state);
-        obe::graphics::canvas::bindings::load_class_polygon(state);
-        obe::graphics::canvas::bindings::load_class_rectangle(state);
-        obe::graphics::canvas::bindings::load_class_text(state);
-        obe::graphics::canvas::bindings::load_enum_canvas_element_type(state);
-        obe::graphics::canvas::bindings::load_enum_text_horizontal_align(state);
-        obe::graphics::canvas::bindings::load_enum_text_vertical_align(state);
-        obe::graphics::shapes::bindings::load_class_circle(state);
-        obe::graphics::shapes::bindings::load_class_nine_patch(state);
-        obe::graphics::shapes::bindings::load_class_polygon(state);
-        obe::graphics::shapes::bindings::load_class_rectangle(state);
-        obe::graphics::shapes::bindings::load_class_text(state);
-        obe::input::bindings::load_class_input_action(state);
-        obe::input::bindings::load_class_input_button_monitor(state);
-        obe::input::bindings::load_class_input_condition(state);
-        obe::input::bindings::load_class_input_manager(state);
-        obe::input::bindings::load_class_input_source(state);
-        obe::input::bindings::load_class_input_source_gamepad_axis(state);
-        obe::input::bindings::load_class_input_source_gamepad_button(state);
-        obe::input::bindings::load_class_input_source_keyboard_key(state);
-        obe::input::bindings::load_class_input_source_mouse_button(state);
-        obe::input::bindings::load_class_input_source_mouse_wheel_scroll(state);
-        obe::input::bindings::load_enum_axis_threshold_direction(state);
-        obe::input::bindings::load_enum_mouse_wheel_scroll_direction(state);
-        obe::input::bindings::load_enum_input_source_state(state);
-        obe::input::bindings::load_enum_input_type(state);
-        obe::network::bindings::load_class_lua_packet(state);
-        obe::network::bindings::load_class_network_client(state);
-        obe::network::bindings::load_class_network_event_manager(state);
-        obe::network::bindings::load_class_tcp_server(state);
-        obe::network::bindings::load_class_tcp_socket(state);
-        obe::scene::bindings::load_class_camera(state);
-        obe::scene::bindings::load_class_scene(state);
-        obe::scene::bindings::load_class_scene_node(state);
-        obe::scene::bindings::load_class_scene_render_options(state);
-        obe::script::bindings::load_class_dummy_cast(state);
-        obe::script::bindings::load_class_game_object(state);
-        obe::script::bindings::load_class_game_object_database(state);
-        obe::script::bindings::load_class_lua_state(state);
-        obe::script::bindings::load_enum_environment_target(state);
-        obe::script::bindings::load_function_cast(state);
-        obe::script::bindings::load_function_sol_call_status_to_string(state);
-        obe::script::bindings::load_function_safe_lua_call(state);
-        obe::system::bindings::load_class_contextual_path_factory(state);
-        obe::system::bindings::load_class_cursor(state);
-        obe::system::bindings::load_class_cursor_model(state);
-        obe::system::bindings::load_class_plugin(state);
-        obe::system::bindings::load_class_window(state);
-        obe::system::bindings::load_enum_cursor_type(state);
-        obe::system::bindings::load_enum_mountable_path_type(state);
-        obe::system::bindings::load_enum_same_prefix_policy(state);
-        obe::system::bindings::load_enum_path_type(state);
-        obe::system::bindings::load_enum_window_context(state);
-        obe::system::bindings::load_enum_stretch_mode(state);
-        obe::system::bindings::load_enum_window_size(state);
-        obe::system::bindings::load_enum_render_size(state);
-        obe::system::bindings::load_function_split_path_and_prefix(state);
-        obe::system::project::bindings::load_class_project(state);
-        obe::system::project::bindings::load_class_project_ur_ls(state);
-        obe::system::project::bindings::load_function_get_project_location(state);
-        obe::system::project::bindings::load_function_project_exists(state);
-        obe::system::project::bindings::load_function_load(state);
-        obe::system::project::bindings::load_function_list_projects(state);
-        obe::tiles::bindings::load_class_animated_tile(state);
-        obe::tiles::bindings::load_class_tile_layer(state);
-        obe::tiles::bindings::load_class_tile_scene(state);
-        obe::tiles::bindings::load_class_tileset(state);
-        obe::tiles::bindings::load_class_tileset_collection(state);
-        obe::tiles::bindings::load_class_texture_quads_index(state);
-        obe::tiles::bindings::load_class_tile_info(state);
-        obe::tiles::bindings::load_function_get_tile_info(state);
-        obe::tiles::bindings::load_function_strip_tile_flags(state);
-        obe::tiles::bindings::load_function_apply_texture_quads_transforms(state);
-        obe::time::bindings::load_class_chronometer(state);
-        obe::time::bindings::load_class_framerate_counter(state);
-        obe::time::bindings::load_class_framerate_manager(state);
-        obe::time::bindings::load_function_epoch(state);
-        obe::time::bindings::load_global_seconds(state);
-        obe::time::bindings::load_global_milliseconds(state);
-        obe::time::bindings::load_global_microseconds(state);
-        obe::time::bindings::load_global_minutes(state);
-        obe::time::bindings::load_global_hours(state);
-        obe::time::bindings::load_global_days(state);
-        obe::time::bindings::load_global_weeks(state);
-        obe::transform::bindings::load_class_aabb(state);
-        obe::transform::bindings::load_class_matrix2_d(state);
-        obe::transform::bindings::load_class_movable(state);
-        obe::transform::bindings::load_class_polygon(state);
-        obe::transform::bindings::load_class_polygon_point(state);
-        obe::transform::bindings::load_class_polygon_segment(state);
-        obe::transform::bindings::load_class_rect(state);
-        obe::transform::bindings::load_class_referential(state);
-        obe::transform::bindings::load_class_unit_based_object(state);
-        obe::transform::bindings::load_class_unit_vector(state);
-        obe::transform::bindings::load_class_screen_struct(state);
-        obe::transform::bindings::load_class_view_struct(state);
-        obe::transform::bindings::load_enum_referential_conversion_type(state);
-        obe::transform::bindings::load_enum_flip_axis(state);
-        obe::transform::bindings::load_enum_units(state);
-        obe::transform::bindings::load_enum_relative_position_from(state);
-        obe::types::bindings::load_class_identifiable(state);
-        obe::types::bindings::load_class_protected_identifiable(state);
-        obe::types::bindings::load_class_selectable(state);
-        obe::types::bindings::load_class_serializable(state);
-        obe::types::bindings::load_class_togglable(state);
-        obe::types::bindings::load_class_unique_identifiable(state);
-        obe::types::bindings::load_class_unknown_enum_entry(state);
-        obe::utils::argparser::exceptions::bindings::load_class_invalid_argument_format(state);
-        obe::utils::exec::bindings::load_class_run_args_parser(state);
-        vili::bindings::load_class_const_node_iterator(state);
-        vili::bindings::load_class_node(state);
-        vili::bindings::load_class_node_iterator(state);
-        vili::bindings::load_enum_node_type(state);
-        vili::bindings::load_function_from_string(state);
-        vili::bindings::load_function_to_string(state);
-        vili::bindings::load_global_permissive_cast(state);
-        vili::bindings::load_global_verbose_exceptions(state);
-        vili::bindings::load_global_true_value(state);
-        vili::bindings::load_global_false_value(state);
-        vili::bindings::load_global_null_typename(state);
-        vili::bindings::load_global_boolean_typename(state);
-        vili::bindings::load_global_integer_typename(state);
-        vili::bindings::load_global_number_typename(state);
-        vili::bindings::load_global_string_typename(state);
-        vili::bindings::load_global_object_typename(state);
-        vili::bindings::load_global_array_typename(state);
-        vili::bindings::load_global_unknown_typename(state);
-        vili::bindings::load_global_container_typename(state);
-        vili::parser::bindings::load_class_node_in_stack(state);
-        vili::parser::bindings::load_class_state(state);
-        vili::parser::bindings::load_function_from_string(state);
-        vili::parser::bindings::load_function_from_file(state);
-        obe::debug::render::bindings::load_class_collider_render_options(state);
-        obe::debug::render::bindings::load_function_draw_polygon(state);
-        obe::debug::render::bindings::load_function_draw_collider(state);
-        obe::events::Actions::bindings::load_class_action(state);
-        obe::events::Cursor::bindings::load_class_hold(state);
-        obe::events::Cursor::bindings::load_class_move(state);
-        obe::events::Cursor::bindings::load_class_press(state);
-        obe::events::Cursor::bindings::load_class_release(state);
-        obe::events::Game::bindings::load_class_end(state);
-        obe::events::Game::bindings::load_class_render(state);
-        obe::events::Game::bindings::load_class_start(state);
-        obe::events::Game::bindings::load_class_update(state);
-        obe::events::Input::bindings::load_class_text_entered(state);
-        obe::events::Keys::bindings::load_class_pressed(state);
-        obe::events::Keys::bindings::load_class_state_changed(state);
-        obe::events::Network::bindings::load_class_client_rename(state);
-        obe::events::Network::bindings::load_class_connected(state);
-        obe::events::Network::bindings::load_class_disconnected(state);
-        obe::events::Network::bindings::load_class_message(state);
-        obe::events::Scene::bindings::load_class_loaded(state);
-        obe::graphics::utils::bindings::load_class_draw_polygon_options(state);
-        obe::graphics::utils::bindings::load_function_draw_point(state);
-        obe::graphics::utils::bindings::load_function_draw_line(state);
-        obe::graphics::utils::bindings::load_function_draw_polygon(state);
-        vili::parser::rules::bindings::load_class_affectation(state);
-        vili::parser::rules::bindings::load_class_affectation_separator(state);
-        vili::parser::rules::bindings::load_class_array(state);
-        vili::parser::rules::bindings::load_class_array_elements(state);
-        vili::parser::rules::bindings::load_class_array_separator(state);
-        vili::parser::rules::bindings::load_class_block(state);
-        vili::parser::rules::bindings::load_class_boolean(state);
-        vili::parser::rules::bindings::load_class_brace_based_object(state);
-        vili::parser::rules::bindings::load_class_char_(state);
-        vili::parser::rules::bindings::load_class_close_array(state);
-        vili::parser::rules::bindings::load_class_close_object(state);
-        vili::parser::rules::bindings::load_class_comment(state);
-        vili::parser::rules::bindings::load_class_data(state);
-        vili::parser::rules::bindings::load_class_digits(state);
-        vili::parser::rules::bindings::load_class_element(state);
-        vili::parser::rules::bindings::load_class_empty_line(state);
-        vili::parser::rules::bindings::load_class_endline(state);
-        vili::parser::rules::bindings::load_class_escaped(state);
-        vili::parser::rules::bindings::load_class_escaped_char(state);
-        vili::parser::rules::bindings::load_class_false_(state);
-        vili::parser::rules::bindings::load_class_floating_point(state);
-        vili::parser::rules::bindings::load_class_full_node(state);
-        vili::parser::rules::bindings::load_class_grammar(state);
-        vili::parser::rules::bindings::load_class_identifier(state);
-        vili::parser::rules::bindings::load_class_indent(state);
-        vili::parser::rules::bindings::load_class_indent_based_object(state);
-        vili::parser::rules::bindings::load_class_inline_comment(state);
-        vili::parser::rules::bindings::load_class_inline_element(state);
-        vili::parser::rules::bindings::load_class_inline_node(state);
-        vili::parser::rules::bindings::load_class_integer(state);
-        vili::parser::rules::bindings::load_class_multiline_comment(state);
-        vili::parser::rules::bindings::load_class_multiline_comment_block(state);
-        vili::parser::rules::bindings::load_class_node(state);
-        vili::parser::rules::bindings::load_class_number(state);
-        vili::parser::rules::bindings::load_class_object(state);
-        vili::parser::rules::bindings::load_class_object_elements(state);
-        vili::parser::rules::bindings::load_class_object_separator(state);
-        vili::parser::rules::bindings::load_class_open_array(state);
-        vili::parser::rules::bindings::load_class_open_object(state);
-        vili::parser::rules::bindings::load_class_sign(state);
-        vili::parser::rules::bindings::load_class_space_or_comment(state);
-        vili::parser::rules::bindings::load_class_string(state);
-        vili::parser::rules::bindings::load_class_string_content(state);
-        vili::parser::rules::bindings::load_class_string_delimiter(state);
-        vili::parser::rules::bindings::load_class_true_(state);
-        vili::parser::rules::bindings::load_class_unescaped(state);
-        vili::parser::rules::bindings::load_class_unicode(state);
-        vili::parser::rules::bindings::load_class_vili_grammar(state);
-        vili::parser::rules::bindings::load_class_xdigit(state);
-        vili::writer::bindings::load_class_dump_options(state);
-        vili::writer::bindings::load_class__array(state);
-        vili::writer::bindings::load_class__items_per_line(state);
-        vili::writer::bindings::load_class__object(state);
-        vili::writer::bindings::load_class_dump_state(state);
-        vili::writer::bindings::load_enum_delimiter_newline_policy(state);
-        vili::writer::bindings::load_enum_object_style(state);
-        vili::writer::bindings::load_function_dump_integer(state);
-        vili::writer::bindings::load_function_dump_number(state);
-        vili::writer::bindings::load_function_dump_boolean(state);
-        vili::writer::bindings::load_function_dump_string(state);
-        vili::writer::bindings::load_function_dump_array(state);
-        vili::writer::bindings::load_function_dump_object(state);
-        vili::writer::bindings::load_function_dump(state);
-        obe::animation::easing::bindings::load_enum_easing_type(state);
-        obe::animation::easing::bindings::load_function_linear(state);
-        obe::animation::easing::bindings::load_function_in_sine(state);
-        obe::animation::easing::bindings::load_function_out_sine(state);
-        obe::animation::easing::bindings::load_function_in_out_sine(state);
-        obe::animation::easing::bindings::load_function_in_quad(state);
-        obe::animation::easing::bindings::load_function_out_quad(state);
-        obe::animation::easing::bindings::load_function_in_out_quad(state);
-        obe::animation::easing::bindings::load_function_in_cubic(state);
-        obe::animation::easing::bindings::load_function_out_cubic(state);
-        obe::animation::easing::bindings::load_function_in_out_cubic(state);
-        obe::animation::easing::bindings::load_function_in_quart(state);
-        obe::animation::easing::bindings::load_function_out_quart(state);
-        obe::animation::easing::bindings::load_function_in_out_quart(state);
-        obe::animation::easing::bindings::load_function_in_quint(state);
-        obe::animation::easing::bindings::load_function_out_quint(state);
-        obe::animation::easing::bindings::load_function_in_out_quint(state);
-        obe::animation::easing::bindings::load_function_in_expo(state);
-        obe::animation::easing::bindings::load_function_out_expo(state);
-        obe::animation::easing::bindings::load_function_in_out_expo(state);
-        obe::animation::easing::bindings::load_function_in_circ(state);
-        obe::animation::easing::bindings::load_function_out_circ(state);
-        obe::animation::easing::bindings::load_function_in_out_circ(state);
-        obe::animation::easing::bindings::load_function_in_back(state);
-        obe::animation::easing::bindings::load_function_out_back(state);
-        obe::animation::easing::bindings::load_function_in_out_back(state);
-        obe::animation::easing::bindings::load_function_in_elastic(state);
-        obe::animation::easing::bindings::load_function_out_elastic(state);
-        obe::animation::easing::bindings::load_function_in_out_elastic(state);
-        obe::animation::easing::bindings::load_function_in_bounce(state);
-        obe::animation::easing::bindings::load_function_out_bounce(state);
-        obe::animation::easing::bindings::load_function_in_out_bounce(state);
-        obe::animation::easing::bindings::load_function_get(state);
-        obe::debug::bindings::load_enum_log_level(state);
-        obe::debug::bindings::load_function_init_logger(state);
-        obe::debug::bindings::load_function_trace(state);
-        obe::debug::bindings::load_function_debug(state);
-        obe::debug::bindings::load_function_info(state);
-        obe::debug::bindings::load_function_warn(state);
-        obe::debug::bindings::load_function_error(state);
-        obe::debug::bindings::load_function_critical(state);
-        obe::debug::bindings::load_global_log(state);
-        obe::bindings::bindings::load_function_index_core_bindings(state);
-        obe::config::validators::bindings::load_function_animation_validator(state);
-        obe::config::validators::bindings::load_function_config_validator(state);
-        obe::config::validators::bindings::load_function_mount_validator(state);
-        obe::config::validators::bindings::load_function_project_validator(state);
-        obe::script::Helpers::bindings::load_function_make_all_helpers(state);
-        obe::script::Helpers::bindings::load_function_fetch_from_one_of(state);
-        obe::script::Helpers::bindings::load_function_rawget_from(state);
-        obe::script::Helpers::bindings::load_function_len_from(state);
-        obe::script::Helpers::bindings::load_function_pairs_from(state);
-        obe::script::vili_lua_bridge::bindings::load_function_vili_to_lua(state);
-        obe::script::vili_lua_bridge::bindings::load_function_lua_to_vili(state);
-        obe::script::vili_lua_bridge::bindings::load_function_vili_object_to_lua_table(state);
-        obe::script::vili_lua_bridge::bindings::load_function_vili_primitive_to_lua_value(state);
-        obe::script::vili_lua_bridge::bindings::load_function_vili_array_to_lua_table(state);
-        obe::script::vili_lua_bridge::bindings::load_function_lua_table_to_vili_object(state);
-        obe::script::vili_lua_bridge::bindings::load_function_lua_value_to_vili_primitive(state);
-        obe::script::vili_lua_bridge::bindings::load_function_lua_table_to_vili_array(state);
-        obe::system::package::bindings::load_function_get_package_location(state);
-        obe::system::package::bindings::load_function_package_exists(state);
-        obe::system::package::bindings::load_function_list_packages(state);
-        obe::system::package::bindings::load_function_install(state);
-        obe::system::package::bindings::load_function_load(state);
-        obe::utils::argparser::bindings::load_function_parse_args(state);
-        obe::utils::base64::bindings::load_function_encode(state);
-        obe::utils::base64::bindings::load_function_decode(state);
-        obe::utils::base64::bindings::load_global_base64_chars(state);
-        obe::utils::file::bindings::load_function_get_directory_list(state);
-        obe::utils::file::bindings::load_function_get_file_list(state);
-        obe::utils::file::bindings::load_function_file_exists(state);
-        obe::utils::file::bindings::load_function_directory_exists(state);
-        obe::utils::file::bindings::load_function_create_directory(state);
-        obe::utils::file::bindings::load_function_create_file(state);
-        obe::utils::file::bindings::load_function_copy(state);
-        obe::utils::file::bindings::load_function_delete_file(state);
-        obe::utils::file::bindings::load_function_delete_directory(state);
-        obe::utils::file::bindings::load_function_get_current_directory(state);
-        obe::utils::file::bindings::load_function_separator(state);
-        obe::utils::file::bindings::load_function_get_executable_directory(state);
-        obe::utils::file::bindings::load_function_get_executable_path(state);
-        obe::utils::file::bindings::load_function_normalize_path(state);
-        obe::utils::file::bindings::load_function_canonical_path(state);
-        obe::utils::file::bindings::load_function_join(state);
-        obe::utils::math::bindings::load_function_randint(state);
-        obe::utils::math::bindings::load_function_randfloat(state);
-        obe::utils::math::bindings::load_function_get_min(state);
-        obe::utils::math::bindings::load_function_get_max(state);
-        obe::utils::math::bindings::load_function_is_between(state);
-        obe::utils::math::bindings::load_function_is_double_int(state);
-        obe::utils::math::bindings::load_function_sign(state);
-        obe::utils::math::bindings::load_function_convert_to_radian(state);
-        obe::utils::math::bindings::load_function_convert_to_degrees(state);
-        obe::utils::math::bindings::load_function_normalize(state);
-        obe::utils::math::bindings::load_global_pi(state);
-        obe::utils::string::bindings::load_function_split(state);
-        obe::utils::string::bindings::load_function_occurences_in_string(state);
-        obe::utils::string::bindings::load_function_is_string_alpha(state);
-        obe::utils::string::bindings::load_function_is_string_alpha_numeric(state);
-        obe::utils::string::bindings::load_function_is_string_numeric(state);
-        obe::utils::string::bindings::load_function_is_string_int(state);
-        obe::utils::string::bindings::load_function_is_string_float(state);
-        obe::utils::string::bindings::load_function_replace(state);
-        obe::utils::string::bindings::load_function_is_surrounded_by(state);
-        obe::utils::string::bindings::load_function_get_random_key(state);
-        obe::utils::string::bindings::load_function_contains(state);
-        obe::utils::string::bindings::load_function_starts_with(state);
-        obe::utils::string::bindings::load_function_ends_with(state);
-        obe::utils::string::bindings::load_function_distance(state);
-        obe::utils::string::bindings::load_function_sort_by_distance(state);
-        obe::utils::string::bindings::load_function_quote(state);
-        obe::utils::string::bindings::load_function_titleize(state);
-        obe::utils::string::bindings::load_global_alphabet(state);
-        obe::utils::string::bindings::load_global_numbers(state);
-        obe::utils::vector::bindings::load_function_contains(state);
-        obe::utils::vector::bindings::load_function_join(state);
-        vili::msgpack::bindings::load_function_from_string(state);
-        vili::msgpack::bindings::load_function_to_string(state);
-        vili::msgpack::bindings::load_function_dump_element(state);
-        vili::utils::string::bindings::load_function_replace(state);
-        vili::utils::string::bindings::load_function_is_int(state);
-        vili::utils::string::bindings::load_function_is_float(state);
-        vili::utils::string::bindings::load_function_truncate_float(state);
-        vili::utils::string::bindings::load_function_quote(state);
-        vili::utils::string::bindings::load_function_to_double(state);
-        vili::utils::string::bindings::load_function_to_long(state);
-        vili::utils::string::bindings::load_function_indent(state);
-        vili::utils::string::bindings::load_function_distance(state);
-        vili::utils::string::bindings::load_function_sort_by_distance(state);
-        obe::animation::schemas::bindings::load_global_animation_schema_str(state);
-        obe::animation::schemas::bindings::load_global_animation_schema(state);
-        obe::system::constraints::bindings::load_global_default(state);
-        obe::system::prefixes::bindings::load_global_obe(state);
-        obe::system::prefixes::bindings::load_global_cwd(state);
-        obe::system::prefixes::bindings::load_global_exe(state);
-        obe::system::prefixes::bindings::load_global_cfg(state);
-        obe::system::prefixes::bindings::load_global_mount(state);
-        obe::system::prefixes::bindings::load_global_extlibs(state);
-        obe::system::prefixes::bindings::load_global_root(state);
-        obe::system::prefixes::bindings::load_global_game(state);
-        obe::system::priorities::bindings::load_global_high(state);
-        obe::system::priorities::bindings::load_global_projectmount(state);
-        obe::system::priorities::bindings::load_global_project(state);
-        obe::system::priorities::bindings::load_global_mount(state);
-        obe::system::priorities::bindings::load_global_defaults(state);
-        obe::system::priorities::bindings::load_global_low(state);
-        obe::system::project::Prefixes::bindings::load_global_objects(state);
-        obe::system::project::Prefixes::bindings::load_global_scenes(state);
+        if (loading == BindingsLoading::Eager)
+        {
+            for (const BindingsGroup& group : Groups)
+            {
+                load_group(state, group);
+            }
+            return;
+        }
+
+        lua_State* L = state.lua_state();
+        set_namespace_loader(L, "obe", &index_obe_namespace);
+        set_namespace_loader(L, "vili", &index_vili_namespace);
+        lua_createtable(L, 0, 1);
+        lua_pushcfunction(L, &hook_usertype_metatables);
+        lua_setfield(L, -2, "__newindex");
+        lua_setmetatable(L, LUA_REGISTRYINDEX);
+
+        // Needed by every script, obe.system also installs require
+        load_group(state, *find_group("obe"));
+        load_group(state, *find_group("obe.system"));
+        // Global normally defined with the obe.script namespace
+        script::run_script_file(state, "obe://Lib/Internal/Cast.lua"_fs);
     }
-}
\ No newline at end of file
+}
@@ -173,6 +173,8 @@ namespace obe::animation::bindings
                 return self->set_target(sprite, target_scale_mode);
             });
         bind_animator["get_filesystem_path"] = &obe::animation::Animator::get_filesystem_path;
+        bind_animator["set_anti_aliasing"] = &obe::animation::Animator::set_anti_aliasing;
+        bind_animator["is_anti_aliased"] = &obe::animation::Animator::is_anti_aliased;
         bind_animator["make_state"] = &obe::animation::Animator::make_state;
     }
     void load_class_animator_state(sol::state_view state)
@@ -181,9 +183,18 @@ namespace obe::animation::bindings
         sol::usertype<obe::animation::AnimatorState> bind_animator_state
             = animation_namespace.new_usertype<obe::animation::AnimatorState>("AnimatorState",
                 sol::call_constructor,
-                sol::constructors<obe::animation::AnimatorState(
-                    const obe::animation::Animator&)>());
-        bind_animator_state["load"] = &obe::animation::AnimatorState::load;
+                sol::constructors<obe::animation::AnimatorState(),
+                    obe::animation::AnimatorState(const obe::animation::Animator&)>());
+        bind_animator_state["load"] = sol::overload(
+            static_cast<void (obe::animation::AnimatorState::*)()>(
+                &obe::animation::AnimatorState::load),
+            [](obe::animation::AnimatorState* self, obe::system::Path path) -> void {
+                return self->load(path);
+            },
+            [](obe::animation::AnimatorState* self, obe::system::Path path,
+                obe::engine::ResourceManager* resources) -> void {
+                return self->load(path, resources);
+            });
         bind_animator_state["get_current_animation_name"]
             = &obe::animation::AnimatorState::get_current_animation_name;
         bind_animator_state["set_animation"] = &obe::animation::AnimatorState::set_animation;
@@ -203,10 +214,10 @@ namespace obe::animation::bindings
             = &obe::animation::AnimatorState::get_current_animation;
         bind_animator_state["get_current_texture"]
             = &obe::animation::AnimatorState::get_current_texture;
-        bind_animator_state["get_animator"]
-            = [](obe::animation::AnimatorState* self) -> const obe::animation::Animator* {
-            return &self->get_animator();
-        };
+        bind_animator_state["get_all_animations_names"]
+            = &obe::animation::AnimatorState::get_all_animations_names;
+        bind_animator_state["get_filesystem_path"]
+            = &obe::animation::AnimatorState::get_filesystem_path;
     }
     void load_class_color_tweening(sol::state_view state)
     {
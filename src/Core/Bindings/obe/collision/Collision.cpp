@@ -72,6 +72,8 @@ namespace obe::collision::bindings
         bind_collider["get_collider_type"] = &obe::collision::Collider::get_collider_type;
         bind_collider["set_tag"] = &obe::collision::Collider::set_tag;
         bind_collider["get_tag"] = &obe::collision::Collider::get_tag;
+        bind_collider["get_layer"] = &obe::collision::Collider::get_layer;
+        bind_collider["get_collision_space"] = &obe::collision::Collider::get_collision_space;
         bind_collider["collides"] = &obe::collision::Collider::collides;
         bind_collider["get_offset_before_collision"] = sol::overload(
             [](obe::collision::Collider* self,
@@ -87,6 +89,18 @@ namespace obe::collision::bindings
                 const obe::transform::UnitVector& other_offset) -> obe::transform::UnitVector {
                 return self->get_offset_before_collision(collider, self_offset, other_offset);
             });
+        bind_collider["sweep"] = sol::overload(
+            [](obe::collision::Collider* self, const obe::collision::Collider& collider,
+                const obe::transform::UnitVector& self_offset)
+                -> std::optional<obe::collision::SweepHit> {
+                return self->sweep(collider, self_offset);
+            },
+            [](obe::collision::Collider* self, const obe::collision::Collider& collider,
+                const obe::transform::UnitVector& self_offset,
+                const obe::transform::UnitVector& other_offset)
+                -> std::optional<obe::collision::SweepHit> {
+                return self->sweep(collider, self_offset, other_offset);
+            });
         bind_collider["get_bounding_box"] = &obe::collision::Collider::get_bounding_box;
         bind_collider["copy"] = &obe::collision::Collider::copy;
     }
@@ -145,12 +159,25 @@ namespace obe::collision::bindings
         bind_collision_data["colliders"] = &obe::collision::CollisionData::colliders;
         bind_collision_data["offset"] = &obe::collision::CollisionData::offset;
     }
+    void load_class_sweep_hit(sol::state_view state)
+    {
+        sol::table collision_namespace = state["obe"]["collision"].get<sol::table>();
+        sol::usertype<obe::collision::SweepHit> bind_sweep_hit
+            = collision_namespace.new_usertype<obe::collision::SweepHit>(
+                "SweepHit", sol::call_constructor, sol::default_constructor);
+        bind_sweep_hit["collider"] = &obe::collision::SweepHit::collider;
+        bind_sweep_hit["toi"] = &obe::collision::SweepHit::toi;
+        bind_sweep_hit["normal"] = &obe::collision::SweepHit::normal;
+        bind_sweep_hit["offset"] = &obe::collision::SweepHit::offset;
+    }
     void load_class_collision_space(sol::state_view state)
     {
         sol::table collision_namespace = state["obe"]["collision"].get<sol::table>();
         sol::usertype<obe::collision::CollisionSpace> bind_collision_space
             = collision_namespace.new_usertype<obe::collision::CollisionSpace>("CollisionSpace",
-                sol::call_constructor, sol::constructors<obe::collision::CollisionSpace()>());
+                sol::call_constructor,
+                sol::constructors<obe::collision::CollisionSpace(),
+                    obe::collision::CollisionSpace(obe::event::EventGroupPtr)>());
         bind_collision_space["add_collider"] = &obe::collision::CollisionSpace::add_collider;
         bind_collision_space["get_collider_amount"]
             = &obe::collision::CollisionSpace::get_collider_amount;
@@ -191,6 +218,12 @@ namespace obe::collision::bindings
                 -> std::vector<obe::collision::ReachableCollider> {
                 return self->get_reachable_colliders(collider, offset);
             });*/
+        bind_collision_space["sweep"] = &obe::collision::CollisionSpace::sweep;
+        bind_collision_space["find_collisions"] = &obe::collision::CollisionSpace::find_collisions;
+        bind_collision_space["step"] = &obe::collision::CollisionSpace::step;
+        bind_collision_space["get_collisions"] = &obe::collision::CollisionSpace::get_collisions;
+        bind_collision_space["has_collision_listeners"]
+            = &obe::collision::CollisionSpace::has_collision_listeners;
         bind_collision_space["add_tag_to_blacklist"]
             = &obe::collision::CollisionSpace::add_tag_to_blacklist;
         bind_collision_space["remove_tag_to_blacklist"]
@@ -281,12 +314,21 @@ namespace obe::collision::bindings
         sol::usertype<obe::collision::Quadtree> bind_quadtree
             = collision_namespace.new_usertype<obe::collision::Quadtree>("Quadtree",
                 sol::call_constructor,
-                sol::constructors<obe::collision::Quadtree(const obe::transform::AABB&)>());
+                sol::constructors<obe::collision::Quadtree(const obe::transform::AABB&),
+                    obe::collision::Quadtree(const obe::transform::AABB&, std::size_t),
+                    obe::collision::Quadtree(
+                        const obe::transform::AABB&, std::size_t, std::size_t)>());
         bind_quadtree["clear"] = &obe::collision::Quadtree::clear;
         bind_quadtree["add"] = &obe::collision::Quadtree::add;
         bind_quadtree["remove"] = &obe::collision::Quadtree::remove;
+        bind_quadtree["update"] = &obe::collision::Quadtree::update;
+        bind_quadtree["contains"] = &obe::collision::Quadtree::contains;
+        bind_quadtree["get_threshold"] = &obe::collision::Quadtree::get_threshold;
+        bind_quadtree["get_max_depth"] = &obe::collision::Quadtree::get_max_depth;
         bind_quadtree["query"] = &obe::collision::Quadtree::query;
         bind_quadtree["find_all_intersections"] = &obe::collision::Quadtree::find_all_intersections;
+        bind_quadtree["DefaultThreshold"] = sol::var(&obe::collision::Quadtree::DefaultThreshold);
+        bind_quadtree["DefaultMaxDepth"] = sol::var(&obe::collision::Quadtree::DefaultMaxDepth);
     }
     void load_class_rectangle_collider(sol::state_view state)
     {
@@ -382,4 +424,9 @@ namespace obe::collision::bindings
         collision_namespace.set_function(
             "collider_type_to_c2type", &obe::collision::collider_type_to_c2type);
     }
+    void load_function_get_tag_layer(sol::state_view state)
+    {
+        sol::table collision_namespace = state["obe"]["collision"].get<sol::table>();
+        collision_namespace.set_function("get_tag_layer", &obe::collision::get_tag_layer);
+    }
 };
\ No newline at end of file
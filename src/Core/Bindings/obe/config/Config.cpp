@@ -1,5 +1,6 @@
 #include <Bindings/obe/config/Config.hpp>
 
+#include <Config/CompiledVili.hpp>
 #include <Config/Config.hpp>
 #include <Config/Version.hpp>
 
@@ -29,4 +30,20 @@ namespace obe::config::bindings
         bind_version["minor"] = &obe::config::Version::minor;
         bind_version["patch"] = &obe::config::Version::patch;
     }
+    void load_function_get_compiled_vili_path(sol::state_view state)
+    {
+        sol::table config_namespace = state["obe"]["config"].get<sol::table>();
+        config_namespace.set_function(
+            "get_compiled_vili_path", &obe::config::get_compiled_vili_path);
+    }
+    void load_function_load_vili_file(sol::state_view state)
+    {
+        sol::table config_namespace = state["obe"]["config"].get<sol::table>();
+        config_namespace.set_function("load_vili_file", &obe::config::load_vili_file);
+    }
+    void load_function_compile_vili_file(sol::state_view state)
+    {
+        sol::table config_namespace = state["obe"]["config"].get<sol::table>();
+        config_namespace.set_function("compile_vili_file", &obe::config::compile_vili_file);
+    }
 };
\ No newline at end of file
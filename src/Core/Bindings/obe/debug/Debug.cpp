@@ -1,11 +1,55 @@
 #include <Bindings/obe/debug/Debug.hpp>
 
 #include <Debug/Logger.hpp>
+#include <Debug/Profiler.hpp>
 
 #include <Bindings/Config.hpp>
 
 namespace obe::debug::bindings
 {
+    void load_class_profiler(sol::state_view state)
+    {
+        sol::table debug_namespace = state["obe"]["debug"].get<sol::table>();
+        sol::usertype<obe::debug::Profiler> bind_profiler
+            = debug_namespace.new_usertype<obe::debug::Profiler>(
+                "Profiler", sol::call_constructor, sol::default_constructor);
+        bind_profiler["set_enabled"] = &obe::debug::Profiler::set_enabled;
+        bind_profiler["is_enabled"] = &obe::debug::Profiler::is_enabled;
+        bind_profiler["next_frame"] = &obe::debug::Profiler::next_frame;
+        bind_profiler["begin_scope"] = sol::overload(
+            [](obe::debug::Profiler* self, const std::string& name) -> void {
+                return self->begin_scope(name);
+            },
+            [](obe::debug::Profiler* self, const std::string& name, const std::string& detail)
+                -> void { return self->begin_scope(name, detail); });
+        bind_profiler["end_scope"] = &obe::debug::Profiler::end_scope;
+        bind_profiler["get_last_frame_samples"]
+            = &obe::debug::Profiler::get_last_frame_samples;
+        bind_profiler["get_last_frame_duration"]
+            = &obe::debug::Profiler::get_last_frame_duration;
+        bind_profiler["get_last_frame_timings"]
+            = &obe::debug::Profiler::get_last_frame_timings;
+        bind_profiler["start_capture"] = sol::overload(
+            [](obe::debug::Profiler* self) -> void { return self->start_capture(); },
+            [](obe::debug::Profiler* self, std::size_t max_samples) -> void {
+                return self->start_capture(max_samples);
+            });
+        bind_profiler["stop_capture"] = &obe::debug::Profiler::stop_capture;
+        bind_profiler["is_capturing"] = &obe::debug::Profiler::is_capturing;
+        bind_profiler["save_chrome_trace"] = &obe::debug::Profiler::save_chrome_trace;
+    }
+    void load_class_profiler_sample(sol::state_view state)
+    {
+        sol::table debug_namespace = state["obe"]["debug"].get<sol::table>();
+        sol::usertype<obe::debug::ProfilerSample> bind_profiler_sample
+            = debug_namespace.new_usertype<obe::debug::ProfilerSample>(
+                "ProfilerSample", sol::call_constructor, sol::default_constructor);
+        bind_profiler_sample["name"] = &obe::debug::ProfilerSample::name;
+        bind_profiler_sample["detail"] = &obe::debug::ProfilerSample::detail;
+        bind_profiler_sample["start"] = &obe::debug::ProfilerSample::start;
+        bind_profiler_sample["duration"] = &obe::debug::ProfilerSample::duration;
+        bind_profiler_sample["depth"] = &obe::debug::ProfilerSample::depth;
+    }
     void load_enum_log_level(sol::state_view state)
     {
         sol::table debug_namespace = state["obe"]["debug"].get<sol::table>();
@@ -16,11 +60,41 @@ namespace obe::debug::bindings
                 { "Critical", obe::debug::LogLevel::Critical },
                 { "Off", obe::debug::LogLevel::Off } });
     }
+    void load_enum_log_overflow_policy(sol::state_view state)
+    {
+        sol::table debug_namespace = state["obe"]["debug"].get<sol::table>();
+        debug_namespace.new_enum<obe::debug::LogOverflowPolicy>("LogOverflowPolicy",
+            { { "Block", obe::debug::LogOverflowPolicy::Block },
+                { "Drop", obe::debug::LogOverflowPolicy::Drop } });
+    }
     void load_function_init_logger(sol::state_view state)
     {
         sol::table debug_namespace = state["obe"]["debug"].get<sol::table>();
         debug_namespace.set_function("init_logger", &obe::debug::init_logger);
     }
+    void load_function_enable_async_logging(sol::state_view state)
+    {
+        sol::table debug_namespace = state["obe"]["debug"].get<sol::table>();
+        debug_namespace.set_function("enable_async_logging",
+            sol::overload(
+                [](std::size_t queue_size) -> void {
+                    return obe::debug::enable_async_logging(queue_size);
+                },
+                [](std::size_t queue_size, obe::debug::LogOverflowPolicy overflow_policy) -> void {
+                    return obe::debug::enable_async_logging(queue_size, overflow_policy);
+                }));
+    }
+    void load_function_disable_async_logging(sol::state_view state)
+    {
+        sol::table debug_namespace = state["obe"]["debug"].get<sol::table>();
+        debug_namespace.set_function(
+            "disable_async_logging", &obe::debug::disable_async_logging);
+    }
+    void load_function_flush_logger(sol::state_view state)
+    {
+        sol::table debug_namespace = state["obe"]["debug"].get<sol::table>();
+        debug_namespace.set_function("flush_logger", &obe::debug::flush_logger);
+    }
     void load_function_trace(sol::state_view state)
     {
         sol::table debug_namespace = state["obe"]["debug"].get<sol::table>();
@@ -56,4 +130,9 @@ namespace obe::debug::bindings
         sol::table debug_namespace = state["obe"]["debug"].get<sol::table>();
         debug_namespace["Log"] = obe::debug::Log;
     }
+    void load_global_profile(sol::state_view state)
+    {
+        sol::table debug_namespace = state["obe"]["debug"].get<sol::table>();
+        debug_namespace["Profile"] = &obe::debug::Profile;
+    }
 };
\ No newline at end of file
@@ -25,6 +25,8 @@ namespace obe::engine::bindings
         bind_engine["Scene"] = sol::property(&obe::engine::Engine::get_scene);
         bind_engine["Cursor"] = sol::property(&obe::engine::Engine::get_cursor);
         bind_engine["Window"] = sol::property(&obe::engine::Engine::get_window);
+        bind_engine["GarbageCollector"]
+            = sol::property(&obe::engine::Engine::get_garbage_collector);
         bind_engine["get_arguments"] = &obe::engine::Engine::get_arguments;
     }
     void load_class_resource_managed_object(sol::state_view state)
@@ -52,6 +54,14 @@ namespace obe::engine::bindings
                 static_cast<const obe::graphics::Texture& (
                     obe::engine::ResourceManager::*)(const obe::system::Path&)>(
                     &obe::engine::ResourceManager::get_texture));
+        bind_resource_manager["get_texture_part"]
+            = sol::overload(static_cast<obe::graphics::TexturePart (
+                                obe::engine::ResourceManager::*)(const obe::system::Path&, bool)>(
+                                &obe::engine::ResourceManager::get_texture_part),
+                static_cast<obe::graphics::TexturePart (
+                    obe::engine::ResourceManager::*)(const obe::system::Path&)>(
+                    &obe::engine::ResourceManager::get_texture_part));
+        bind_resource_manager["save_atlas"] = &obe::engine::ResourceManager::save_atlas;
         bind_resource_manager["clean"] = &obe::engine::ResourceManager::clean;
         bind_resource_manager["default_anti_aliasing"]
             = &obe::engine::ResourceManager::default_anti_aliasing;
@@ -0,0 +1,29 @@
+#include <Bindings/obe/events/Collision/Collision.hpp>
+
+#include <Collision/CollisionSpace.hpp>
+
+#include <Bindings/Config.hpp>
+
+namespace obe::events::Collision::bindings
+{
+    void load_class_began(sol::state_view state)
+    {
+        sol::table Collision_namespace = state["obe"]["events"]["Collision"].get<sol::table>();
+        sol::usertype<obe::events::Collision::Began> bind_began
+            = Collision_namespace.new_usertype<obe::events::Collision::Began>(
+                "Began", sol::call_constructor, sol::default_constructor);
+        bind_began["collider1"] = &obe::events::Collision::Began::collider1;
+        bind_began["collider2"] = &obe::events::Collision::Began::collider2;
+        bind_began["id"] = sol::var(&obe::events::Collision::Began::id);
+    }
+    void load_class_ended(sol::state_view state)
+    {
+        sol::table Collision_namespace = state["obe"]["events"]["Collision"].get<sol::table>();
+        sol::usertype<obe::events::Collision::Ended> bind_ended
+            = Collision_namespace.new_usertype<obe::events::Collision::Ended>(
+                "Ended", sol::call_constructor, sol::default_constructor);
+        bind_ended["collider1"] = &obe::events::Collision::Ended::collider1;
+        bind_ended["collider2"] = &obe::events::Collision::Ended::collider2;
+        bind_ended["id"] = sol::var(&obe::events::Collision::Ended::id);
+    }
+};
\ No newline at end of file
@@ -356,7 +356,9 @@ namespace obe::graphics::bindings
         bind_renderable["set_visible"] = &obe::graphics::Renderable::set_visible;
         bind_renderable["show"] = &obe::graphics::Renderable::show;
         bind_renderable["hide"] = &obe::graphics::Renderable::hide;
-        bind_renderable["draw"] = &obe::graphics::Renderable::draw;
+        bind_renderable["draw"]
+            = static_cast<void (obe::graphics::Renderable::*)(obe::graphics::RenderTarget&,
+                const obe::scene::Camera&)>(&obe::graphics::Renderable::draw);
     }
     void load_class_rich_text(sol::state_view state)
     {
@@ -440,7 +442,9 @@ namespace obe::graphics::bindings
         bind_sprite["set_translation_origin"] = &obe::graphics::Sprite::set_translation_origin;
         bind_sprite["set_anti_aliasing"] = &obe::graphics::Sprite::set_anti_aliasing;
         bind_sprite["use_texture_size"] = &obe::graphics::Sprite::use_texture_size;
-        bind_sprite["draw"] = &obe::graphics::Sprite::draw;
+        bind_sprite["draw"]
+            = static_cast<void (obe::graphics::Sprite::*)(obe::graphics::RenderTarget&,
+                const obe::scene::Camera&)>(&obe::graphics::Sprite::draw);
         bind_sprite["attach_resource_manager"] = &obe::graphics::Sprite::attach_resource_manager;
         bind_sprite["type"] = &obe::graphics::Sprite::type;
         bind_sprite["flip"] = &obe::graphics::Sprite::flip;
@@ -124,6 +124,7 @@ namespace obe::scene::bindings
         };
         bind_scene["get_render_options"] = &obe::scene::Scene::get_render_options;
         bind_scene["set_render_options"] = &obe::scene::Scene::set_render_options;
+        bind_scene["get_render_statistics"] = &obe::scene::Scene::get_render_statistics;
         bind_scene["get_component"] = &obe::scene::Scene::get_component;
     }
     void load_class_scene_node(sol::state_view state)
@@ -150,5 +151,19 @@ namespace obe::scene::bindings
         bind_scene_render_options["sprites"] = &obe::scene::SceneRenderOptions::sprites;
         bind_scene_render_options["collisions"] = &obe::scene::SceneRenderOptions::collisions;
         bind_scene_render_options["scene_nodes"] = &obe::scene::SceneRenderOptions::scene_nodes;
+        bind_scene_render_options["culling"] = &obe::scene::SceneRenderOptions::culling;
+        bind_scene_render_options["batching"] = &obe::scene::SceneRenderOptions::batching;
+    }
+    void load_class_scene_render_statistics(sol::state_view state)
+    {
+        sol::table scene_namespace = state["obe"]["scene"].get<sol::table>();
+        sol::usertype<obe::scene::SceneRenderStatistics> bind_scene_render_statistics
+            = scene_namespace.new_usertype<obe::scene::SceneRenderStatistics>(
+                "SceneRenderStatistics", sol::call_constructor, sol::default_constructor);
+        bind_scene_render_statistics["drawn"] = &obe::scene::SceneRenderStatistics::drawn;
+        bind_scene_render_statistics["culled"] = &obe::scene::SceneRenderStatistics::culled;
+        bind_scene_render_statistics["batches"] = &obe::scene::SceneRenderStatistics::batches;
+        bind_scene_render_statistics["draw_calls"]
+            = &obe::scene::SceneRenderStatistics::draw_calls;
     }
 };
\ No newline at end of file
@@ -1,8 +1,10 @@
 #include <Bindings/obe/script/Script.hpp>
 
 #include <Scene/Scene.hpp>
+#include <Script/BytecodeCache.hpp>
 #include <Script/Casters/Base.hpp>
 #include <Script/Casters/InputSource.hpp>
+#include <Script/GarbageCollector.hpp>
 #include <Script/GameObject.hpp>
 #include <Script/LuaState.hpp>
 #include <Script/Scripting.hpp>
@@ -11,6 +13,31 @@
 
 namespace obe::script::bindings
 {
+    void load_class_bytecode_cache(sol::state_view state)
+    {
+        sol::table script_namespace = state["obe"]["script"].get<sol::table>();
+        sol::usertype<obe::script::BytecodeCache> bind_bytecode_cache
+            = script_namespace.new_usertype<obe::script::BytecodeCache>(
+                "BytecodeCache", sol::call_constructor, sol::default_constructor);
+        bind_bytecode_cache["set_directory"] = &obe::script::BytecodeCache::set_directory;
+        bind_bytecode_cache["get_directory"] = &obe::script::BytecodeCache::get_directory;
+        // Returns the loaded function or nil and the error, like loadfile
+        bind_bytecode_cache["load_file"]
+            = [](obe::script::BytecodeCache* self, const std::string& path, sol::this_state state)
+            -> std::tuple<sol::object, sol::object> {
+            sol::state_view lua(state);
+            sol::load_result script = self->load_file(lua, path);
+            if (!script.valid())
+            {
+                return { sol::lua_nil, sol::make_object(lua, script.get<sol::error>().what()) };
+            }
+            return { script.get<sol::protected_function>(), sol::lua_nil };
+        };
+        bind_bytecode_cache["precompile"]
+            = [](obe::script::BytecodeCache* self, const std::string& path, sol::this_state state)
+            -> bool { return self->precompile(state, path); };
+        bind_bytecode_cache["clear"] = &obe::script::BytecodeCache::clear;
+    }
     void load_enum_environment_target(sol::state_view state)
     {
         sol::table script_namespace = state["obe"]["script"].get<sol::table>();
@@ -74,6 +101,52 @@ namespace obe::script::bindings
             = &obe::script::GameObject::is_parent_of_component;
         bind_game_object["deletable"] = &obe::script::GameObject::deletable;
     }
+    void load_class_garbage_collector(sol::state_view state)
+    {
+        sol::table script_namespace = state["obe"]["script"].get<sol::table>();
+        sol::usertype<obe::script::GarbageCollector> bind_garbage_collector
+            = script_namespace.new_usertype<obe::script::GarbageCollector>("GarbageCollector");
+        bind_garbage_collector["configure"] = &obe::script::GarbageCollector::configure;
+        bind_garbage_collector["set_enabled"] = &obe::script::GarbageCollector::set_enabled;
+        bind_garbage_collector["is_enabled"] = &obe::script::GarbageCollector::is_enabled;
+        bind_garbage_collector["set_budget"] = &obe::script::GarbageCollector::set_budget;
+        bind_garbage_collector["get_budget"] = &obe::script::GarbageCollector::get_budget;
+        bind_garbage_collector["set_step_size"] = &obe::script::GarbageCollector::set_step_size;
+        bind_garbage_collector["get_step_size"] = &obe::script::GarbageCollector::get_step_size;
+        bind_garbage_collector["set_pause"] = &obe::script::GarbageCollector::set_pause;
+        bind_garbage_collector["get_pause"] = &obe::script::GarbageCollector::get_pause;
+        bind_garbage_collector["set_limit"] = &obe::script::GarbageCollector::set_limit;
+        bind_garbage_collector["get_limit"] = &obe::script::GarbageCollector::get_limit;
+        bind_garbage_collector["collect_in_slack"]
+            = &obe::script::GarbageCollector::collect_in_slack;
+        bind_garbage_collector["end_frame"] = &obe::script::GarbageCollector::end_frame;
+        bind_garbage_collector["get_heap_size"] = &obe::script::GarbageCollector::get_heap_size;
+        bind_garbage_collector["get_statistics"]
+            = &obe::script::GarbageCollector::get_statistics;
+        bind_garbage_collector["reset_statistics"]
+            = &obe::script::GarbageCollector::reset_statistics;
+    }
+    void load_class_garbage_collector_statistics(sol::state_view state)
+    {
+        sol::table script_namespace = state["obe"]["script"].get<sol::table>();
+        sol::usertype<obe::script::GarbageCollectorStatistics> bind_garbage_collector_statistics
+            = script_namespace.new_usertype<obe::script::GarbageCollectorStatistics>(
+                "GarbageCollectorStatistics", sol::call_constructor, sol::default_constructor);
+        bind_garbage_collector_statistics["steps"]
+            = &obe::script::GarbageCollectorStatistics::steps;
+        bind_garbage_collector_statistics["cycles"]
+            = &obe::script::GarbageCollectorStatistics::cycles;
+        bind_garbage_collector_statistics["forced_frames"]
+            = &obe::script::GarbageCollectorStatistics::forced_frames;
+        bind_garbage_collector_statistics["full_collections"]
+            = &obe::script::GarbageCollectorStatistics::full_collections;
+        bind_garbage_collector_statistics["last_frame_pause"]
+            = &obe::script::GarbageCollectorStatistics::last_frame_pause;
+        bind_garbage_collector_statistics["max_frame_pause"]
+            = &obe::script::GarbageCollectorStatistics::max_frame_pause;
+        bind_garbage_collector_statistics["total_pause"]
+            = &obe::script::GarbageCollectorStatistics::total_pause;
+    }
     void load_class_game_object_database(sol::state_view state)
     {
         sol::table script_namespace = state["obe"]["script"].get<sol::table>();
@@ -113,4 +186,9 @@ namespace obe::script::bindings
     {
         sol::table script_namespace = state["obe"]["script"].get<sol::table>();
     }
+    void load_global_script_cache(sol::state_view state)
+    {
+        sol::table script_namespace = state["obe"]["script"].get<sol::table>();
+        script_namespace["ScriptCache"] = &obe::script::ScriptCache;
+    }
 };
\ No newline at end of file
@@ -19,15 +19,11 @@ namespace obe::tiles::bindings
                 sol::call_constructor,
                 sol::constructors<obe::tiles::AnimatedTile(const obe::tiles::Tileset&,
                     std::vector<uint32_t>, std::vector<obe::time::TimeUnit>)>());
-        bind_animated_tile["attach_quad"]
-            = sol::overload([](obe::tiles::AnimatedTile* self,
-                                sf::Vertex* quad) -> void { return self->attach_quad(quad); },
-                [](obe::tiles::AnimatedTile* self, sf::Vertex* quad, obe::tiles::TileInfo tile_info)
-                    -> void { return self->attach_quad(quad, tile_info); });
-        bind_animated_tile["detach_quad"] = &obe::tiles::AnimatedTile::detach_quad;
         bind_animated_tile["start"] = &obe::tiles::AnimatedTile::start;
         bind_animated_tile["stop"] = &obe::tiles::AnimatedTile::stop;
         bind_animated_tile["get_id"] = &obe::tiles::AnimatedTile::get_id;
+        bind_animated_tile["get_frame_index"] = &obe::tiles::AnimatedTile::get_frame_index;
+        bind_animated_tile["get_current_tile_id"] = &obe::tiles::AnimatedTile::get_current_tile_id;
         bind_animated_tile["update"] = &obe::tiles::AnimatedTile::update;
     }
     void load_class_tile_layer(sol::state_view state)
@@ -43,8 +39,12 @@ namespace obe::tiles::bindings
         bind_tile_layer["get_id"] = &obe::tiles::TileLayer::get_id;
         bind_tile_layer["build"] = &obe::tiles::TileLayer::build;
         bind_tile_layer["draw"] = &obe::tiles::TileLayer::draw;
+        bind_tile_layer["update_chunks"] = &obe::tiles::TileLayer::update_chunks;
         bind_tile_layer["set_tile"] = &obe::tiles::TileLayer::set_tile;
         bind_tile_layer["get_tile"] = &obe::tiles::TileLayer::get_tile;
+        bind_tile_layer["get_chunks_amount"] = &obe::tiles::TileLayer::get_chunks_amount;
+        bind_tile_layer["get_loaded_chunks_amount"]
+            = &obe::tiles::TileLayer::get_loaded_chunks_amount;
     }
     void load_class_tile_scene(sol::state_view state)
     {
@@ -71,11 +71,20 @@ namespace obe::tiles::bindings
         bind_tile_scene["get_collider_models"] = &obe::tiles::TileScene::get_collider_models;
         bind_tile_scene["get_game_objects_models"]
             = &obe::tiles::TileScene::get_game_objects_models;
+        bind_tile_scene["get_tile_animation"] = &obe::tiles::TileScene::get_tile_animation;
+        bind_tile_scene["get_tile_collider_models"]
+            = &obe::tiles::TileScene::get_tile_collider_models;
+        bind_tile_scene["get_tile_game_objects_models"]
+            = &obe::tiles::TileScene::get_tile_game_objects_models;
         bind_tile_scene["get_width"] = &obe::tiles::TileScene::get_width;
         bind_tile_scene["get_height"] = &obe::tiles::TileScene::get_height;
         bind_tile_scene["get_tile_width"] = &obe::tiles::TileScene::get_tile_width;
         bind_tile_scene["get_tile_height"] = &obe::tiles::TileScene::get_tile_height;
         bind_tile_scene["is_anti_aliased"] = &obe::tiles::TileScene::is_anti_aliased;
+        bind_tile_scene["get_chunk_size"] = &obe::tiles::TileScene::get_chunk_size;
+        bind_tile_scene["is_streaming"] = &obe::tiles::TileScene::is_streaming;
+        bind_tile_scene["get_streaming_margin"] = &obe::tiles::TileScene::get_streaming_margin;
+        bind_tile_scene["is_merging_colliders"] = &obe::tiles::TileScene::is_merging_colliders;
         bind_tile_scene["get_scene"] = &obe::tiles::TileScene::get_scene;
     }
     void load_class_tileset(sol::state_view state)
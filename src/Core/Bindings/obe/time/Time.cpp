@@ -50,12 +50,16 @@ namespace obe::time::bindings
         bind_framerate_manager["get_raw_delta_time"]
             = &obe::time::FramerateManager::get_raw_delta_time;
         bind_framerate_manager["get_delta_time"] = &obe::time::FramerateManager::get_delta_time;
+        bind_framerate_manager["get_update_delta_time"]
+            = &obe::time::FramerateManager::get_update_delta_time;
         bind_framerate_manager["get_speed_coefficient"]
             = &obe::time::FramerateManager::get_speed_coefficient;
         bind_framerate_manager["is_framerate_limited"]
             = &obe::time::FramerateManager::is_framerate_limited;
         bind_framerate_manager["get_framerate_target"]
             = &obe::time::FramerateManager::get_framerate_target;
+        bind_framerate_manager["get_time_before_next_frame"]
+            = &obe::time::FramerateManager::get_time_before_next_frame;
         bind_framerate_manager["is_vsync_enabled"] = &obe::time::FramerateManager::is_vsync_enabled;
         bind_framerate_manager["set_speed_coefficient"]
             = &obe::time::FramerateManager::set_speed_coefficient;
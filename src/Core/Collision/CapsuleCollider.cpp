@@ -15,6 +15,7 @@ namespace obe::collision
     void CapsuleCollider::update_shape()
     {
         // TODO
+        this->notify_transform_change();
     }
 
     ColliderType CapsuleCollider::get_collider_type() const
@@ -40,11 +41,13 @@ namespace obe::collision
     void CapsuleCollider::set_position(const transform::UnitVector& position)
     {
         Collider::set_position(position);
+        update_shape();
     }
 
     void CapsuleCollider::move(const transform::UnitVector& position)
     {
         Collider::move(position);
+        update_shape();
     }
 
     float CapsuleCollider::get_radius() const
@@ -55,5 +58,6 @@ namespace obe::collision
     void CapsuleCollider::set_radius(float radius)
     {
         m_shape.r = radius;
+        update_shape();
     }
 }
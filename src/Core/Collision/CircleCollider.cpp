@@ -16,6 +16,7 @@ namespace obe::collision
     {
         m_shape.p.x = m_position.x;
         m_shape.p.y = m_position.y;
+        this->notify_transform_change();
     }
 
     ColliderType CircleCollider::get_collider_type() const
@@ -61,5 +62,6 @@ namespace obe::collision
     void CircleCollider::set_radius(const float radius)
     {
         m_shape.r = radius;
+        this->notify_transform_change();
     }
 }
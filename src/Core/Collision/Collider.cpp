@@ -1,10 +1,14 @@
 #define CUTE_C2_IMPLEMENTATION
 
+#include <mutex>
+#include <unordered_map>
+
 #include <cute/cute_c2.h>
 
 #include <Collision/CapsuleCollider.hpp>
 #include <Collision/CircleCollider.hpp>
 #include <Collision/Collider.hpp>
+#include <Collision/CollisionSpace.hpp>
 #include <Collision/Exceptions.hpp>
 #include <Collision/PolygonCollider.hpp>
 #include <Collision/RectangleCollider.hpp>
@@ -29,6 +33,14 @@ namespace obe::collision
         return C2_TYPE_NONE;
     }
 
+    std::size_t get_tag_layer(const std::string& tag)
+    {
+        static std::mutex layers_mutex;
+        static std::unordered_map<std::string, std::size_t> layers { { "", 0 } };
+        std::lock_guard lock(layers_mutex);
+        return layers.try_emplace(tag, layers.size()).first->second;
+    }
+
     ColliderType Collider::get_collider_type() const
     {
         return Collider::Type;
@@ -39,9 +51,42 @@ namespace obe::collision
     {
     }
 
+    Collider::Collider(const Collider& other)
+        : Movable(other)
+        , m_tag(other.m_tag)
+        , m_layer(other.m_layer)
+    {
+    }
+
+    Collider& Collider::operator=(const Collider& other)
+    {
+        Movable::operator=(other);
+        m_tag = other.m_tag;
+        m_layer = other.m_layer;
+        this->notify_transform_change();
+        return *this;
+    }
+
+    Collider::~Collider()
+    {
+        if (m_collision_space)
+        {
+            m_collision_space->remove_collider(this);
+        }
+    }
+
+    void Collider::notify_transform_change() const
+    {
+        if (m_collision_space && !m_dirty)
+        {
+            m_collision_space->mark_as_dirty(this);
+        }
+    }
+
     void Collider::set_tag(const std::string& tag)
     {
         m_tag = tag;
+        m_layer = get_tag_layer(tag);
     }
 
     std::string Collider::get_tag() const
@@ -49,6 +94,16 @@ namespace obe::collision
         return m_tag;
     }
 
+    std::size_t Collider::get_layer() const
+    {
+        return m_layer;
+    }
+
+    CollisionSpace* Collider::get_collision_space() const
+    {
+        return m_collision_space;
+    }
+
     bool Collider::collides(const Collider& collider) const
     {
         const void* a_c2_shape = this->get_c2_shape();
@@ -88,6 +143,35 @@ namespace obe::collision
         return final_offset;
     }
 
+    std::optional<SweepHit> Collider::sweep(const Collider& collider,
+        const transform::UnitVector& self_offset, const transform::UnitVector& other_offset) const
+    {
+        const C2_TYPE a_type = collider_type_to_c2type(this->get_collider_type());
+        const C2_TYPE b_type = collider_type_to_c2type(collider.get_collider_type());
+        if (a_type == C2_TYPE_NONE || b_type == C2_TYPE_NONE)
+        {
+            return std::nullopt;
+        }
+        const c2v c2_self_offset
+            = { static_cast<float>(self_offset.x), static_cast<float>(self_offset.y) };
+        const c2v c2_other_offset
+            = { static_cast<float>(other_offset.x), static_cast<float>(other_offset.y) };
+        const c2TOIResult result = c2TOI(this->get_c2_shape(), a_type,
+            this->get_c2_space_transform(), c2_self_offset, collider.get_c2_shape(), b_type,
+            collider.get_c2_space_transform(), c2_other_offset, 1);
+        // Colliders touching while moving apart (or sliding) do not block each other
+        if (!result.hit || c2Dot(result.n, c2Sub(c2_self_offset, c2_other_offset)) <= 0)
+        {
+            return std::nullopt;
+        }
+        SweepHit hit;
+        hit.collider = &collider;
+        hit.toi = result.toi;
+        hit.normal = transform::UnitVector(result.n.x, result.n.y, self_offset.unit);
+        hit.offset = self_offset * result.toi;
+        return hit;
+    }
+
     std::unique_ptr<Collider> Collider::copy() const
     {
         switch (this->get_collider_type())
@@ -1,4 +1,5 @@
 #include <Collision/ColliderComponent.hpp>
+#include <Collision/CollisionSpace.hpp>
 #include <Collision/Exceptions.hpp>
 
 namespace obe::collision
@@ -169,6 +170,13 @@ namespace obe::collision
         }
         const std::string collider_type_str = data.at("type");
 
+        // Replacing the inner collider may destroy it, which removes it from its CollisionSpace
+        CollisionSpace* collision_space = this->get_inner_collider()->get_collision_space();
+        if (collision_space)
+        {
+            collision_space->remove_collider(this->get_inner_collider());
+        }
+
         switch (ColliderTypeMeta::from_string(collider_type_str))
         {
         case ColliderType::Capsule:
@@ -193,6 +201,10 @@ namespace obe::collision
                 collider.set_tag(tag);
             },
             m_collider);
+        if (collision_space)
+        {
+            collision_space->add_collider(this->get_inner_collider());
+        }
     }
 
     ColliderType ColliderComponent::get_collider_type() const
@@ -1,40 +1,174 @@
+#include <optional>
+
 #include <Collision/CollisionSpace.hpp>
 #include <Time/TimeUtils.hpp>
 
 namespace obe::collision
 {
-    bool CollisionSpace::matches_any_tag(const std::unordered_set<std::string>& input_tags,
-        const std::unordered_set<std::string>& blacklist)
+    constexpr std::size_t PARALLEL_NARROW_PHASE_THRESHOLD = 64;
+    constexpr std::size_t PARALLEL_NARROW_PHASE_MIN_GRAIN = 16;
+
+    /**
+     * \brief Calls narrow_phase on every candidate and gathers the results that
+     *        are set, on the JobPool when there are enough candidates
+     *
+     * Each chunk of candidates writes in its own result bucket and buckets are
+     * concatenated in order so the output never depends on the threads scheduling
+     */
+    template <class Result, class Candidate, class NarrowPhase>
+    std::vector<Result> run_narrow_phase(system::JobPool* job_pool,
+        const std::vector<Candidate>& candidates, const NarrowPhase& narrow_phase)
     {
-        for (const auto& tag : input_tags)
+        std::vector<Result> results;
+        if (!job_pool || job_pool->get_workers_amount() == 0
+            || candidates.size() < PARALLEL_NARROW_PHASE_THRESHOLD)
         {
-            if (blacklist.contains(tag))
+            for (const Candidate& candidate : candidates)
             {
-                return true;
+                if (std::optional<Result> result = narrow_phase(candidate))
+                    results.push_back(std::move(*result));
             }
+            return results;
         }
-        return false;
+
+        const std::size_t threads_amount = job_pool->get_workers_amount() + 1;
+        const std::size_t grain = std::max(
+            PARALLEL_NARROW_PHASE_MIN_GRAIN, candidates.size() / (threads_amount * 4) + 1);
+        std::vector<std::vector<Result>> buckets((candidates.size() + grain - 1) / grain);
+        job_pool->parallel_for(candidates.size(), grain,
+            [&](std::size_t begin, std::size_t end)
+            {
+                std::vector<Result>& bucket = buckets[begin / grain];
+                for (std::size_t i = begin; i < end; i++)
+                {
+                    if (std::optional<Result> result = narrow_phase(candidates[i]))
+                        bucket.push_back(std::move(*result));
+                }
+            });
+        for (std::vector<Result>& bucket : buckets)
+        {
+            results.insert(results.end(), std::make_move_iterator(bucket.begin()),
+                std::make_move_iterator(bucket.end()));
+        }
+        return results;
     }
 
-    bool CollisionSpace::can_collide_with(
-        const Collider& collider1, const Collider& collider2, bool check_both_directions) const
+    void CollisionSpace::mark_as_dirty(const Collider* collider)
     {
-        const std::string tag = collider1.get_tag();
-        if (m_tags_blacklists.contains(tag))
+        collider->m_dirty = true;
+        m_dirty_colliders.push_back(collider);
+    }
+
+    void CollisionSpace::update_dirty_colliders() const
+    {
+        for (const Collider* collider : m_dirty_colliders)
         {
-            const auto& tag_blacklist = m_tags_blacklists.at(tag);
-            if (tag_blacklist.contains(collider2.get_tag()))
+            m_quadtree.update(collider);
+            collider->m_dirty = false;
+        }
+        m_dirty_colliders.clear();
+    }
+
+    /**
+     * \brief Bounding box covering a box along its whole movement
+     */
+    transform::AABB get_trajectory_bounding_box(
+        const transform::AABB& bbox, const transform::UnitVector& offset)
+    {
+        transform::AABB translated_bbox = bbox;
+        translated_bbox.move(offset);
+
+        const double min_left = std::min(bbox.get_position().x, translated_bbox.get_position().x);
+        const double max_right = std::max(
+            bbox.get_position().x + bbox.width(), translated_bbox.get_position().x + bbox.width());
+        const double min_top = std::min(bbox.get_position().y, translated_bbox.get_position().y);
+        const double max_bottom = std::max(bbox.get_position().y + bbox.height(),
+            translated_bbox.get_position().y + bbox.height());
+
+        return transform::AABB(transform::UnitVector(min_left, min_top),
+            transform::UnitVector(max_right - min_left, max_bottom - min_top));
+    }
+
+    /**
+     * \brief Checks whether a box moving by offset touches another box, this
+     *        discards most of the candidates of a diagonal trajectory bounding box
+     *        before running the exact time of impact computation
+     */
+    bool swept_box_intersects(const transform::AABB& moving_box,
+        const transform::UnitVector& offset, const transform::AABB& target_box)
+    {
+        // Target box grown by the size of the moving box, tested against the path
+        // of the top-left corner of the moving box (slab test)
+        const transform::UnitVector origin = moving_box.get_position();
+        const double min[2] = { target_box.get_position().x - moving_box.width(),
+            target_box.get_position().y - moving_box.height() };
+        const double max[2] = { target_box.get_position().x + target_box.width(),
+            target_box.get_position().y + target_box.height() };
+        const double start[2] = { origin.x, origin.y };
+        const double direction[2] = { offset.x, offset.y };
+        double enter = 0;
+        double exit = 1;
+        for (int axis = 0; axis < 2; axis++)
+        {
+            if (direction[axis] == 0)
             {
-                return false;
+                if (start[axis] < min[axis] || start[axis] > max[axis])
+                    return false;
+                continue;
             }
+            double near = (min[axis] - start[axis]) / direction[axis];
+            double far = (max[axis] - start[axis]) / direction[axis];
+            if (near > far)
+                std::swap(near, far);
+            enter = std::max(enter, near);
+            exit = std::min(exit, far);
+            if (enter > exit)
+                return false;
         }
+        return true;
+    }
 
-        const bool is_valid
-            = (!check_both_directions || can_collide_with(collider2, collider1, false));
+    bool CollisionSpace::can_collide_with(
+        const Collider& collider1, const Collider& collider2) const
+    {
+        const std::size_t layer1 = collider1.get_layer();
+        const std::size_t layer2 = collider2.get_layer();
+        // Layers outside of the matrix are not part of any blacklist
+        if (layer1 >= m_matrix_layers || layer2 >= m_matrix_layers)
+        {
+            return true;
+        }
+        const std::uint64_t row_word = m_collision_matrix[layer1 * m_matrix_stride + layer2 / 64];
+        return !(row_word & (std::uint64_t(1) << (layer2 % 64)));
+    }
 
-            
-        // if true, check if we need to check for tags on collider2 -> collider1
-        return is_valid;
+    void CollisionSpace::compile_collision_matrix()
+    {
+        std::vector<std::pair<std::size_t, std::size_t>> rejected_layers;
+        std::size_t layers_amount = 0;
+        for (const auto& [source_tag, blacklist] : m_tags_blacklists)
+        {
+            const std::size_t source_layer = get_tag_layer(source_tag);
+            for (const std::string& rejected_tag : blacklist)
+            {
+                const std::size_t rejected_layer = get_tag_layer(rejected_tag);
+                rejected_layers.emplace_back(source_layer, rejected_layer);
+                layers_amount = std::max({ layers_amount, source_layer + 1, rejected_layer + 1 });
+            }
+        }
+        m_matrix_layers = layers_amount;
+        m_matrix_stride = (layers_amount + 63) / 64;
+        m_collision_matrix.assign(m_matrix_layers * m_matrix_stride, 0);
+        const auto reject = [this](std::size_t layer1, std::size_t layer2)
+        {
+            m_collision_matrix[layer1 * m_matrix_stride + layer2 / 64]
+                |= std::uint64_t(1) << (layer2 % 64);
+        };
+        for (const auto& [source_layer, rejected_layer] : rejected_layers)
+        {
+            reject(source_layer, rejected_layer);
+            reject(rejected_layer, source_layer);
+        }
     }
 
     constexpr double COLLISION_SPACE_SIZE = 100000000;
@@ -49,8 +183,58 @@ namespace obe::collision
     {
     }
 
+    CollisionSpace::CollisionSpace(event::EventGroupPtr events)
+        : CollisionSpace()
+    {
+        e_collision = std::move(events);
+        e_collision->add<events::Collision::Began>();
+        e_collision->add<events::Collision::Ended>();
+        const auto on_listener_change
+            = [this](event::ListenerChangeState state, const std::string&)
+        {
+            if (state == event::ListenerChangeState::Added)
+                m_listeners_amount++;
+            else if (m_listeners_amount > 0)
+                m_listeners_amount--;
+        };
+        for (const std::string_view event_name :
+            { events::Collision::Began::id, events::Collision::Ended::id })
+        {
+            e_collision->on_add_listener(event_name.data(), on_listener_change);
+            e_collision->on_remove_listener(event_name.data(), on_listener_change);
+        }
+    }
+
+    CollisionSpace::~CollisionSpace()
+    {
+        // The EventGroup can outlive the CollisionSpace, its callbacks capture this
+        if (e_collision)
+        {
+            for (const std::string_view event_name :
+                { events::Collision::Began::id, events::Collision::Ended::id })
+            {
+                e_collision->on_add_listener(event_name.data(), nullptr);
+                e_collision->on_remove_listener(event_name.data(), nullptr);
+            }
+        }
+        for (const Collider* collider : m_colliders)
+        {
+            collider->m_collision_space = nullptr;
+            collider->m_dirty = false;
+        }
+    }
+
     void CollisionSpace::add_collider(const Collider* collider)
     {
+        if (collider->m_collision_space == this)
+        {
+            return;
+        }
+        if (collider->m_collision_space)
+        {
+            collider->m_collision_space->remove_collider(collider);
+        }
+        collider->m_collision_space = this;
         m_colliders.insert(collider);
         m_quadtree.add(collider);
     }
@@ -67,8 +251,20 @@ namespace obe::collision
 
     void CollisionSpace::remove_collider(const Collider* collider)
     {
+        if (collider->m_collision_space != this)
+        {
+            return;
+        }
+        if (collider->m_dirty)
+        {
+            std::erase(m_dirty_colliders, collider);
+            collider->m_dirty = false;
+        }
+        collider->m_collision_space = nullptr;
         m_colliders.erase(collider);
         m_quadtree.remove(collider);
+        std::erase_if(m_collisions, [collider](const CollisionPair& pair)
+            { return pair.first == collider || pair.second == collider; });
     }
 
     void CollisionSpace::refresh_collider(const Collider* collider)
@@ -79,6 +275,11 @@ namespace obe::collision
 
     void CollisionSpace::refresh_quadtree()
     {
+        for (const Collider* collider : m_dirty_colliders)
+        {
+            collider->m_dirty = false;
+        }
+        m_dirty_colliders.clear();
         m_quadtree.clear();
         for (const Collider* collider : m_colliders)
         {
@@ -86,8 +287,19 @@ namespace obe::collision
         }
     }
 
+    void CollisionSpace::set_job_pool(system::JobPool* job_pool)
+    {
+        m_job_pool = job_pool;
+    }
+
+    system::JobPool* CollisionSpace::get_job_pool() const
+    {
+        return m_job_pool;
+    }
+
     bool CollisionSpace::collides(const Collider& collider) const
     {
+        this->update_dirty_colliders();
         std::vector<const Collider*> possible_collisions
             = m_quadtree.query(collider.get_bounding_box());
 
@@ -134,36 +346,106 @@ namespace obe::collision
     std::vector<ReachableCollider> CollisionSpace::get_reachable_colliders(
         const Collider& collider, const transform::UnitVector& offset) const
     {
+        this->update_dirty_colliders();
+        const transform::AABB trajectory_bbox
+            = get_trajectory_bounding_box(collider.get_bounding_box(), offset);
+
+        std::vector<const Collider*> quadtree_query_results = m_quadtree.query(trajectory_bbox);
+
+        return run_narrow_phase<ReachableCollider>(m_job_pool, quadtree_query_results,
+            [&](const Collider* space_collider) -> std::optional<ReachableCollider>
+            {
+                if (&collider != space_collider && can_collide_with(collider, *space_collider))
+                {
+                    const transform::UnitVector max_distance
+                        = collider.get_offset_before_collision(*space_collider, offset);
+                    if (max_distance != offset)
+                        return ReachableCollider(space_collider, max_distance);
+                }
+                return std::nullopt;
+            });
+    }
+
+    std::vector<SweepHit> CollisionSpace::sweep(
+        const Collider& collider, const transform::UnitVector& offset) const
+    {
+        this->update_dirty_colliders();
         const transform::AABB bbox = collider.get_bounding_box();
-        transform::AABB translated_bbox = collider.get_bounding_box();
-        translated_bbox.move(offset);
+        const std::vector<const Collider*> candidates
+            = m_quadtree.query(get_trajectory_bounding_box(bbox, offset));
 
-        const double min_left = std::min(bbox.get_position().x, translated_bbox.get_position().x);
-        const double max_right = std::max(
-            bbox.get_position().x + bbox.width(), translated_bbox.get_position().x + bbox.width());
-        const double min_top = std::min(bbox.get_position().y, translated_bbox.get_position().y);
-        const double max_bottom = std::max(bbox.get_position().y + bbox.height(),
-            translated_bbox.get_position().y + bbox.height());
+        std::vector<SweepHit> hits = run_narrow_phase<SweepHit>(m_job_pool, candidates,
+            [&](const Collider* space_collider) -> std::optional<SweepHit>
+            {
+                if (&collider == space_collider || !can_collide_with(collider, *space_collider)
+                    || !swept_box_intersects(bbox, offset, space_collider->get_bounding_box()))
+                    return std::nullopt;
+                return collider.sweep(*space_collider, offset);
+            });
+        // Stable so Colliders hit at the same time keep the Quadtree order
+        std::stable_sort(hits.begin(), hits.end(),
+            [](const SweepHit& lhs, const SweepHit& rhs) { return lhs.toi < rhs.toi; });
+        return hits;
+    }
 
-        transform::AABB trajectory_bbox(transform::UnitVector(min_left, min_top),
-            transform::UnitVector(max_right - min_left, max_bottom - min_top));
+    std::vector<CollisionPair> CollisionSpace::find_collisions() const
+    {
+        this->update_dirty_colliders();
 
-        std::vector<const Collider*> quadtree_query_results = m_quadtree.query(trajectory_bbox);
+        return run_narrow_phase<CollisionPair>(m_job_pool, m_quadtree.find_all_intersections(),
+            [this](const CollisionPair& candidate) -> std::optional<CollisionPair>
+            {
+                const auto [collider1, collider2] = candidate;
+                if (!can_collide_with(*collider1, *collider2) || !collider1->collides(*collider2))
+                    return std::nullopt;
+                if (std::less<const Collider*>()(collider1, collider2))
+                    return CollisionPair(collider1, collider2);
+                return CollisionPair(collider2, collider1);
+            });
+    }
 
-        std::vector<ReachableCollider> reachable_colliders;
+    void CollisionSpace::step()
+    {
+        std::vector<CollisionPair> collisions = this->find_collisions();
+        std::sort(collisions.begin(), collisions.end());
 
-        for (const Collider* space_collider : quadtree_query_results)
+        if (e_collision)
         {
-            if (&collider != space_collider && can_collide_with(collider, *space_collider))
+            std::vector<CollisionPair> began;
+            std::vector<CollisionPair> ended;
+            std::set_difference(collisions.begin(), collisions.end(), m_collisions.begin(),
+                m_collisions.end(), std::back_inserter(began));
+            std::set_difference(m_collisions.begin(), m_collisions.end(), collisions.begin(),
+                collisions.end(), std::back_inserter(ended));
+            m_collisions = std::move(collisions);
+            // Listeners may remove Colliders from the CollisionSpace while we iterate
+            const auto is_still_present = [this](const CollisionPair& pair)
+            { return m_colliders.contains(pair.first) && m_colliders.contains(pair.second); };
+            for (const auto& pair : ended)
+            {
+                if (is_still_present(pair))
+                    e_collision->trigger(events::Collision::Ended { pair.first, pair.second });
+            }
+            for (const auto& pair : began)
             {
-                const transform::UnitVector max_distance
-                    = collider.get_offset_before_collision(*space_collider, offset);
-                if (max_distance != offset)
-                    reachable_colliders.emplace_back(space_collider, max_distance);
+                if (is_still_present(pair))
+                    e_collision->trigger(events::Collision::Began { pair.first, pair.second });
             }
         }
+        else
+        {
+            m_collisions = std::move(collisions);
+        }
+    }
 
-        return reachable_colliders;
+    const std::vector<CollisionPair>& CollisionSpace::get_collisions() const
+    {
+        return m_collisions;
+    }
+
+    bool CollisionSpace::has_collision_listeners() const
+    {
+        return m_listeners_amount > 0;
     }
 
     void CollisionSpace::add_tag_to_blacklist(const std::string& source_tag,
@@ -174,6 +456,7 @@ namespace obe::collision
             m_tags_blacklists.insert({ source_tag, {} });
         }
         m_tags_blacklists.at(source_tag).insert(rejected_tag);
+        this->compile_collision_matrix();
     }
 
     void CollisionSpace::remove_tag_to_blacklist(const std::string& source_tag,
@@ -182,6 +465,7 @@ namespace obe::collision
         if (m_tags_blacklists.contains(source_tag))
         {
             m_tags_blacklists.at(source_tag).erase(rejected_tag);
+            this->compile_collision_matrix();
         }
     }
 
@@ -190,6 +474,7 @@ namespace obe::collision
         if (m_tags_blacklists.contains(source_tag))
         {
             m_tags_blacklists.at(source_tag).clear();
+            this->compile_collision_matrix();
         }
     }
 
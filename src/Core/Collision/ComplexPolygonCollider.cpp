@@ -86,6 +86,7 @@ namespace obe::collision
             {
                 point += offset;
             }
+            this->notify_transform_change();
         }
     }
 
@@ -103,6 +104,7 @@ namespace obe::collision
         {
             m_points.insert(m_points.begin() + point_index, p_vec);
         }
+        this->notify_transform_change();
     }
 
     std::size_t ComplexPolygonCollider::get_points_amount() const
@@ -112,11 +114,6 @@ namespace obe::collision
 
     bool ComplexPolygonCollider::collides(const Collider& collider) const
     {
-        std::vector<transform::UnitVector> p_set1;
-        p_set1.reserve(m_points.size());
-        std::vector<transform::UnitVector> p_set2;
-        p_set2.reserve(m_points.size());
-
         if (collider.get_collider_type() != ColliderType::ComplexPolygon)
         {
             return false;
@@ -125,10 +122,8 @@ namespace obe::collision
         const ComplexPolygonCollider& polygon_collider
             = static_cast<const ComplexPolygonCollider&>(collider);
 
-        for (const auto& point : m_points)
-            p_set1.push_back(point);
-        for (const auto& point : polygon_collider.m_points)
-            p_set2.push_back(point);
+        const std::vector<transform::UnitVector>& p_set1 = m_points;
+        const std::vector<transform::UnitVector>& p_set2 = polygon_collider.m_points;
         constexpr auto point_in_polygon = [](const std::vector<transform::UnitVector>& poly,
                                               const transform::UnitVector& p_test) -> bool
         {
@@ -154,6 +149,7 @@ namespace obe::collision
             if (point_in_polygon(p_set1, p_test))
                 return true;
         }
+        return false;
     }
 
     transform::UnitVector ComplexPolygonCollider::get_offset_before_collision(
@@ -252,6 +248,31 @@ namespace obe::collision
         return min_dep;
     }
 
+    std::optional<SweepHit> ComplexPolygonCollider::sweep(const Collider& collider,
+        const transform::UnitVector& self_offset, const transform::UnitVector& other_offset) const
+    {
+        const transform::UnitVector t_offset = self_offset.to(transform::Units::ScenePixels);
+        const double distance = t_offset.magnitude();
+        if (distance == 0)
+        {
+            return std::nullopt;
+        }
+        const transform::UnitVector max_offset
+            = this->get_offset_before_collision(collider, self_offset, other_offset);
+        if (max_offset == t_offset)
+        {
+            return std::nullopt;
+        }
+        SweepHit hit;
+        hit.collider = &collider;
+        hit.toi = std::clamp(max_offset.to(transform::Units::ScenePixels).magnitude() / distance,
+            0.0, 1.0);
+        hit.normal = transform::UnitVector(
+            t_offset.x / distance, t_offset.y / distance, transform::Units::ScenePixels);
+        hit.offset = max_offset;
+        return hit;
+    }
+
     transform::AABB ComplexPolygonCollider::get_bounding_box() const
     {
         // TODO: handle rotation
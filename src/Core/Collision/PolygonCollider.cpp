@@ -1,5 +1,3 @@
-#include <span>
-
 #include <Collision/PolygonCollider.hpp>
 #include <Utils/MathUtils.hpp>
 
@@ -21,6 +19,7 @@ namespace obe::collision
         const c2r rotation = c2Rot(utils::math::convert_to_radian(m_angle));
         m_transform.p = position;
         m_transform.r = rotation;
+        this->notify_transform_change();
     }
 
     void PolygonCollider::update_shape()
@@ -29,6 +28,7 @@ namespace obe::collision
         {
             c2MakePoly(&m_shape);
         }
+        this->notify_transform_change();
     }
 
     ColliderType PolygonCollider::get_collider_type() const
@@ -39,6 +39,7 @@ namespace obe::collision
     PolygonCollider::PolygonCollider()
     {
         m_shape.count = 0;
+        update_transform();
         update_shape();
     }
 
@@ -46,23 +47,27 @@ namespace obe::collision
         : Collider(position)
     {
         m_shape.count = 0;
+        update_transform();
         update_shape();
     }
 
     transform::AABB PolygonCollider::get_bounding_box() const
     {
-        // TODO: handle rotation
-        const auto verts_span = std::span { m_shape.verts };
-        auto [min_x, max_x]
-            = std::minmax_element(verts_span.begin(), verts_span.begin() + m_shape.count,
-                [](auto& point1, auto& point2) { return point1.x < point2.x; });
-        auto [min_y, max_y]
-            = std::minmax_element(verts_span.begin(), verts_span.begin() + m_shape.count,
-                [](auto& point1, auto& point2) { return point1.y < point2.y; });
-        const double width = max_x->x - min_x->x;
-        const double height = max_y->y - min_y->y;
+        if (m_shape.count == 0)
+        {
+            return transform::AABB(m_position, transform::UnitVector(0, 0));
+        }
+        // Bounding box of the vertices once moved and rotated by the c2 transform
+        c2v min = c2Mulxv(m_transform, m_shape.verts[0]);
+        c2v max = min;
+        for (int point_index = 1; point_index < m_shape.count; point_index++)
+        {
+            const c2v point = c2Mulxv(m_transform, m_shape.verts[point_index]);
+            min = c2Minv(min, point);
+            max = c2Maxv(max, point);
+        }
         return transform::AABB(
-            transform::UnitVector(min_x->x, min_y->y), transform::UnitVector(width, height));
+            transform::UnitVector(min.x, min.y), transform::UnitVector(max.x - min.x, max.y - min.y));
     }
 
     transform::UnitVector PolygonCollider::get_position() const
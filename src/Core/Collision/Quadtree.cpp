@@ -5,45 +5,29 @@
 
 namespace obe::collision
 {
-    Quadtree::Quadtree(const transform::AABB& box)
+    Quadtree::Quadtree(const transform::AABB& box, std::size_t threshold, std::size_t max_depth)
         : m_box(box)
-        , m_root(std::make_unique<Node>())
+        , m_threshold(threshold)
+        , m_max_depth(max_depth)
     {
+        m_nodes.emplace_back().box = m_box;
     }
 
     void Quadtree::clear()
     {
-        m_root.reset();
-        m_root = std::make_unique<Node>();
+        // Keep the capacity of the arrays so the next insertions do not allocate
+        m_nodes.resize(1);
+        m_nodes[0] = Node {};
+        m_nodes[0].box = m_box;
+        m_free_children.clear();
+        m_entries.clear();
+        m_free_entries.clear();
+        m_locations.clear();
     }
 
-    bool Quadtree::is_leaf(const Node* node) const
+    bool Quadtree::is_leaf(Index node) const
     {
-        return !static_cast<bool>(node->children[0]);
-    }
-
-    transform::AABB Quadtree::compute_box(const transform::AABB& box, int i) const
-    {
-        auto origin = box.get_position();
-        auto child_size = box.get_size() / 2.0;
-        switch (i)
-        {
-        // North West
-        case 0:
-            return transform::AABB(origin, child_size);
-        // Norst East
-        case 1:
-            return transform::AABB(origin + transform::UnitVector(child_size.x, 0), child_size);
-        // South West
-        case 2:
-            return transform::AABB(origin + transform::UnitVector(0, child_size.y), child_size);
-        // South East
-        case 3:
-            return transform::AABB(origin + child_size, child_size);
-        default:
-            assert(false && "Invalid child index");
-            return transform::AABB();
-        }
+        return m_nodes[node].first_child == NoIndex;
     }
 
     int Quadtree::get_quadrant(
@@ -81,204 +65,304 @@ namespace obe::collision
             return -1;
     }
 
-    void Quadtree::add_internal(
-        Node* node, std::size_t depth, const transform::AABB& box, const Collider* value)
+    Quadtree::Index Quadtree::allocate_entry(const Collider* value)
     {
-        assert(node != nullptr);
-        assert(box.contains(value->get_bounding_box()));
-        if (is_leaf(node))
+        Index entry;
+        if (!m_free_entries.empty())
         {
-            // Insert the value in this node if possible
-            if (depth >= MaxDepth || node->values.size() < Threshold)
-                node->values.push_back(value);
-            // Otherwise, we split and we try again
-            else
-            {
-                split(node, box);
-                add_internal(node, depth, box, value);
-            }
+            entry = m_free_entries.back();
+            m_free_entries.pop_back();
         }
         else
         {
-            auto i = get_quadrant(box, value->get_bounding_box());
-            // Add the value in a child if the value is entirely contained in it
-            if (i != -1)
-                add_internal(node->children[static_cast<std::size_t>(i)].get(), depth + 1,
-                    compute_box(box, i), value);
-            // Otherwise, we add the value in the current node
-            else
-                node->values.push_back(value);
+            entry = static_cast<Index>(m_entries.size());
+            m_entries.emplace_back();
         }
+        m_entries[entry].value = value;
+        m_entries[entry].box = value->get_bounding_box();
+        return entry;
     }
 
-    void Quadtree::split(Node* node, const transform::AABB& box)
+    Quadtree::Index Quadtree::allocate_children(Index node)
     {
-        assert(node != nullptr);
-        assert(is_leaf(node) && "Only leaves can be split");
-        // Create children
-        for (auto& child : node->children)
-            child = std::make_unique<Node>();
-        // Assign values to children
-        auto new_values = std::vector<const Collider*>(); // New values for this node
-        for (const auto& value : node->values)
+        Index first_child;
+        if (!m_free_children.empty())
         {
-            auto i = get_quadrant(box, value->get_bounding_box());
-            if (i != -1)
-                node->children[static_cast<std::size_t>(i)]->values.push_back(value);
-            else
-                new_values.push_back(value);
+            first_child = m_free_children.back();
+            m_free_children.pop_back();
         }
-        node->values = std::move(new_values);
+        else
+        {
+            first_child = static_cast<Index>(m_nodes.size());
+            m_nodes.resize(m_nodes.size() + 4);
+        }
+        const transform::AABB& box = m_nodes[node].box;
+        const transform::UnitVector origin = box.get_position();
+        const transform::UnitVector child_size = box.get_size() / 2.0;
+        // North West, North East, South West, South East
+        const transform::UnitVector offsets[4] = { transform::UnitVector(0, 0),
+            transform::UnitVector(child_size.x, 0), transform::UnitVector(0, child_size.y),
+            child_size };
+        for (Index i = 0; i < 4; ++i)
+        {
+            Node& child = m_nodes[first_child + i];
+            child = Node {};
+            child.box = transform::AABB(origin + offsets[i], child_size);
+            child.parent = node;
+            child.depth = m_nodes[node].depth + 1;
+        }
+        return first_child;
     }
 
-    bool Quadtree::remove_internal(Node* node, const transform::AABB& box, const Collider* value)
+    void Quadtree::link_entry(Index node, Index entry)
     {
-        assert(node != nullptr);
-        assert(box.contains(value->get_bounding_box()));
-        if (is_leaf(node))
-        {
-            // Remove the value from node
-            remove_value(node, value);
-            return true;
-        }
+        Node& target = m_nodes[node];
+        Entry& linked = m_entries[entry];
+        linked.node = node;
+        linked.previous = NoIndex;
+        linked.next = target.first_entry;
+        if (target.first_entry != NoIndex)
+            m_entries[target.first_entry].previous = entry;
+        target.first_entry = entry;
+        target.entries_amount++;
+    }
+
+    void Quadtree::unlink_entry(Index entry)
+    {
+        Entry& unlinked = m_entries[entry];
+        Node& node = m_nodes[unlinked.node];
+        if (unlinked.previous != NoIndex)
+            m_entries[unlinked.previous].next = unlinked.next;
         else
+            node.first_entry = unlinked.next;
+        if (unlinked.next != NoIndex)
+            m_entries[unlinked.next].previous = unlinked.previous;
+        node.entries_amount--;
+        unlinked.node = NoIndex;
+        unlinked.previous = NoIndex;
+        unlinked.next = NoIndex;
+    }
+
+    void Quadtree::add_internal(Index node, Index entry)
+    {
+        assert(m_nodes[node].box.contains(m_entries[entry].box));
+        while (true)
         {
-            // Remove the value in a child if the value is entirely contained in it
-            auto i = get_quadrant(box, value->get_bounding_box());
-            if (i != -1)
+            if (is_leaf(node))
             {
-                if (remove_internal(node->children[static_cast<std::size_t>(i)].get(), compute_box(box, i),
-                        value))
-                    return try_merge(node);
+                // Insert the value in this node if possible
+                if (m_nodes[node].depth >= m_max_depth
+                    || m_nodes[node].entries_amount < m_threshold)
+                {
+                    link_entry(node, entry);
+                    return;
+                }
+                // Otherwise, we split and we try again
+                split(node);
             }
-            // Otherwise, we remove the value from the current node
+            const int i = get_quadrant(m_nodes[node].box, m_entries[entry].box);
+            // Add the value in a child if the value is entirely contained in it
+            if (i != -1)
+                node = m_nodes[node].first_child + static_cast<Index>(i);
+            // Otherwise, we add the value in the current node
             else
-                remove_value(node, value);
-            return false;
+            {
+                link_entry(node, entry);
+                return;
+            }
         }
     }
 
-    void Quadtree::remove_value(Node* node, const Collider* value)
+    void Quadtree::split(Index node)
     {
-        // Find the value in node->values
-        auto it = std::find_if(std::begin(node->values), std::end(node->values),
-            [this, &value](const auto& rhs) { return value == rhs; });
-        assert(it != std::end(node->values)
-            && "Trying to remove a value that is not present in the node");
-        // Swap with the last element and pop back
-        *it = std::move(node->values.back());
-        node->values.pop_back();
+        assert(is_leaf(node) && "Only leaves can be split");
+        const Index first_child = allocate_children(node);
+        m_nodes[node].first_child = first_child;
+        // Move the values contained in a quadrant to the matching child
+        Index entry = m_nodes[node].first_entry;
+        while (entry != NoIndex)
+        {
+            const Index next = m_entries[entry].next;
+            const int i = get_quadrant(m_nodes[node].box, m_entries[entry].box);
+            if (i != -1)
+            {
+                unlink_entry(entry);
+                link_entry(first_child + static_cast<Index>(i), entry);
+            }
+            entry = next;
+        }
     }
 
-    bool Quadtree::try_merge(Node* node)
+    bool Quadtree::try_merge(Index node)
     {
-        assert(node != nullptr);
         assert(!is_leaf(node) && "Only interior nodes can be merged");
-        auto nbValues = node->values.size();
-        for (const auto& child : node->children)
+        const Index first_child = m_nodes[node].first_child;
+        std::size_t values_amount = m_nodes[node].entries_amount;
+        for (Index child = first_child; child < first_child + 4; ++child)
         {
-            if (!is_leaf(child.get()))
+            if (!is_leaf(child))
                 return false;
-            nbValues += child->values.size();
+            values_amount += m_nodes[child].entries_amount;
         }
-        if (nbValues <= Threshold)
+        if (values_amount > m_threshold)
+            return false;
+        // Merge the values of all the children
+        for (Index child = first_child; child < first_child + 4; ++child)
         {
-            node->values.reserve(nbValues);
-            // Merge the values of all the children
-            for (const auto& child : node->children)
+            while (m_nodes[child].first_entry != NoIndex)
             {
-                for (const auto& value : child->values)
-                    node->values.push_back(value);
+                const Index entry = m_nodes[child].first_entry;
+                unlink_entry(entry);
+                link_entry(node, entry);
             }
-            // Remove the children
-            for (auto& child : node->children)
-                child.reset();
-            return true;
         }
-        else
-            return false;
+        // The children can be reused by the next split
+        m_free_children.push_back(first_child);
+        m_nodes[node].first_child = NoIndex;
+        return true;
+    }
+
+    void Quadtree::merge_ancestors(Index node)
+    {
+        // Merge the ancestors as long as they only contain leaves
+        for (Index parent = m_nodes[node].parent; parent != NoIndex;
+             parent = m_nodes[parent].parent)
+        {
+            if (!try_merge(parent))
+                break;
+        }
     }
 
-    void Quadtree::query_internal(Node* node, const transform::AABB& box,
-        const transform::AABB& query_box, std::vector<const Collider*>& values) const
+    void Quadtree::query_internal(
+        Index node, const transform::AABB& query_box, std::vector<const Collider*>& values) const
     {
-        assert(node != nullptr);
-        assert(query_box.intersects(box));
-        for (const auto& value : node->values)
+        const Node& current = m_nodes[node];
+        assert(query_box.intersects(current.box));
+        for (Index entry = current.first_entry; entry != NoIndex; entry = m_entries[entry].next)
         {
-            if (query_box.intersects(value->get_bounding_box()))
-                values.push_back(value);
+            if (query_box.intersects(m_entries[entry].box))
+                values.push_back(m_entries[entry].value);
         }
         if (!is_leaf(node))
         {
-            for (auto i = std::size_t(0); i < node->children.size(); ++i)
+            for (Index child = current.first_child; child < current.first_child + 4; ++child)
             {
-                auto child_box = compute_box(box, static_cast<int>(i));
-                if (query_box.intersects(child_box))
-                    query_internal(node->children[i].get(), child_box, query_box, values);
+                if (query_box.intersects(m_nodes[child].box))
+                    query_internal(child, query_box, values);
             }
         }
     }
 
     void Quadtree::find_all_intersections_internal(
-        Node* node, std::vector<std::pair<const Collider*, const Collider*>>& intersections) const
+        Index node, std::vector<std::pair<const Collider*, const Collider*>>& intersections) const
     {
+        const Node& current = m_nodes[node];
         // Find intersections between values stored in this node
         // Make sure to not report the same intersection twice
-        for (auto i = std::size_t(0); i < node->values.size(); ++i)
+        for (Index i = current.first_entry; i != NoIndex; i = m_entries[i].next)
         {
-            for (auto j = std::size_t(0); j < i; ++j)
+            for (Index j = m_entries[i].next; j != NoIndex; j = m_entries[j].next)
             {
-                if (node->values[i]->get_bounding_box().intersects(
-                        node->values[j]->get_bounding_box()))
-                    intersections.emplace_back(node->values[i], node->values[j]);
+                if (m_entries[i].box.intersects(m_entries[j].box))
+                    intersections.emplace_back(m_entries[j].value, m_entries[i].value);
             }
         }
         if (!is_leaf(node))
         {
             // Values in this node can intersect values in descendants
-            for (const auto& child : node->children)
+            for (Index child = current.first_child; child < current.first_child + 4; ++child)
             {
-                for (const auto& value : node->values)
-                    find_intersections_in_descendants(child.get(), value, intersections);
+                for (Index entry = current.first_entry; entry != NoIndex;
+                     entry = m_entries[entry].next)
+                    find_intersections_in_descendants(child, m_entries[entry], intersections);
             }
             // Find intersections in children
-            for (const auto& child : node->children)
-                find_all_intersections_internal(child.get(), intersections);
+            for (Index child = current.first_child; child < current.first_child + 4; ++child)
+                find_all_intersections_internal(child, intersections);
         }
     }
 
-    void Quadtree::find_intersections_in_descendants(Node* node, const Collider* value,
+    void Quadtree::find_intersections_in_descendants(Index node, const Entry& entry,
         std::vector<std::pair<const Collider*, const Collider*>>& intersections) const
     {
+        const Node& current = m_nodes[node];
         // Test against the values stored in this node
-        for (const auto& other : node->values)
+        for (Index other = current.first_entry; other != NoIndex; other = m_entries[other].next)
         {
-            if (value->get_bounding_box().intersects(other->get_bounding_box()))
-                intersections.emplace_back(value, other);
+            if (entry.box.intersects(m_entries[other].box))
+                intersections.emplace_back(entry.value, m_entries[other].value);
         }
         // Test against values stored into descendants of this node
         if (!is_leaf(node))
         {
-            for (const auto& child : node->children)
-                find_intersections_in_descendants(child.get(), value, intersections);
+            for (Index child = current.first_child; child < current.first_child + 4; ++child)
+                find_intersections_in_descendants(child, entry, intersections);
         }
     }
 
     void Quadtree::add(const Collider* value)
     {
-        add_internal(m_root.get(), 0, m_box, value);
+        if (m_locations.contains(value))
+        {
+            update(value);
+            return;
+        }
+        const Index entry = allocate_entry(value);
+        m_locations.emplace(value, entry);
+        add_internal(0, entry);
     }
 
     void Quadtree::remove(const Collider* value)
     {
-        remove_internal(m_root.get(), m_box, value);
+        const auto location = m_locations.find(value);
+        if (location == m_locations.end())
+            return;
+        const Index entry = location->second;
+        m_locations.erase(location);
+        const Index node = m_entries[entry].node;
+        unlink_entry(entry);
+        m_entries[entry].value = nullptr;
+        m_free_entries.push_back(entry);
+        merge_ancestors(node);
+    }
+
+    bool Quadtree::update(const Collider* value)
+    {
+        const auto location = m_locations.find(value);
+        if (location == m_locations.end())
+            return false;
+        const Index entry = location->second;
+        m_entries[entry].box = value->get_bounding_box();
+        // The value can stay where it is as long as its node still contains it
+        const Index node = m_entries[entry].node;
+        if (m_nodes[node].box.contains(m_entries[entry].box))
+            return false;
+        unlink_entry(entry);
+        merge_ancestors(node);
+        add_internal(0, entry);
+        return true;
+    }
+
+    bool Quadtree::contains(const Collider* value) const
+    {
+        return m_locations.contains(value);
+    }
+
+    std::size_t Quadtree::get_threshold() const
+    {
+        return m_threshold;
+    }
+
+    std::size_t Quadtree::get_max_depth() const
+    {
+        return m_max_depth;
     }
 
     std::vector<const Collider*> Quadtree::query(const transform::AABB& box) const
     {
         auto values = std::vector<const Collider*>();
-        query_internal(m_root.get(), m_box, box, values);
+        if (box.intersects(m_box))
+            query_internal(0, box, values);
         return values;
     }
 
@@ -286,7 +370,7 @@ namespace obe::collision
     Quadtree::find_all_intersections() const
     {
         auto intersections = std::vector<std::pair<const Collider*, const Collider*>>();
-        find_all_intersections_internal(m_root.get(), intersections);
+        find_all_intersections_internal(0, intersections);
         return intersections;
     }
-}
\ No newline at end of file
+}
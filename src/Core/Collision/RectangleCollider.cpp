@@ -18,6 +18,7 @@ namespace obe::collision
         m_shape.min.y = m_position.y;
         m_shape.max.x = m_position.x + m_size.x;
         m_shape.max.y = m_position.y + m_size.y;
+        this->notify_transform_change();
     }
 
     ColliderType RectangleCollider::get_collider_type() const
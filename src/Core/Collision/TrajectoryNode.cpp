@@ -4,8 +4,6 @@
 #include <Collision/TrajectoryNode.hpp>
 #include <Utils/MathUtils.hpp>
 
-#include <Debug/Logger.hpp> // TODO: Remove logs
-
 namespace obe::collision
 {
     TrajectoryNode::TrajectoryNode(scene::SceneNode& scene_node)
@@ -80,32 +78,27 @@ namespace obe::collision
                     base_offset = get_offset(*current_trajectory);
                     obe::collision::CollisionData collision_data;
                     collision_data.offset = base_offset;
+                    bool collided = false;
                     if (m_probe != nullptr && m_collision_space != nullptr)
                     {
-                        std::vector<ReachableCollider> reachable_colliders
-                            = m_collision_space->get_reachable_colliders(
-                                *m_probe, collision_data.offset);
-                        std::vector<ReachableCollider> reachable_and_validated_colliders;
-                        auto trajectory_reachable_collider_acceptor
+                        const ReachableColliderAcceptor& acceptor
                             = trajectory.second->get_reachable_collider_acceptor();
-                        for (const ReachableCollider& reachable_collider : reachable_colliders)
+                        // Hits are sorted by time of impact, the first accepted one stops the probe
+                        for (const SweepHit& hit :
+                            m_collision_space->sweep(*m_probe, collision_data.offset))
                         {
-                            if (!trajectory_reachable_collider_acceptor
-                                || trajectory_reachable_collider_acceptor(*trajectory.second, reachable_collider.first))
+                            if (!acceptor || acceptor(*trajectory.second, hit.collider))
                             {
-                                reachable_and_validated_colliders.push_back(reachable_collider);
+                                collision_data.offset = hit.offset;
+                                collided = true;
+                                break;
                             }
                         }
-                        collision_data.offset = m_collision_space->get_offset_before_collision(
-                            *m_probe, reachable_and_validated_colliders, collision_data.offset);
-                        /* debug::Log->debug(
-                            "<TrajectoryNode> Trajectory '{}'\tBase Offset {}\tOffset {}\tNormal {}\tTOI {}\tDT {}",
-                            trajectory.first, base_offset, collision_data.offset, offset_normal, collision_data.offset.x / base_offset.x, dt);*/
                     }
 
                     m_scene_node.move(collision_data.offset);
                     auto on_collide_callback = trajectory.second->get_on_collide_callback();
-                    if (collision_data.offset != base_offset && on_collide_callback)
+                    if (collided && on_collide_callback)
                     {
                         on_collide_callback(*trajectory.second, collision_data.offset, m_probe);
                     }
@@ -0,0 +1,107 @@
+#include <cstdint>
+
+#include <vili-msgpack/msgpack.hpp>
+#include <vili/parser.hpp>
+
+#include <Config/CompiledVili.hpp>
+#include <Debug/Logger.hpp>
+#include <Utils/FileUtils.hpp>
+
+namespace obe::config
+{
+    namespace
+    {
+        // Header of compiled files : magic, format version and hash of the source
+        constexpr std::string_view CompiledViliMagic = "VILIC";
+        constexpr char CompiledViliVersion = 1;
+        constexpr std::size_t CompiledViliHeaderSize = CompiledViliMagic.size() + 1 + 8;
+
+        std::string make_header(std::uint64_t hash)
+        {
+            std::string header(CompiledViliMagic);
+            header.push_back(CompiledViliVersion);
+            for (int byte = 0; byte < 8; byte++)
+            {
+                header.push_back(static_cast<char>((hash >> (byte * 8)) & 0xff));
+            }
+            return header;
+        }
+
+        vili::node parse_source(const std::string& path, const std::string& source)
+        {
+            try
+            {
+                return vili::parser::from_string(source);
+            }
+            catch (const vili::exceptions::parsing_error&)
+            {
+                // Parsed again from the file so the error mentions its path
+                return vili::parser::from_file(path);
+            }
+        }
+    }
+
+    std::string get_compiled_vili_path(const std::string& path)
+    {
+        if (path.ends_with(".vili"))
+        {
+            return path + "c";
+        }
+        return path + ".vilic";
+    }
+
+    vili::node load_vili_file(const std::string& path)
+    {
+        std::string source;
+        if (!utils::file::read_file(path, source))
+        {
+            // Raises the same errors as before for missing files
+            return vili::parser::from_file(path);
+        }
+        const std::string compiled_path = get_compiled_vili_path(path);
+        const std::string header = make_header(utils::file::hash_content(source));
+        std::string compiled;
+        if (utils::file::read_file(compiled_path, compiled) && compiled.size() > header.size()
+            && compiled.compare(0, header.size(), header) == 0)
+        {
+            try
+            {
+                return vili::msgpack::from_string(compiled.substr(CompiledViliHeaderSize));
+            }
+            catch (const std::exception& e)
+            {
+                OBE_DEBUG("<CompiledVili> Ignoring invalid compiled file {} : {}", compiled_path,
+                    e.what());
+            }
+        }
+        return parse_source(path, source);
+    }
+
+    bool compile_vili_file(const std::string& path)
+    {
+        std::string source;
+        if (!utils::file::read_file(path, source))
+        {
+            debug::Log->error("<CompiledVili> Can't read vili file {}", path);
+            return false;
+        }
+        std::string compiled;
+        try
+        {
+            compiled = make_header(utils::file::hash_content(source))
+                + vili::msgpack::to_string(parse_source(path, source));
+        }
+        catch (const std::exception& e)
+        {
+            debug::Log->error("<CompiledVili> Can't compile vili file {} : {}", path, e.what());
+            return false;
+        }
+        const std::string compiled_path = get_compiled_vili_path(path);
+        if (!utils::file::write_file(compiled_path, compiled))
+        {
+            debug::Log->error("<CompiledVili> Can't write compiled vili file {}", compiled_path);
+            return false;
+        }
+        return true;
+    }
+} // namespace obe::config
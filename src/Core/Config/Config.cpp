@@ -1,6 +1,8 @@
-#include <vili/parser.hpp>
+#include <set>
+
 #include <vld8/validator.hpp>
 
+#include <Config/CompiledVili.hpp>
 #include <Config/Config.hpp>
 #include <Config/Exceptions.hpp>
 #include <Config/Validators.hpp>
@@ -33,8 +35,8 @@ namespace obe::config
         for (const auto& find_result : load_result)
         {
             debug::Log->info("Loading config file from '{}'", find_result.path());
-            vili::node conf = vili::parser::from_file(find_result.path());
-            debug::Log->trace("Configuration '{}' content : {}", find_result.path(), conf.dump());
+            vili::node conf = load_vili_file(find_result.path());
+            OBE_TRACE("Configuration '{}' content : {}", find_result.path(), conf.dump());
             this->merge(conf);
         }
         try
@@ -139,6 +139,61 @@ namespace obe::config::validators
                     }
                 }
             },
+            {
+                "Graphics", vili::object {
+                    {"type", vili::object_typename},
+                    {"optional", true},
+                    {
+                        "properties", vili::object {
+                            {
+                                "antiAliasing", vili::object {
+                                    {"type", vili::boolean_typename},
+                                    {"optional", true}
+                                }
+                            },
+                            {
+                                "Atlas", vili::object {
+                                    {"type", vili::object_typename},
+                                    {"optional", true},
+                                    {
+                                        "properties", vili::object {
+                                            {
+                                                "pageSize", vili::object {
+                                                    {"type", vili::integer_typename},
+                                                    {"min", 1},
+                                                    {"optional", true}
+                                                }
+                                            },
+                                            {
+                                                "maxTextureSize", vili::object {
+                                                    {"type", vili::integer_typename},
+                                                    {"min", 0},
+                                                    {"optional", true}
+                                                }
+                                            },
+                                            {
+                                                "cache", vili::object {
+                                                    {"type", vili::string_typename},
+                                                    {"optional", true}
+                                                }
+                                            },
+                                            {
+                                                "paths", vili::object {
+                                                    {"type", vili::array_typename},
+                                                    {"items", vili::object {
+                                                        {"type", vili::string_typename}
+                                                    }},
+                                                    {"optional", true}
+                                                }
+                                            }
+                                        }
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            },
             {
                 "Framerate", vili::object {
                     {"type", vili::object_typename},
@@ -167,6 +222,24 @@ namespace obe::config::validators
                     }
                 }
             },
+            {
+                "Jobs", vili::object {
+                    {"type", vili::object_typename},
+                    {"optional", true},
+                    {
+                        "properties", vili::object {
+                            {
+                                "workers", vili::object {
+                                    {"type", vili::integer_typename},
+                                    {"min", 0},
+                                    {"max", 256},
+                                    {"optional", true}
+                                }
+                            }
+                        }
+                    }
+                }
+            },
             {
                 "GameConfig", vili::object {
                     {"type", vili::object_typename},
@@ -197,6 +270,56 @@ namespace obe::config::validators
                                                     {"type", vili::string_typename},
                                                     {"values", vili::array {"Trace", "Debug", "Info", "Warn", "Error", "Critical", "Off"}},
                                                 }
+                                            },
+                                            {
+                                                "async", vili::object {
+                                                    {"type", vili::object_typename},
+                                                    {"optional", true},
+                                                    {
+                                                        "properties", vili::object {
+                                                            {
+                                                                "enabled", vili::object {
+                                                                    {"type", vili::boolean_typename}
+                                                                }
+                                                            },
+                                                            {
+                                                                "queueSize", vili::object {
+                                                                    {"type", vili::integer_typename},
+                                                                    {"min", 1},
+                                                                    {"optional", true}
+                                                                }
+                                                            },
+                                                            {
+                                                                "overflow", vili::object {
+                                                                    {"type", vili::string_typename},
+                                                                    {"values", vili::array {"Block", "Drop"}},
+                                                                    {"optional", true}
+                                                                }
+                                                            }
+                                                        }
+                                                    }
+                                                }
+                                            }
+                                        }
+                                    }
+                                }
+                            },
+                            {
+                                "Profiler", vili::object {
+                                    {"type", vili::object_typename},
+                                    {"optional", true},
+                                    {
+                                        "properties", vili::object {
+                                            {
+                                                "enabled", vili::object {
+                                                    {"type", vili::boolean_typename}
+                                                }
+                                            },
+                                            {
+                                                "trace", vili::object {
+                                                    {"type", vili::string_typename},
+                                                    {"optional", true}
+                                                }
                                             }
                                         }
                                     }
@@ -226,6 +349,66 @@ namespace obe::config::validators
                                                     {"type", vili::string_typename},
                                                     {"values", vili::array {"stop", "incremental", "generational"}},
                                                 }
+                                            },
+                                            {
+                                                "bytecodeCache", vili::object {
+                                                    {"type", vili::string_typename},
+                                                    {"optional", true}
+                                                }
+                                            },
+                                            {
+                                                "lazyBindings", vili::object {
+                                                    {"type", vili::boolean_typename},
+                                                    {"optional", true}
+                                                }
+                                            },
+                                            {
+                                                "batchedUpdates", vili::object {
+                                                    {"type", vili::boolean_typename},
+                                                    {"optional", true}
+                                                }
+                                            },
+                                            {
+                                                "GarbageCollector", vili::object {
+                                                    {"type", vili::object_typename},
+                                                    {"optional", true},
+                                                    {
+                                                        "properties", vili::object {
+                                                            {
+                                                                "enabled", vili::object {
+                                                                    {"type", vili::boolean_typename}
+                                                                }
+                                                            },
+                                                            {
+                                                                "budget", vili::object {
+                                                                    {"type", vili::number_typename},
+                                                                    {"optional", true}
+                                                                }
+                                                            },
+                                                            {
+                                                                "stepSize", vili::object {
+                                                                    {"type", vili::integer_typename},
+                                                                    {"min", 1},
+                                                                    {"optional", true}
+                                                                }
+                                                            },
+                                                            {
+                                                                "pause", vili::object {
+                                                                    {"type", vili::integer_typename},
+                                                                    {"min", 100},
+                                                                    {"optional", true}
+                                                                }
+                                                            },
+                                                            {
+                                                                "limit", vili::object {
+                                                                    {"type", vili::integer_typename},
+                                                                    {"min", 100},
+                                                                    {"optional", true}
+                                                                }
+                                                            }
+                                                        }
+                                                    }
+                                                }
                                             }
                                         }
                                     }
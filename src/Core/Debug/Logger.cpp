@@ -1,6 +1,10 @@
+#include <cstdlib>
+#include <exception>
+
 #include <Debug/Logger.hpp>
 #include <Utils/FileUtils.hpp>
 
+#include <spdlog/async.h>
 #include <spdlog/sinks/basic_file_sink.h>
 #include <spdlog/sinks/dist_sink.h>
 #include <spdlog/sinks/stdout_color_sinks.h>
@@ -14,25 +18,97 @@
 
 namespace obe::debug
 {
+    namespace
+    {
+        // Shared by the synchronous and asynchronous loggers, the mutex of the
+        // distribution sink guards the sinks while both of them are alive
+        std::shared_ptr<spdlog::sinks::dist_sink_mt> LogSinks;
+        // Queue and writer thread of the asynchronous logger
+        std::shared_ptr<spdlog::details::thread_pool> LogThreadPool;
+        std::terminate_handler PreviousTerminateHandler = nullptr;
+
+        void replace_logger(Logger logger)
+        {
+            logger->set_pattern("[%H:%M:%S.%e]<%^%l%$> : %v");
+            logger->set_level(Log ? Log->level() : spdlog::level::info);
+            logger->flush_on(spdlog::level::warn);
+            Log = std::move(logger);
+        }
+
+        void flush_on_exit()
+        {
+            disable_async_logging();
+        }
+
+        void flush_on_terminate()
+        {
+            disable_async_logging();
+            if (PreviousTerminateHandler)
+            {
+                PreviousTerminateHandler();
+            }
+            std::abort();
+        }
+    }
+
     Logger Log;
     void init_logger(bool dump_log_to_file)
     {
+        disable_async_logging();
         utils::file::delete_file("debug.log");
-        auto dist_sink = std::make_shared<spdlog::sinks::dist_sink_st>();
+        LogSinks = std::make_shared<spdlog::sinks::dist_sink_mt>();
 
         const auto sink1 = std::make_shared<spdlog::sinks::stdout_color_sink_st>();
-        dist_sink->add_sink(sink1);
+        LogSinks->add_sink(sink1);
 
         if (dump_log_to_file)
         {
             const auto sink2 = std::make_shared<spdlog::sinks::basic_file_sink_st>("debug.log");
-            dist_sink->add_sink(sink2);
+            LogSinks->add_sink(sink2);
         }
 
-        Log = std::make_shared<spdlog::logger>("Log", dist_sink);
-        Log->set_pattern("[%H:%M:%S.%e]<%^%l%$> : %v");
-        Log->set_level(spdlog::level::info);
-        Log->flush_on(spdlog::level::warn);
+        Log.reset();
+        replace_logger(std::make_shared<spdlog::logger>("Log", LogSinks));
+    }
+
+    void enable_async_logging(std::size_t queue_size, LogOverflowPolicy overflow_policy)
+    {
+        static bool exit_handlers_installed = false;
+        if (!exit_handlers_installed)
+        {
+            std::atexit(&flush_on_exit);
+            PreviousTerminateHandler = std::set_terminate(&flush_on_terminate);
+            exit_handlers_installed = true;
+        }
+
+        disable_async_logging();
+        LogThreadPool = std::make_shared<spdlog::details::thread_pool>(queue_size, 1);
+        const spdlog::async_overflow_policy policy = (overflow_policy == LogOverflowPolicy::Drop)
+            ? spdlog::async_overflow_policy::overrun_oldest
+            : spdlog::async_overflow_policy::block;
+        replace_logger(
+            std::make_shared<spdlog::async_logger>("Log", LogSinks, LogThreadPool, policy));
+    }
+
+    void disable_async_logging()
+    {
+        if (!LogThreadPool)
+        {
+            return;
+        }
+        replace_logger(std::make_shared<spdlog::logger>("Log", LogSinks));
+        // The thread pool writes the remaining queued messages before joining its thread
+        LogThreadPool.reset();
+        LogSinks->flush();
+    }
+
+    void flush_logger()
+    {
+        if (Log)
+        {
+            // Queued after the pending messages when logging asynchronously
+            Log->flush();
+        }
     }
 
     void trace(const std::string& content)
@@ -0,0 +1,189 @@
+#include <fstream>
+
+#include <fmt/format.h>
+
+#include <Debug/Profiler.hpp>
+
+namespace obe::debug
+{
+    namespace
+    {
+        std::string escape_json(std::string_view value)
+        {
+            std::string escaped;
+            escaped.reserve(value.size());
+            for (const char character : value)
+            {
+                switch (character)
+                {
+                case '"':
+                    escaped += "\\\"";
+                    break;
+                case '\\':
+                    escaped += "\\\\";
+                    break;
+                case '\n':
+                    escaped += "\\n";
+                    break;
+                case '\t':
+                    escaped += "\\t";
+                    break;
+                default:
+                    if (static_cast<unsigned char>(character) < 0x20)
+                    {
+                        escaped += fmt::format("\\u{:04x}", static_cast<int>(character));
+                    }
+                    else
+                    {
+                        escaped += character;
+                    }
+                }
+            }
+            return escaped;
+        }
+    }
+
+    Profiler Profile;
+
+    time::TimeUnit Profiler::elapsed_since(Clock::time_point start) const
+    {
+        return std::chrono::duration<time::TimeUnit>(Clock::now() - start).count();
+    }
+
+    void Profiler::close_open_scopes()
+    {
+        while (!m_open_scopes.empty())
+        {
+            this->end_scope();
+        }
+    }
+
+    void Profiler::set_enabled(bool enabled)
+    {
+        if (m_enabled == enabled)
+        {
+            return;
+        }
+        m_enabled = enabled;
+        m_samples.clear();
+        m_open_scopes.clear();
+        m_frame_start = Clock::now();
+    }
+
+    void Profiler::next_frame()
+    {
+        if (!m_enabled)
+        {
+            return;
+        }
+        this->close_open_scopes();
+        m_last_frame_duration = this->elapsed_since(m_frame_start);
+        if (m_capturing)
+        {
+            const time::TimeUnit frame_offset
+                = std::chrono::duration<time::TimeUnit>(m_frame_start - m_origin).count();
+            for (const ProfilerSample& sample : m_samples)
+            {
+                if (m_trace.size() >= m_capture_limit)
+                {
+                    m_capturing = false;
+                    break;
+                }
+                m_trace.push_back(sample);
+                m_trace.back().start += frame_offset;
+            }
+        }
+        // Swapping keeps the capacity of both buffers between frames
+        m_last_frame_samples.swap(m_samples);
+        m_samples.clear();
+        m_frame_start = Clock::now();
+    }
+
+    void Profiler::begin_scope(std::string_view name, std::string_view detail)
+    {
+        if (!m_enabled)
+        {
+            return;
+        }
+        m_open_scopes.push_back(m_samples.size());
+        ProfilerSample& sample = m_samples.emplace_back();
+        sample.name = name;
+        sample.detail = detail;
+        sample.depth = m_open_scopes.size() - 1;
+        sample.start = this->elapsed_since(m_frame_start);
+    }
+
+    void Profiler::end_scope()
+    {
+        if (m_open_scopes.empty())
+        {
+            return;
+        }
+        ProfilerSample& sample = m_samples[m_open_scopes.back()];
+        sample.duration = this->elapsed_since(m_frame_start) - sample.start;
+        m_open_scopes.pop_back();
+    }
+
+    const std::vector<ProfilerSample>& Profiler::get_last_frame_samples() const
+    {
+        return m_last_frame_samples;
+    }
+
+    time::TimeUnit Profiler::get_last_frame_duration() const
+    {
+        return m_last_frame_duration;
+    }
+
+    std::unordered_map<std::string, time::TimeUnit> Profiler::get_last_frame_timings() const
+    {
+        std::unordered_map<std::string, time::TimeUnit> timings;
+        for (const ProfilerSample& sample : m_last_frame_samples)
+        {
+            timings[sample.name] += sample.duration;
+        }
+        return timings;
+    }
+
+    void Profiler::start_capture(std::size_t max_samples)
+    {
+        m_trace.clear();
+        m_capture_limit = max_samples;
+        m_capturing = true;
+    }
+
+    void Profiler::stop_capture()
+    {
+        m_capturing = false;
+    }
+
+    bool Profiler::is_capturing() const
+    {
+        return m_capturing;
+    }
+
+    bool Profiler::save_chrome_trace(const std::string& path) const
+    {
+        std::ofstream trace_file(path);
+        if (!trace_file)
+        {
+            return false;
+        }
+        trace_file << "{\"traceEvents\":[";
+        for (std::size_t i = 0; i < m_trace.size(); i++)
+        {
+            const ProfilerSample& sample = m_trace[i];
+            trace_file << (i ? ",\n" : "\n")
+                       << fmt::format("{{\"name\":\"{}\",\"cat\":\"obe\",\"ph\":\"X\","
+                                      "\"ts\":{:.3f},\"dur\":{:.3f},\"pid\":1,\"tid\":1",
+                              escape_json(sample.name), sample.start / time::microseconds,
+                              sample.duration / time::microseconds);
+            if (!sample.detail.empty())
+            {
+                trace_file << ",\"args\":{\"detail\":\"" << escape_json(sample.detail) << "\"}";
+            }
+            trace_file << "}";
+        }
+        trace_file << "\n],\"displayTimeUnit\":\"ms\"}\n";
+        return static_cast<bool>(trace_file);
+    }
+} // namespace obe::debug
@@ -1,9 +1,12 @@
 #include <fstream>
 
+#include <Debug/Profiler.hpp>
 #include <Engine/Engine.hpp>
 #include <Engine/Exceptions.hpp>
 #include <Input/InputSourceMouse.hpp>
+#include <Script/BytecodeCache.hpp>
 #include <Script/LuaHelpers.hpp>
+#include <Time/TimeUtils.hpp>
 #include <Utils/FileUtils.hpp>
 
 
@@ -63,16 +66,30 @@ namespace obe::engine
 
         this->init_plugins();
 
-        bindings::index_core_bindings(*m_lua);
-
-        m_lua->load_config(m_config.at("Script").at("Lua"));
-
-        m_lua->safe_script_file("obe://Lib/Internal/Helpers.lua"_fs);
-        m_lua->safe_script_file("obe://Lib/Internal/Events.lua"_fs);
-        m_lua->safe_script_file("obe://Lib/Internal/GameInit.lua"_fs);
-        m_lua->safe_script_file("obe://Lib/Internal/Logger.lua"_fs);
+        const vili::node& lua_config = m_config.at("Script").at("Lua");
+        const bool lazy_bindings
+            = lua_config.contains("lazyBindings") && lua_config.at("lazyBindings").as_boolean();
+        const time::TimeUnit bindings_start = time::epoch();
+        const int heap_before = lua_gc(m_lua->lua_state(), LUA_GCCOUNT, 0);
+        bindings::index_core_bindings(*m_lua,
+            lazy_bindings ? bindings::BindingsLoading::Lazy : bindings::BindingsLoading::Eager);
+        debug::Log->debug("<Engine> Indexed {} Lua bindings in {:.2f}ms, Lua heap grew by {}KB",
+            lazy_bindings ? "lazy" : "eager", (time::epoch() - bindings_start) / time::milliseconds,
+            lua_gc(m_lua->lua_state(), LUA_GCCOUNT, 0) - heap_before);
+
+        m_lua->load_config(lua_config);
+
+        script::run_script_file(*m_lua, "obe://Lib/Internal/Helpers.lua"_fs);
+        script::run_script_file(*m_lua, "obe://Lib/Internal/Events.lua"_fs);
+        script::run_script_file(*m_lua, "obe://Lib/Internal/GameInit.lua"_fs);
+        script::run_script_file(*m_lua, "obe://Lib/Internal/Logger.lua"_fs);
         m_lua->set_exception_handler(&lua_exception_handler);
-        m_lua->safe_script("collectgarbage(\"generational\");");
+
+        m_garbage_collector = std::make_unique<script::GarbageCollector>(*m_lua);
+        if (lua_config.contains("GarbageCollector"))
+        {
+            m_garbage_collector->configure(lua_config.at("GarbageCollector"));
+        }
 
         (*m_lua)["Engine"] = this;
     }
@@ -93,6 +110,20 @@ namespace obe::engine
         e_custom = m_user_event_namespace->create_group("Custom");
         e_custom->set_joinable(true);
 
+        const vili::node& lua_config = m_config.at("Script").at("Lua");
+        if (lua_config.contains("batchedUpdates") && lua_config.at("batchedUpdates").as_boolean())
+        {
+            // Update callbacks of the scripts are called by a single listener,
+            // must be enabled before any script listens to Event.Game.Update
+            sol::table update_dispatcher
+                = m_lua->safe_script("return require(\"obe://Lib/Internal/UpdateDispatcher\");");
+            update_dispatcher["enabled"] = true;
+            e_game->get(events::Game::Update::id.data())
+                .add_external_listener("UpdateDispatcher",
+                    event::LuaEventListener(
+                        update_dispatcher["dispatch"].get<sol::protected_function>()));
+        }
+
         e_game->trigger(events::Game::Start {});
     }
 
@@ -109,6 +140,10 @@ namespace obe::engine
                     m_resources->default_anti_aliasing);
             }
         }
+        if (m_config.contains("Graphics") && m_config.at("Graphics").contains("Atlas"))
+        {
+            m_resources->configure_atlas(m_config.at("Graphics").at("Atlas"));
+        }
     }
 
     void Engine::init_window()
@@ -123,6 +158,27 @@ namespace obe::engine
         m_cursor = std::make_unique<system::Cursor>(*m_window, *m_event_namespace);
     }
 
+    void Engine::init_jobs()
+    {
+        std::size_t workers_amount = 0;
+        if (m_config.contains("Jobs") && m_config.at("Jobs").contains("workers"))
+        {
+            const vili::integer workers = m_config.at("Jobs").at("workers").as<vili::integer>();
+            if (workers < 0)
+            {
+                debug::Log->warn("<JobPool> Invalid amount of workers {}, using the default "
+                                 "amount instead",
+                    workers);
+            }
+            else
+            {
+                workers_amount = static_cast<std::size_t>(workers);
+            }
+        }
+        m_jobs = std::make_unique<system::JobPool>(workers_amount);
+        debug::Log->debug("<JobPool> Started {} workers", m_jobs->get_workers_amount());
+    }
+
     void Engine::init_plugins()
     {
         debug::Log->info("<Bindings> Checking Plugins on Mounted Path : {0}",
@@ -153,9 +209,10 @@ namespace obe::engine
     {
         m_scene = std::make_unique<scene::Scene>(*m_event_namespace, *m_lua);
         m_scene->attach_resource_manager(*m_resources);
+        m_scene->get_collision_space().set_job_pool(m_jobs.get());
     }
 
-    void Engine::init_logger() const
+    void Engine::init_logger()
     {
         if (m_config.contains("Debug"))
         {
@@ -163,6 +220,26 @@ namespace obe::engine
             if (debug.contains("Logging"))
             {
                 vili::node logging = debug.at("Logging");
+                if (logging.contains("async") && logging.at("async").contains("enabled")
+                    && logging.at("async").at("enabled").as<vili::boolean>())
+                {
+                    const vili::node& async = logging.at("async");
+                    std::size_t queue_size = 8192;
+                    debug::LogOverflowPolicy overflow_policy = debug::LogOverflowPolicy::Block;
+                    if (async.contains("queueSize"))
+                    {
+                        queue_size = async.at("queueSize").as<vili::integer>();
+                    }
+                    if (async.contains("overflow"))
+                    {
+                        overflow_policy = debug::LogOverflowPolicyMeta::from_string(
+                            async.at("overflow").as<vili::string>());
+                    }
+                    debug::enable_async_logging(queue_size, overflow_policy);
+                    m_log = debug::Log;
+                    debug::Log->info("Asynchronous logging enabled (queue of {} messages)",
+                        queue_size);
+                }
                 if (logging.contains("level"))
                 {
                     std::string log_level_config_entry = logging.at("level");
@@ -176,6 +253,27 @@ namespace obe::engine
         }
     }
 
+    void Engine::init_profiler()
+    {
+        if (m_config.contains("Debug") && m_config.at("Debug").contains("Profiler"))
+        {
+            const vili::node& profiler = m_config.at("Debug").at("Profiler");
+            if (profiler.contains("enabled") && profiler.at("enabled").as<vili::boolean>())
+            {
+                debug::Profile.set_enabled(true);
+                if (profiler.contains("trace"))
+                {
+                    m_profiler_trace_path = profiler.at("trace").as<vili::string>();
+                }
+                if (!m_profiler_trace_path.empty())
+                {
+                    debug::Profile.start_capture();
+                }
+                debug::Log->info("Profiler enabled");
+            }
+        }
+    }
+
     void Engine::clean() const
     {
         if (e_game)
@@ -185,7 +283,7 @@ namespace obe::engine
         if (m_scene)
         {
             m_scene->clear();
-            m_scene->update();
+            m_scene->update(0);
         }
         script::GameObjectDatabase::clear();
         if (m_window)
@@ -211,6 +309,10 @@ namespace obe::engine
             m_lua->collect_garbage();
         }
         debug::Log->debug("Cleaning ResourceManager");
+        if (m_resources)
+        {
+            m_resources->save_atlas();
+        }
         m_resources.reset();
         debug::Log->debug("Cleaning Game Events");
         e_game.reset();
@@ -218,14 +320,17 @@ namespace obe::engine
         debug::Log->debug("Cleaning InputManager");
         m_input.reset();
         debug::Log->debug("Cleaning Lua State");
+        m_garbage_collector.reset();
         m_lua.reset();
         debug::Log->debug("Cleaning Events");
         if (m_events)
         {
             m_events->clear();
-            m_events->update();
+            m_events->update(0);
         }
         m_events.reset();
+        debug::Log->debug("Cleaning JobPool");
+        m_jobs.reset();
     }
 
     void Engine::deinit_plugins()
@@ -295,6 +400,8 @@ namespace obe::engine
 
         this->init_config();
         this->init_logger();
+        this->init_profiler();
+        this->init_jobs();
         this->init_script();
         this->init_events();
         this->init_input();
@@ -315,8 +422,14 @@ namespace obe::engine
         const std::string boot_script = "*://boot.lua"_fs;
         if (boot_script.empty())
             throw exceptions::BootScriptMissing(system::MountablePath::string_paths(), EXC_INFO);
-        const sol::protected_function_result load_result = m_lua->safe_script_file(boot_script);
-
+        sol::load_result boot_chunk = script::ScriptCache.load_file(*m_lua, boot_script);
+        if (!boot_chunk.valid())
+        {
+            const auto err_obj = boot_chunk.get<sol::error>();
+            throw exceptions::BootScriptLoadingError(err_obj.what(), EXC_INFO);
+        }
+        const sol::protected_function_result load_result
+            = boot_chunk.get<sol::protected_function>()();
         if (!load_result.valid())
         {
             const auto err_obj = load_result.get<sol::error>();
@@ -342,24 +455,48 @@ namespace obe::engine
 
             if (m_framerate->should_update())
             {
-                e_game->trigger(events::Game::Update { m_framerate->get_delta_time() });
+                debug::Profile.next_frame();
+                OBE_PROFILE_SCOPE("Engine::update");
+                e_game->trigger(events::Game::Update { m_framerate->get_update_delta_time() });
                 this->update();
             }
 
             if (m_framerate->should_render())
             {
+                OBE_PROFILE_SCOPE("Engine::render");
                 e_game->trigger(events::Game::Render {});
                 this->render();
                 m_framerate->reset();
+                m_garbage_collector->end_frame();
             }
             else
             {
-                // m_lua->collect_garbage();
-                // m_lua->collect_garbage();
+                m_garbage_collector->collect_in_slack(m_framerate->get_time_before_next_frame());
             }
         }
         time::TimeUnit total_time = time::epoch() - start;
         debug::Log->info("Execution completed in {} seconds", total_time);
+        if (m_garbage_collector->is_enabled())
+        {
+            const script::GarbageCollectorStatistics& gc = m_garbage_collector->get_statistics();
+            debug::Log->debug("<GarbageCollector> {} cycles in {} steps ({} frames without slack, "
+                              "{} full collections), longest frame pause: {:.3f}ms, "
+                              "total: {:.3f}ms",
+                gc.cycles, gc.steps, gc.forced_frames, gc.full_collections,
+                gc.max_frame_pause / time::milliseconds, gc.total_pause / time::milliseconds);
+        }
+        if (!m_profiler_trace_path.empty())
+        {
+            debug::Profile.next_frame();
+            if (debug::Profile.save_chrome_trace(m_profiler_trace_path))
+            {
+                debug::Log->info("Profiler trace written to {}", m_profiler_trace_path);
+            }
+            else
+            {
+                debug::Log->warn("Could not write Profiler trace to {}", m_profiler_trace_path);
+            }
+        }
     }
 
     audio::AudioManager& Engine::get_audio_manager()
@@ -407,11 +544,21 @@ namespace obe::engine
         return *m_window;
     }
 
+    script::GarbageCollector& Engine::get_garbage_collector() const
+    {
+        return *m_garbage_collector;
+    }
+
     script::LuaState& Engine::get_lua_state() const
     {
         return *m_lua;
     }
 
+    system::JobPool& Engine::get_job_pool() const
+    {
+        return *m_jobs;
+    }
+
     debug::Logger Engine::get_logger() const
     {
         return m_log.lock();
@@ -425,11 +572,20 @@ namespace obe::engine
     void Engine::update() const
     {
         // Events
-        this->handle_window_events();
+        {
+            OBE_PROFILE_SCOPE("Engine::handle_window_events");
+            this->handle_window_events();
+        }
 
-        m_scene->update();
-        m_events->update();
-        m_input->update();
+        // Everything advances with the same scaled delta, the time since the previous
+        // update (several updates can happen between two rendered frames)
+        const time::TimeUnit dt = m_framerate->get_update_delta_time();
+        m_scene->update(dt);
+        m_events->update(dt);
+        {
+            OBE_PROFILE_SCOPE("InputManager::update");
+            m_input->update();
+        }
         m_cursor->update();
     }
 
@@ -439,6 +595,7 @@ namespace obe::engine
         {
             m_window->clear();
             m_scene->draw(m_window->get_target());
+            OBE_PROFILE_SCOPE("Window::display");
             m_window->display();
         }
     }
@@ -1,9 +1,71 @@
+#include <filesystem>
+
+#include <Animation/Animator.hpp>
 #include <Engine/Exceptions.hpp>
 #include <Engine/ResourceManager.hpp>
 #include <System/Path.hpp>
+#include <Utils/StringUtils.hpp>
 
 namespace obe::engine
 {
+    namespace
+    {
+        // Identifies the version of a file so outdated atlas entries are repacked
+        std::string make_file_stamp(const std::string& path)
+        {
+            std::error_code error;
+            const auto size = std::filesystem::file_size(path, error);
+            const auto write_time = std::filesystem::last_write_time(path, error);
+            if (error)
+            {
+                return "";
+            }
+            return std::to_string(size) + ":"
+                + std::to_string(write_time.time_since_epoch().count());
+        }
+
+        std::string get_atlas_cache_directory(const std::string& cache, bool anti_aliasing)
+        {
+            return (std::filesystem::path(cache) / (anti_aliasing ? "smooth" : "sharp")).string();
+        }
+    }
+
+    graphics::TextureAtlas& ResourceManager::get_atlas(bool anti_aliasing)
+    {
+        std::unique_ptr<graphics::TextureAtlas>& atlas
+            = anti_aliasing ? m_atlases.second : m_atlases.first;
+        if (!atlas)
+        {
+            atlas = std::make_unique<graphics::TextureAtlas>(m_atlas_page_size, anti_aliasing);
+            if (!m_atlas_cache.empty()
+                && atlas->load(get_atlas_cache_directory(m_atlas_cache, anti_aliasing)))
+            {
+                // Files are only checked once, when the cached atlas is loaded
+                const std::size_t outdated = atlas->remove_outdated(
+                    [](const std::string& file_path, const std::string& stamp)
+                    { return make_file_stamp(file_path) == stamp; });
+                debug::Log->debug("[ResourceManager] Loaded cached <TextureAtlas> with {} pages "
+                                  "({} outdated textures removed)",
+                    atlas->get_pages_amount(), outdated);
+            }
+        }
+        return *atlas;
+    }
+
+    bool ResourceManager::is_atlased(const std::string& file_path) const
+    {
+        const std::string normalized_path
+            = std::filesystem::path(file_path).lexically_normal().generic_string();
+        for (const std::string& directory : m_atlas_directories)
+        {
+            if (normalized_path.starts_with(directory))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
     const graphics::Texture& ResourceManager::get_texture(
         const system::Path& path, bool anti_aliasing)
     {
@@ -55,8 +117,150 @@ namespace obe::engine
         return get_texture(path, default_anti_aliasing);
     }
 
+    std::optional<graphics::TexturePart> ResourceManager::get_atlas_texture_part(
+        const system::Path& path, bool anti_aliasing)
+    {
+        if (m_atlas_directories.empty())
+        {
+            return std::nullopt;
+        }
+        const system::FindResult search_result = path.find(system::PathType::File);
+        const std::string texture_path = search_result.success() ? search_result.path() : "";
+        if (texture_path.empty() || utils::string::ends_with(texture_path, ".svg")
+            || !this->is_atlased(texture_path))
+        {
+            return std::nullopt;
+        }
+        graphics::TextureAtlas& atlas = this->get_atlas(anti_aliasing);
+        if (std::optional<graphics::TexturePart> part = atlas.get(texture_path))
+        {
+            return part;
+        }
+        sf::Image image;
+        if (image.loadFromFile(texture_path) && image.getSize().x <= m_atlas_max_texture_size
+            && image.getSize().y <= m_atlas_max_texture_size)
+        {
+            if (std::optional<graphics::TexturePart> part
+                = atlas.add(texture_path, image, make_file_stamp(texture_path)))
+            {
+                debug::Log->debug(
+                    "[ResourceManager] Packed <Texture> {} in atlas", path.to_string());
+                return part;
+            }
+        }
+        return std::nullopt;
+    }
+
+    graphics::TexturePart ResourceManager::get_texture_part(
+        const system::Path& path, bool anti_aliasing)
+    {
+        // The path is only resolved the first time, like get_texture does
+        ResourceStore<std::optional<graphics::TexturePart>>& texture_parts
+            = anti_aliasing ? m_texture_parts.second : m_texture_parts.first;
+        const std::string path_as_string = path.to_string();
+        auto texture_part = texture_parts.find(path_as_string);
+        if (texture_part == texture_parts.end())
+        {
+            texture_part = texture_parts
+                               .emplace(path_as_string,
+                                   this->get_atlas_texture_part(path, anti_aliasing))
+                               .first;
+        }
+        if (texture_part->second)
+        {
+            return *texture_part->second;
+        }
+        return this->get_texture(path, anti_aliasing).make_texture_part();
+    }
+
+    graphics::TexturePart ResourceManager::get_texture_part(const system::Path& path)
+    {
+        return get_texture_part(path, default_anti_aliasing);
+    }
+
+    void ResourceManager::configure_atlas(const vili::node& config)
+    {
+        if (config.contains("pageSize"))
+        {
+            m_atlas_page_size = config.at("pageSize").as<vili::integer>();
+        }
+        if (config.contains("maxTextureSize"))
+        {
+            m_atlas_max_texture_size = config.at("maxTextureSize").as<vili::integer>();
+        }
+        if (config.contains("cache"))
+        {
+            m_atlas_cache = config.at("cache").as<vili::string>();
+        }
+        m_atlas_directories.clear();
+        if (config.contains("paths"))
+        {
+            for (const vili::node& atlas_path : config.at("paths"))
+            {
+                const system::Path directories(atlas_path.as<vili::string>());
+                for (const system::FindResult& directory :
+                    directories.find_all(system::PathType::Directory))
+                {
+                    std::string directory_path = std::filesystem::path(directory.path())
+                                                     .lexically_normal()
+                                                     .generic_string();
+                    if (!directory_path.ends_with("/"))
+                    {
+                        directory_path += "/";
+                    }
+                    debug::Log->debug(
+                        "[ResourceManager] Textures from {} will be packed in atlases",
+                        directory_path);
+                    m_atlas_directories.push_back(std::move(directory_path));
+                }
+            }
+        }
+        m_atlases.first.reset();
+        m_atlases.second.reset();
+        m_texture_parts.first.clear();
+        m_texture_parts.second.clear();
+    }
+
+    void ResourceManager::save_atlas() const
+    {
+        if (m_atlas_cache.empty())
+        {
+            return;
+        }
+        for (const auto& [atlas, anti_aliasing] :
+            { std::make_pair(m_atlases.first.get(), false),
+                std::make_pair(m_atlases.second.get(), true) })
+        {
+            if (atlas
+                && !atlas->save(get_atlas_cache_directory(m_atlas_cache, anti_aliasing)))
+            {
+                debug::Log->warn("[ResourceManager] Could not write <TextureAtlas> cache to {}",
+                    m_atlas_cache);
+            }
+        }
+    }
+
+    std::shared_ptr<const animation::Animator> ResourceManager::get_animator(
+        const system::Path& path, bool anti_aliasing)
+    {
+        const std::string key = path.to_string() + (anti_aliasing ? ":smooth" : ":sharp");
+        if (const auto cached_animator = m_animators.find(key);
+            cached_animator != m_animators.end())
+        {
+            return cached_animator->second;
+        }
+        debug::Log->debug("[ResourceManager] Loading <Animator> {}", path.to_string());
+        auto animator = std::make_shared<animation::Animator>();
+        animator->set_anti_aliasing(anti_aliasing);
+        animator->load(path, this);
+        m_animators[key] = animator;
+        return animator;
+    }
+
     void ResourceManager::clean()
     {
+        std::erase_if(m_animators,
+            [](const auto& animator_pair) { return animator_pair.second.use_count() == 1; });
         for (auto& texture_pair : m_textures)
         {
             if (texture_pair.second.first && texture_pair.second.first->use_count() == 1)
@@ -13,18 +13,6 @@ namespace obe::event
         m_on_remove_listener = std::move(callback);
     }
 
-    void EventBase::collect_garbage()
-    {
-        debug::Log->trace(
-            "EventListeners Garbage Collection for Event {} [External]", m_identifier);
-        for (const std::string& listener_id : m_garbage_collector)
-        {
-            debug::Log->trace("  - Garbage Collecting listener {}", listener_id);
-            m_listeners.erase(listener_id);
-        }
-        m_garbage_collector.clear();
-    }
-
     EventBase::EventBase(
         const std::string& parent_name, const std::string& name, bool initial_state)
         : m_name(name)
@@ -32,7 +20,7 @@ namespace obe::event
     {
         m_identifier = fmt::format("{}.{}", parent_name, m_name);
 
-        debug::Log->trace("<Event> Creating Event '{}' @{}", m_identifier, fmt::ptr(this));
+        OBE_TRACE("<Event> Creating Event '{}' @{}", m_identifier, fmt::ptr(this));
     }
 
     bool EventBase::get_state() const
@@ -50,25 +38,23 @@ namespace obe::event
         return m_identifier;
     }
 
-    void EventBase::add_external_listener(
+    ListenerHandle EventBase::add_external_listener(
         const std::string& id, const ExternalEventListener& listener)
     {
-        debug::Log->trace("<Event> Adding new listener '{}' to Event '{}'", id, m_identifier);
-        m_listeners.emplace(id, listener);
-        if (m_on_add_listener)
+        OBE_TRACE("<Event> Adding new listener '{}' to Event '{}'", id, m_identifier);
+        const bool new_listener = !m_listeners.contains(id);
+        const ListenerHandle handle = m_listeners.add(id, listener);
+        if (new_listener && m_on_add_listener)
         {
             m_on_add_listener(ListenerChangeState::Added, id);
         }
+        return handle;
     }
 
     void EventBase::remove_external_listener(const std::string& id)
     {
-        debug::Log->trace("<Event> Removing listener '{}' from Event '{}'", id, m_identifier);
-        if (m_garbage_lock)
-            m_garbage_collector.push_back(id);
-        else
-            m_listeners.erase(id);
-        if (m_on_remove_listener)
+        OBE_TRACE("<Event> Removing listener '{}' from Event '{}'", id, m_identifier);
+        if (m_listeners.remove(id) && m_on_remove_listener)
         {
             m_on_remove_listener(ListenerChangeState::Removed, id);
         }
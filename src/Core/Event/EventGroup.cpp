@@ -1,8 +1,16 @@
+#include <algorithm>
+
 #include <Debug/Logger.hpp>
 #include <Event/EventGroup.hpp>
 
 namespace obe::event
 {
+    std::size_t EventTypeIndex::next()
+    {
+        static std::size_t index = 0;
+        return index++;
+    }
+
     EventGroupView::EventGroupView(const EventGroup& event_group)
         : m_group(event_group)
     {
@@ -73,8 +81,12 @@ namespace obe::event
     {
         debug::Log->debug(
             "<EventGroup> Remove Event '{}' from EventGroup '{}'", event_name, m_identifier);
-        if (m_events.find(event_name) != m_events.end())
-            m_events.erase(event_name);
+        if (const auto event = m_events.find(event_name); event != m_events.end())
+        {
+            std::replace(m_typed_events.begin(), m_typed_events.end(), event->second.get(),
+                static_cast<EventBase*>(nullptr));
+            m_events.erase(event);
+        }
         else
         {
             throw exceptions::UnknownEvent(
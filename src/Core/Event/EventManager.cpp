@@ -8,16 +8,17 @@ namespace obe::event
         m_chrono.start();
     }
 
-    void EventManager::update()
+    void EventManager::update(time::TimeUnit dt)
     {
-        debug::Log->trace("<EventManager> Updating EventManager");
+        OBE_TRACE("<EventManager> Updating EventManager");
+        OBE_PROFILE_SCOPE("EventManager::update");
         for (const auto& scheduler : m_schedulers)
         {
             if (scheduler->m_state == CallbackSchedulerState::Ready)
             {
-                const time::TimeUnit elapsed = time::epoch() - scheduler->m_start;
-                if ((scheduler->m_wait && elapsed >= scheduler->m_after)
-                    || (scheduler->m_repeat && elapsed >= scheduler->m_every))
+                scheduler->m_elapsed += dt;
+                if ((scheduler->m_wait && scheduler->m_elapsed >= scheduler->m_after)
+                    || (scheduler->m_repeat && scheduler->m_elapsed >= scheduler->m_every))
                 {
                     scheduler->execute();
                 }
@@ -0,0 +1,132 @@
+#include <algorithm>
+
+#include <Graphics/RenderList.hpp>
+
+namespace obe::graphics
+{
+    namespace
+    {
+        // Higher layers (then higher sublayers) are drawn first
+        bool draws_before(const Renderable* renderable1, const Renderable* renderable2)
+        {
+            if (renderable1->get_layer() == renderable2->get_layer())
+            {
+                return renderable1->get_sublayer() > renderable2->get_sublayer();
+            }
+            return renderable1->get_layer() > renderable2->get_layer();
+        }
+    }
+
+    RenderList::~RenderList()
+    {
+        this->clear();
+    }
+
+    void RenderList::mark_as_moved(Renderable* renderable)
+    {
+        renderable->m_moved = true;
+        m_moved_renderables.push_back(renderable);
+    }
+
+    void RenderList::apply_moves()
+    {
+        if (m_moved_renderables.empty())
+        {
+            return;
+        }
+        // Re-inserting one by one is only worth it for a few Renderables
+        if (m_moved_renderables.size() > m_renderables.size() / 8)
+        {
+            for (Renderable* renderable : m_moved_renderables)
+            {
+                renderable->m_moved = false;
+            }
+            this->sort();
+        }
+        else
+        {
+            std::erase_if(
+                m_renderables, [](const Renderable* renderable) { return renderable->m_moved; });
+            for (Renderable* renderable : m_moved_renderables)
+            {
+                renderable->m_moved = false;
+                m_renderables.insert(std::upper_bound(m_renderables.begin(),
+                                         m_renderables.end(), renderable, draws_before),
+                    renderable);
+            }
+        }
+        m_moved_renderables.clear();
+    }
+
+    void RenderList::add(Renderable* renderable)
+    {
+        if (renderable->m_render_list == this)
+        {
+            return;
+        }
+        if (renderable->m_render_list)
+        {
+            renderable->m_render_list->remove(renderable);
+        }
+        this->apply_moves();
+        renderable->m_render_list = this;
+        m_renderables.insert(
+            std::upper_bound(m_renderables.begin(), m_renderables.end(), renderable, draws_before),
+            renderable);
+    }
+
+    void RenderList::remove(Renderable* renderable)
+    {
+        if (renderable->m_render_list != this)
+        {
+            return;
+        }
+        renderable->m_render_list = nullptr;
+        if (renderable->m_moved || !m_moved_renderables.empty())
+        {
+            renderable->m_moved = false;
+            std::erase(m_moved_renderables, renderable);
+            std::erase(m_renderables, renderable);
+            return;
+        }
+        // The list is sorted, only the Renderables with the same layers are checked
+        const auto [first, last] = std::equal_range(
+            m_renderables.begin(), m_renderables.end(), renderable, draws_before);
+        if (const auto position = std::find(first, last, renderable); position != last)
+        {
+            m_renderables.erase(position);
+        }
+        else
+        {
+            // The layers changed without notifying the list, it is searched entirely
+            std::erase(m_renderables, renderable);
+        }
+    }
+
+    void RenderList::clear()
+    {
+        for (Renderable* renderable : m_renderables)
+        {
+            renderable->m_render_list = nullptr;
+            renderable->m_moved = false;
+        }
+        m_renderables.clear();
+        m_moved_renderables.clear();
+    }
+
+    void RenderList::sort()
+    {
+        std::stable_sort(m_renderables.begin(), m_renderables.end(), draws_before);
+    }
+
+    std::size_t RenderList::size() const
+    {
+        return m_renderables.size();
+    }
+
+    const std::vector<Renderable*>& RenderList::get_renderables()
+    {
+        this->apply_moves();
+        return m_renderables;
+    }
+} // namespace obe::graphics
@@ -1,4 +1,6 @@
+#include <Graphics/RenderList.hpp>
 #include <Graphics/Renderable.hpp>
+#include <Graphics/SpriteBatch.hpp>
 
 namespace obe::graphics
 {
@@ -8,6 +10,43 @@ namespace obe::graphics
     {
     }
 
+    Renderable::Renderable(const Renderable& other)
+        : m_layer(other.m_layer)
+        , m_sublayer(other.m_sublayer)
+        , m_visible(other.m_visible)
+    {
+    }
+
+    Renderable& Renderable::operator=(const Renderable& other)
+    {
+        const bool layer_changed
+            = (m_layer != other.m_layer) || (m_sublayer != other.m_sublayer);
+        m_layer = other.m_layer;
+        m_sublayer = other.m_sublayer;
+        m_visible = other.m_visible;
+        if (layer_changed)
+        {
+            this->notify_layer_change();
+        }
+        return *this;
+    }
+
+    Renderable::~Renderable()
+    {
+        if (m_render_list)
+        {
+            m_render_list->remove(this);
+        }
+    }
+
+    void Renderable::notify_layer_change()
+    {
+        if (m_render_list && !m_moved)
+        {
+            m_render_list->mark_as_moved(this);
+        }
+    }
+
     int32_t Renderable::get_layer() const
     {
         return m_layer;
@@ -25,12 +64,20 @@ namespace obe::graphics
 
     void Renderable::set_layer(int32_t layer)
     {
-        m_layer = layer;
+        if (m_layer != layer)
+        {
+            m_layer = layer;
+            this->notify_layer_change();
+        }
     }
 
     void Renderable::set_sublayer(int32_t sublayer)
     {
-        m_sublayer = sublayer;
+        if (m_sublayer != sublayer)
+        {
+            m_sublayer = sublayer;
+            this->notify_layer_change();
+        }
     }
 
     void Renderable::set_visible(bool visible)
@@ -47,4 +94,15 @@ namespace obe::graphics
     {
         m_visible = false;
     }
+
+    bool Renderable::is_in_view(const scene::Camera&) const
+    {
+        return true;
+    }
+
+    void Renderable::draw(SpriteBatch& batch, RenderTarget& surface, const scene::Camera& camera)
+    {
+        batch.flush_for_unbatched_draw(surface);
+        this->draw(surface, camera);
+    }
 }
@@ -0,0 +1,78 @@
+#include <Graphics/ShelfPacker.hpp>
+
+namespace obe::graphics
+{
+    ShelfPacker::ShelfPacker(unsigned int page_size)
+        : m_page_size(page_size)
+    {
+    }
+
+    std::optional<ShelfPacker::Placement> ShelfPacker::allocate(
+        unsigned int width, unsigned int height)
+    {
+        if (width > m_page_size || height > m_page_size)
+        {
+            return std::nullopt;
+        }
+        for (std::size_t page_index = 0; page_index <= m_pages.size(); page_index++)
+        {
+            Page& page = (page_index == m_pages.size()) ? m_pages.emplace_back()
+                                                        : m_pages[page_index];
+            for (Shelf& shelf : page.shelves)
+            {
+                if (height <= shelf.height && height * 4 >= shelf.height * 3
+                    && shelf.width_used + width <= m_page_size)
+                {
+                    const Placement placement { page_index, shelf.width_used, shelf.y };
+                    shelf.width_used += width;
+                    return placement;
+                }
+            }
+            if (page.height_used + height <= m_page_size)
+            {
+                page.shelves.push_back(Shelf { page.height_used, height, width });
+                const Placement placement { page_index, 0, page.height_used };
+                page.height_used += height;
+                return placement;
+            }
+        }
+        return std::nullopt;
+    }
+
+    bool ShelfPacker::add_page(std::vector<Shelf> shelves)
+    {
+        Page page;
+        for (const Shelf& shelf : shelves)
+        {
+            if (shelf.y < page.height_used || shelf.width_used > m_page_size
+                || shelf.height > m_page_size - shelf.y)
+            {
+                return false;
+            }
+            page.height_used = shelf.y + shelf.height;
+        }
+        page.shelves = std::move(shelves);
+        m_pages.push_back(std::move(page));
+        return true;
+    }
+
+    void ShelfPacker::clear()
+    {
+        m_pages.clear();
+    }
+
+    const std::vector<ShelfPacker::Shelf>& ShelfPacker::get_shelves(std::size_t page) const
+    {
+        return m_pages.at(page).shelves;
+    }
+
+    std::size_t ShelfPacker::get_pages_amount() const
+    {
+        return m_pages.size();
+    }
+
+    unsigned int ShelfPacker::get_page_size() const
+    {
+        return m_page_size;
+    }
+} // namespace obe::graphics
@@ -1,3 +1,5 @@
+#include <cmath>
+
 #include <Engine/ResourceManager.hpp>
 #include <Graphics/DrawUtils.hpp>
 #include <Graphics/Exceptions.hpp>
@@ -76,13 +78,54 @@ namespace obe::graphics
 
     void Sprite::use_texture_size()
     {
-        const transform::UnitVector texture_size = this->get_texture().get_size();
-        const transform::UnitVector initial_sprite_size(
-            texture_size.x, texture_size.y, transform::Units::ScenePixels);
+        // The texture rect is smaller than the texture when it comes from an atlas
+        const sf::IntRect texture_rect = m_sprite.getTextureRect();
+        const transform::UnitVector initial_sprite_size(std::abs(texture_rect.width),
+            std::abs(texture_rect.height), transform::Units::ScenePixels);
         this->set_size(initial_sprite_size);
     }
 
-    void Sprite::draw(RenderTarget& surface, const scene::Camera& camera)
+    bool Sprite::is_in_view(const scene::Camera& camera) const
+    {
+        // The handle can stick out of the view even when the Sprite does not
+        if (m_selected)
+        {
+            return true;
+        }
+        const transform::UnitVector pixel_camera
+            = camera.get_position().to<transform::Units::ScenePixels>();
+
+        // Bounding box of the (maybe rotated) Rect
+        transform::UnitVector min_corner = Rect::get_position(transform::Referential::TopLeft);
+        transform::UnitVector max_corner = min_corner;
+        for (const transform::Referential& corner : { transform::Referential::TopRight,
+                 transform::Referential::BottomLeft, transform::Referential::BottomRight })
+        {
+            const transform::UnitVector position = Rect::get_position(corner);
+            min_corner.x = std::min(min_corner.x, position.x);
+            min_corner.y = std::min(min_corner.y, position.y);
+            max_corner.x = std::max(max_corner.x, position.x);
+            max_corner.y = std::max(max_corner.y, position.y);
+        }
+
+        // PositionTransformers only offset coordinates (camera, parallax), they keep
+        // the order of the corners so transforming the bounding box is enough
+        const transform::UnitVector screen_min
+            = m_position_transformer(min_corner, pixel_camera, m_layer)
+                  .to<transform::Units::ScenePixels>();
+        const transform::UnitVector screen_max
+            = m_position_transformer(max_corner, pixel_camera, m_layer)
+                  .to<transform::Units::ScenePixels>();
+        if (!std::isfinite(screen_min.x) || !std::isfinite(screen_min.y)
+            || !std::isfinite(screen_max.x) || !std::isfinite(screen_max.y))
+        {
+            return true;
+        }
+        return screen_max.x >= 0 && screen_min.x <= transform::UnitVector::Screen.w
+            && screen_max.y >= 0 && screen_min.y <= transform::UnitVector::Screen.h;
+    }
+
+    void Sprite::update_vertices(RenderTarget& surface, const scene::Camera& camera)
     {
         const transform::UnitVector pixel_camera
             = camera.get_position().to<transform::Units::ScenePixels>();
@@ -120,6 +163,11 @@ namespace obe::graphics
         }
 
         m_sprite.setVertices(vertices);
+    }
+
+    void Sprite::draw(RenderTarget& surface, const scene::Camera& camera)
+    {
+        this->update_vertices(surface, camera);
 
         if (m_shader)
             surface.draw(m_sprite, m_shader);
@@ -132,6 +180,22 @@ namespace obe::graphics
         }
     }
 
+    void Sprite::draw(SpriteBatch& batch, RenderTarget& surface, const scene::Camera& camera)
+    {
+        this->update_vertices(surface, camera);
+
+        if (const sf::Texture* texture = m_sprite.getTexture())
+        {
+            batch.add(surface, texture, m_shader, m_sprite.getTransformedVertices());
+        }
+
+        if (m_selected)
+        {
+            batch.flush_for_unbatched_draw(surface);
+            this->draw_handle(surface, camera);
+        }
+    }
+
     void Sprite::attach_resource_manager(engine::ResourceManager& resources)
     {
         this->set_anti_aliasing(resources.default_anti_aliasing);
@@ -145,14 +209,8 @@ namespace obe::graphics
 
     void Sprite::flip(bool horizontally, bool vertically)
     {
-        if (horizontally || vertically)
-        {
-            m_texture.set_repeated(true);
-        }
-        else
-        {
-            m_texture.set_repeated(false);
-        }
+        // Flipped texture rects stay inside the texture, the texture does not need to
+        // be repeated (it can be an atlas page shared with other Sprites)
         m_horizontal_flip = horizontally;
         m_vertical_flip = vertically;
         sf::IntRect texture_rect = m_sprite.getTextureRect();
@@ -172,18 +230,24 @@ namespace obe::graphics
             m_path = path;
             if (m_resources)
             {
-                m_texture = m_resources->get_texture(system::Path(path), m_antiAliasing);
+                // The texture can be a page of an atlas, only a part of it is used
+                const TexturePart texture_part
+                    = m_resources->get_texture_part(system::Path(path), m_antiAliasing);
+                const transform::AABB& texture_rect = texture_part.get_texture_rect();
+                m_texture = texture_part.get_texture();
+                m_sprite.setTexture(m_texture);
+                m_sprite.setTextureRect(sf::IntRect(texture_rect.x(), texture_rect.y(),
+                    texture_rect.width(), texture_rect.height()));
             }
             else
             {
                 m_texture.reset();
                 m_texture.load_from_file(system::Path(path).find());
                 m_texture.set_anti_aliasing(m_antiAliasing);
+                m_sprite.setTexture(m_texture);
+                m_sprite.setTextureRect(
+                    sf::IntRect(0, 0, m_texture.get_size().x, m_texture.get_size().y));
             }
-
-            m_sprite.setTexture(m_texture);
-            m_sprite.setTextureRect(
-                sf::IntRect(0, 0, m_texture.get_size().x, m_texture.get_size().y));
         }
     }
 
@@ -0,0 +1,66 @@
+#include <Graphics/SpriteBatch.hpp>
+
+namespace obe::graphics
+{
+    void SpriteBatch::add(RenderTarget& surface, const sf::Texture* texture,
+        const sf::Shader* shader, const std::array<sf::Vertex, 4>& quad)
+    {
+        if (!m_vertices.empty() && (texture != m_texture || shader != m_shader))
+        {
+            this->flush(surface);
+        }
+        m_texture = texture;
+        m_shader = shader;
+        // Triangle strip (0, 1, 2, 3) to two independent triangles
+        m_vertices.push_back(quad[0]);
+        m_vertices.push_back(quad[1]);
+        m_vertices.push_back(quad[2]);
+        m_vertices.push_back(quad[2]);
+        m_vertices.push_back(quad[1]);
+        m_vertices.push_back(quad[3]);
+        m_quads++;
+    }
+
+    void SpriteBatch::flush(RenderTarget& surface)
+    {
+        if (m_vertices.empty())
+        {
+            return;
+        }
+        sf::RenderStates states;
+        states.texture = m_texture;
+        states.shader = m_shader;
+        surface.draw(m_vertices.data(), m_vertices.size(), sf::Triangles, states);
+        // Keeps the capacity so the next frames do not allocate
+        m_vertices.clear();
+        m_batches++;
+    }
+
+    void SpriteBatch::flush_for_unbatched_draw(RenderTarget& surface)
+    {
+        this->flush(surface);
+        m_unbatched_draws++;
+    }
+
+    void SpriteBatch::reset_statistics()
+    {
+        m_batches = 0;
+        m_quads = 0;
+        m_unbatched_draws = 0;
+    }
+
+    std::size_t SpriteBatch::get_batches_amount() const
+    {
+        return m_batches;
+    }
+
+    std::size_t SpriteBatch::get_quads_amount() const
+    {
+        return m_quads;
+    }
+
+    std::size_t SpriteBatch::get_unbatched_draws_amount() const
+    {
+        return m_unbatched_draws;
+    }
+} // namespace obe::graphics
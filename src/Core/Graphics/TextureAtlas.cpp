@@ -0,0 +1,336 @@
+#include <algorithm>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <tuple>
+
+#include <vili/parser.hpp>
+
+#include <Graphics/TextureAtlas.hpp>
+
+namespace obe::graphics
+{
+    namespace
+    {
+        constexpr std::string_view AtlasIndexFile = "atlas.vili";
+        // Every image is surrounded by a copy of its border on each side
+        constexpr unsigned int Padding = 1;
+
+        std::string get_page_path(const std::filesystem::path& directory, std::size_t page)
+        {
+            return (directory / ("page_" + std::to_string(page) + ".png")).string();
+        }
+
+        sf::Image make_padded_image(const sf::Image& image)
+        {
+            const sf::Vector2u size = image.getSize();
+            sf::Image padded;
+            padded.create(size.x + Padding * 2, size.y + Padding * 2);
+            padded.copy(image, Padding, Padding);
+            for (unsigned int x = 0; x < size.x + Padding * 2; x++)
+            {
+                const unsigned int source_x
+                    = std::clamp(x, Padding, size.x + Padding - 1) - Padding;
+                padded.setPixel(x, 0, image.getPixel(source_x, 0));
+                padded.setPixel(x, size.y + Padding, image.getPixel(source_x, size.y - 1));
+            }
+            for (unsigned int y = 0; y < size.y; y++)
+            {
+                padded.setPixel(0, y + Padding, image.getPixel(0, y));
+                padded.setPixel(size.x + Padding, y + Padding, image.getPixel(size.x - 1, y));
+            }
+            return padded;
+        }
+
+        // Fields of the index are checked as it may come from another version
+        std::optional<unsigned int> read_unsigned(const vili::node& node, const std::string& key)
+        {
+            if (!node.is_object() || !node.contains(key) || !node.at(key).is_integer())
+            {
+                return std::nullopt;
+            }
+            const vili::integer value = node.at(key).as<vili::integer>();
+            if (value < 0 || value > std::numeric_limits<unsigned int>::max())
+            {
+                return std::nullopt;
+            }
+            return static_cast<unsigned int>(value);
+        }
+
+        bool has_array(const vili::node& node, const std::string& key)
+        {
+            return node.is_object() && node.contains(key) && node.at(key).is_array();
+        }
+
+        bool has_string(const vili::node& node, const std::string& key)
+        {
+            return node.is_object() && node.contains(key) && node.at(key).is_string();
+        }
+    }
+
+    TextureAtlas::TextureAtlas(unsigned int page_size, bool anti_aliasing)
+        : m_anti_aliasing(anti_aliasing)
+        , m_packer(page_size)
+    {
+    }
+
+    Texture& TextureAtlas::make_page()
+    {
+        Texture& page
+            = *m_pages.emplace_back(std::make_unique<Texture>(Texture::make_shared_texture()));
+        page.create(m_packer.get_page_size(), m_packer.get_page_size());
+        page.set_anti_aliasing(m_anti_aliasing);
+        return page;
+    }
+
+    bool TextureAtlas::allocate(unsigned int width, unsigned int height, Entry& entry)
+    {
+        const std::optional<ShelfPacker::Placement> placement = m_packer.allocate(width, height);
+        if (!placement)
+        {
+            return false;
+        }
+        while (m_pages.size() <= placement->page)
+        {
+            this->make_page();
+        }
+        entry.page = placement->page;
+        entry.x = placement->x;
+        entry.y = placement->y;
+        return true;
+    }
+
+    TexturePart TextureAtlas::make_texture_part(const Entry& entry) const
+    {
+        return TexturePart(*m_pages[entry.page],
+            transform::AABB(transform::UnitVector(entry.x + Padding, entry.y + Padding),
+                transform::UnitVector(entry.width, entry.height)));
+    }
+
+    void TextureAtlas::compact()
+    {
+        std::vector<sf::Image> page_images;
+        page_images.reserve(m_pages.size());
+        for (const std::unique_ptr<Texture>& page : m_pages)
+        {
+            const sf::Texture& page_texture = *page;
+            page_images.push_back(page_texture.copyToImage());
+        }
+        std::vector<std::pair<std::string, Entry>> entries(m_entries.begin(), m_entries.end());
+        // Taller images first so the shelves are filled with images of similar heights
+        std::sort(entries.begin(), entries.end(),
+            [](const auto& first, const auto& second)
+            {
+                return std::tie(second.second.height, first.first)
+                    < std::tie(first.second.height, second.first);
+            });
+        m_pages.clear();
+        m_packer.clear();
+        m_entries.clear();
+        for (const auto& [key, entry] : entries)
+        {
+            sf::Image image;
+            image.create(entry.width, entry.height);
+            image.copy(page_images[entry.page], 0, 0,
+                sf::IntRect(entry.x + Padding, entry.y + Padding, entry.width, entry.height));
+            this->add(key, image, entry.stamp);
+        }
+    }
+
+    std::optional<TexturePart> TextureAtlas::get(const std::string& key) const
+    {
+        const auto entry = m_entries.find(key);
+        if (entry == m_entries.end())
+        {
+            return std::nullopt;
+        }
+        return this->make_texture_part(entry->second);
+    }
+
+    std::optional<TexturePart> TextureAtlas::add(
+        const std::string& key, const sf::Image& image, const std::string& stamp)
+    {
+        const sf::Vector2u size = image.getSize();
+        if (size.x == 0 || size.y == 0)
+        {
+            return std::nullopt;
+        }
+        // A replaced image keeps its old space until remove_outdated packs the atlas again
+        Entry entry;
+        if (!this->allocate(size.x + Padding * 2, size.y + Padding * 2, entry))
+        {
+            return std::nullopt;
+        }
+        entry.width = size.x;
+        entry.height = size.y;
+        entry.stamp = stamp;
+
+        sf::Texture& page_texture = *m_pages[entry.page];
+        page_texture.update(make_padded_image(image), entry.x, entry.y);
+        m_entries[key] = entry;
+        return this->make_texture_part(entry);
+    }
+
+    std::size_t TextureAtlas::remove_outdated(
+        const std::function<bool(const std::string&, const std::string&)>& is_up_to_date)
+    {
+        const std::size_t removed = std::erase_if(m_entries,
+            [&is_up_to_date](const auto& entry)
+            { return !is_up_to_date(entry.first, entry.second.stamp); });
+
+        // Images replaced by add left some space in their shelf
+        std::vector<std::unordered_map<unsigned int, unsigned int>> used_widths(m_pages.size());
+        for (const auto& [key, entry] : m_entries)
+        {
+            used_widths[entry.page][entry.y] += entry.width + Padding * 2;
+        }
+        bool unused_space = false;
+        for (std::size_t page_index = 0; page_index < m_pages.size(); page_index++)
+        {
+            for (const ShelfPacker::Shelf& shelf : m_packer.get_shelves(page_index))
+            {
+                unused_space |= (used_widths[page_index][shelf.y] != shelf.width_used);
+            }
+        }
+        if (removed || unused_space)
+        {
+            this->compact();
+        }
+        return removed;
+    }
+
+    std::size_t TextureAtlas::get_pages_amount() const
+    {
+        return m_pages.size();
+    }
+
+    unsigned int TextureAtlas::get_page_size() const
+    {
+        return m_packer.get_page_size();
+    }
+
+    bool TextureAtlas::save(const std::string& directory) const
+    {
+        std::error_code error;
+        std::filesystem::create_directories(directory, error);
+        if (error)
+        {
+            return false;
+        }
+
+        vili::node pages = vili::array {};
+        for (std::size_t page_index = 0; page_index < m_pages.size(); page_index++)
+        {
+            const sf::Texture& page_texture = *m_pages[page_index];
+            if (!page_texture.copyToImage().saveToFile(get_page_path(directory, page_index)))
+            {
+                return false;
+            }
+            vili::node shelves = vili::array {};
+            for (const ShelfPacker::Shelf& shelf : m_packer.get_shelves(page_index))
+            {
+                shelves.push(vili::object { { "y", vili::integer(shelf.y) },
+                    { "height", vili::integer(shelf.height) },
+                    { "width_used", vili::integer(shelf.width_used) } });
+            }
+            pages.push(vili::object { { "shelves", shelves } });
+        }
+        // Pages left by a bigger atlas
+        std::size_t extra_page = m_pages.size();
+        while (std::filesystem::remove(get_page_path(directory, extra_page), error))
+        {
+            extra_page++;
+        }
+        vili::node entries = vili::array {};
+        for (const auto& [key, entry] : m_entries)
+        {
+            entries.push(vili::object { { "key", key }, { "page", vili::integer(entry.page) },
+                { "x", vili::integer(entry.x) }, { "y", vili::integer(entry.y) },
+                { "width", vili::integer(entry.width) }, { "height", vili::integer(entry.height) },
+                { "stamp", entry.stamp } });
+        }
+        const vili::node index
+            = vili::object { { "page_size", vili::integer(m_packer.get_page_size()) },
+            { "pages", pages }, { "entries", entries } };
+
+        std::ofstream index_file(std::filesystem::path(directory) / AtlasIndexFile);
+        index_file << index.dump(true);
+        return static_cast<bool>(index_file);
+    }
+
+    bool TextureAtlas::load(const std::string& directory)
+    {
+        const std::filesystem::path index_path = std::filesystem::path(directory) / AtlasIndexFile;
+        if (!std::filesystem::exists(index_path))
+        {
+            return false;
+        }
+        vili::node index;
+        try
+        {
+            index = vili::parser::from_file(index_path.string());
+        }
+        catch (const vili::exceptions::base_exception&)
+        {
+            return false;
+        }
+        if (read_unsigned(index, "page_size") != m_packer.get_page_size()
+            || !has_array(index, "pages") || !has_array(index, "entries"))
+        {
+            return false;
+        }
+
+        ShelfPacker packer(m_packer.get_page_size());
+        std::vector<std::unique_ptr<Texture>> pages;
+        for (const vili::node& page_data : index.at("pages"))
+        {
+            if (!has_array(page_data, "shelves"))
+            {
+                return false;
+            }
+            std::vector<ShelfPacker::Shelf> shelves;
+            for (const vili::node& shelf : page_data.at("shelves"))
+            {
+                const std::optional<unsigned int> y = read_unsigned(shelf, "y");
+                const std::optional<unsigned int> height = read_unsigned(shelf, "height");
+                const std::optional<unsigned int> width_used = read_unsigned(shelf, "width_used");
+                if (!y || !height || !width_used)
+                {
+                    return false;
+                }
+                shelves.push_back(ShelfPacker::Shelf { *y, *height, *width_used });
+            }
+            if (!packer.add_page(std::move(shelves)))
+            {
+                return false;
+            }
+            Texture& page
+                = *pages.emplace_back(std::make_unique<Texture>(Texture::make_shared_texture()));
+            if (!page.load_from_file(get_page_path(directory, pages.size() - 1)))
+            {
+                return false;
+            }
+            page.set_anti_aliasing(m_anti_aliasing);
+        }
+        std::unordered_map<std::string, Entry> entries;
+        for (const vili::node& entry : index.at("entries"))
+        {
+            const std::optional<unsigned int> page = read_unsigned(entry, "page");
+            const std::optional<unsigned int> x = read_unsigned(entry, "x");
+            const std::optional<unsigned int> y = read_unsigned(entry, "y");
+            const std::optional<unsigned int> width = read_unsigned(entry, "width");
+            const std::optional<unsigned int> height = read_unsigned(entry, "height");
+            if (!page || !x || !y || !width || !height || *page >= pages.size()
+                || !has_string(entry, "key") || !has_string(entry, "stamp"))
+            {
+                return false;
+            }
+            entries[entry.at("key").as<vili::string>()]
+                = Entry { *page, *x, *y, *width, *height, entry.at("stamp").as<vili::string>() };
+        }
+        m_packer = std::move(packer);
+        m_pages = std::move(pages);
+        m_entries = std::move(entries);
+        return true;
+    }
+} // namespace obe::graphics
@@ -26,7 +26,7 @@ namespace obe::input
 
     void InputButtonMonitor::update(event::EventGroupPtr events)
     {
-        debug::Log->trace("Updating InputMonitor of {}", m_input_source.get_name());
+        OBE_TRACE("Updating InputMonitor of {}", m_input_source.get_name());
         const bool key_pressed = m_input_source.is_pressed();
         const InputSourceState old_state = m_button_state;
         m_should_refresh = false;
@@ -96,7 +96,7 @@ namespace obe::network
             if (status == sf::Socket::Done)
             {
                 vili::node message;
-                debug::Log->trace("Received NetworkEvent content (base64) '{}'", utils::base64::encode(content));
+                OBE_TRACE("Received NetworkEvent content (base64) '{}'", utils::base64::encode(content));
                 try
                 {
                     message = vili::msgpack::from_string(content);
@@ -1,36 +1,43 @@
-#include <vili/parser.hpp>
-
+#include <Config/CompiledVili.hpp>
+#include <Debug/Profiler.hpp>
 #include <Debug/Render.hpp>
 #include <Scene/Exceptions.hpp>
 #include <Scene/Scene.hpp>
+#include <Script/BytecodeCache.hpp>
 #include <Utils/MathUtils.hpp>
 
 namespace obe::scene
 {
+    namespace
+    {
+        // Scenes sharing an EventNamespace get their own EventGroups, the
+        // first Scene keeps the names used by the scripts
+        std::string make_group_name(
+            const event::EventNamespace& event_namespace, const std::string& name)
+        {
+            std::string group_name = name;
+            for (int index = 2; event_namespace.does_group_exists(group_name); index++)
+            {
+                group_name = name + std::to_string(index);
+            }
+            return group_name;
+        }
+    }
+
     void Scene::_reorganize_layers()
     {
-        m_render_cache.clear();
+        m_render_list.clear();
         for (const auto& sprite : m_sprite_array)
         {
-            m_render_cache.push_back(sprite.get());
+            m_render_list.add(sprite.get());
         }
         if (m_tiles)
         {
-            std::vector<graphics::Renderable*> tile_layers = m_tiles->get_renderables();
-            m_render_cache.insert(m_render_cache.end(), tile_layers.begin(), tile_layers.end());
+            for (graphics::Renderable* tile_layer : m_tiles->get_renderables())
+            {
+                m_render_list.add(tile_layer);
+            }
         }
-
-        std::sort(m_render_cache.begin(), m_render_cache.end(),
-            [](const auto& renderable1, const auto& renderable2) {
-                if (renderable1->get_layer() == renderable2->get_layer())
-                {
-                    return renderable1->get_sublayer() > renderable2->get_sublayer();
-                }
-                else
-                {
-                    return renderable1->get_layer() > renderable2->get_layer();
-                }
-            });
         m_sort_renderables = false;
     }
 
@@ -54,8 +61,10 @@ namespace obe::scene
     }
 
     Scene::Scene(event::EventNamespace& event_namespace, sol::state_view lua)
-        : m_lua(lua)
-        , e_scene(event_namespace.create_group("Scene"))
+        : m_collision_space(
+            event_namespace.create_group(make_group_name(event_namespace, "Collision")))
+        , m_lua(lua)
+        , e_scene(event_namespace.create_group(make_group_name(event_namespace, "Scene")))
 
     {
         e_scene->add<events::Scene::Loaded>();
@@ -89,7 +98,7 @@ namespace obe::scene
             if (add_to_scene_root)
                 m_scene_root.add_child(*return_sprite);
 
-            this->reorganize_layers();
+            m_render_list.add(return_sprite);
             return *return_sprite;
         }
         else
@@ -167,7 +176,7 @@ namespace obe::scene
         vili::node scene_file;
         try
         {
-            scene_file = vili::parser::from_file(filepath);
+            scene_file = config::load_vili_file(filepath);
         }
         catch (const std::exception& e)
         {
@@ -420,13 +429,21 @@ namespace obe::scene
             if (script.contains("source"))
             {
                 std::string source = system::Path(script.at("source")).find();
-                const sol::protected_function_result result
-                    = m_lua.safe_script_file(source, &sol::script_pass_on_error);
+                sol::load_result chunk = script::ScriptCache.load_file(m_lua, source);
+                std::string err_msg;
+                if (!chunk.valid())
+                {
+                    err_msg = chunk.get<sol::error>().what();
+                }
+                else if (const sol::protected_function_result result
+                         = chunk.get<sol::protected_function>()();
+                         !result.valid())
+                {
+                    err_msg = result.get<sol::error>().what();
+                }
                 // TODO: wrap into helper
-                if (!result.valid())
+                if (!err_msg.empty())
                 {
-                    const auto err_obj = result.get<sol::error>();
-                    const std::string err_msg = err_obj.what();
                     throw exceptions::SceneScriptLoadingError(m_level_file_name, source,
                         utils::string::replace(err_msg, "\n", "\n        "), EXC_INFO);
                 }
@@ -436,7 +453,7 @@ namespace obe::scene
             {
                 for (const vili::node& script_name : script.at("sources"))
                 {
-                    m_lua.safe_script_file(system::Path(script_name).find());
+                    script::run_script_file(m_lua, system::Path(script_name).find());
                     m_script_array.push_back(script_name);
                 }
             }
@@ -452,8 +469,9 @@ namespace obe::scene
         m_deferred_scene_load_node = data;
     }
 
-    void Scene::update()
+    void Scene::update(time::TimeUnit dt)
     {
+        OBE_PROFILE_SCOPE("Scene::update");
         if (!m_deferred_scene_load.empty())
         {
             const sol::protected_function on_load_callback = std::move(m_on_load_callback);
@@ -488,14 +506,17 @@ namespace obe::scene
             {
                 script::GameObject& game_object = *m_game_object_array[i];
                 if (!game_object.deletable)
-                    game_object.update();
+                {
+                    OBE_PROFILE_SCOPE("GameObject::update", game_object.get_id());
+                    game_object.update(dt);
+                }
             }
             std::erase_if(
                 m_game_object_array, [this](const std::unique_ptr<script::GameObject>& ptr) {
                     if (ptr->deletable)
                     {
                         m_game_object_ids.erase(ptr->get_id());
-                        debug::Log->debug("<Scene> Removing GameObject {}", ptr->get_id());
+                        OBE_DEBUG("<Scene> Removing GameObject {}", ptr->get_id());
                         if (ptr->m_sprite)
                             this->remove_sprite(ptr->get_sprite().get_id());
                         if (ptr->m_collider)
@@ -504,24 +525,50 @@ namespace obe::scene
                     }
                     return false;
                 });
+            if (m_collision_space.has_collision_listeners())
+                m_collision_space.step();
             if (m_tiles)
-                m_tiles->update();
+                m_tiles->update(dt);
         }
     }
 
     void Scene::draw(graphics::RenderTarget surface)
     {
-        this->_reorganize_layers();
+        OBE_PROFILE_SCOPE("Scene::draw");
+        // The render list keeps itself sorted, it is only rebuilt on request
+        if (m_sort_renderables)
+            this->_reorganize_layers();
         surface.clear(m_background);
+        m_render_statistics = SceneRenderStatistics {};
         if (m_render_options.sprites)
         {
-            for (const auto& renderable : m_render_cache)
+            m_sprite_batch.reset_statistics();
+            for (graphics::Renderable* renderable : m_render_list.get_renderables())
             {
-                if (renderable->is_visible())
+                if (!renderable->is_visible())
+                    continue;
+                if (m_render_options.culling && !renderable->is_in_view(m_camera))
+                {
+                    m_render_statistics.culled++;
+                    continue;
+                }
+                m_render_statistics.drawn++;
+                if (m_render_options.batching)
+                {
+                    renderable->draw(m_sprite_batch, surface, m_camera);
+                }
+                else
                 {
                     renderable->draw(surface, m_camera);
                 }
             }
+            m_sprite_batch.flush(surface);
+
+            m_render_statistics.batches = m_sprite_batch.get_batches_amount();
+            // Without batching, every Renderable drew itself
+            m_render_statistics.draw_calls = m_render_options.batching
+                ? m_render_statistics.batches + m_sprite_batch.get_unbatched_draws_amount()
+                : m_render_statistics.drawn;
         }
 
         // m_tiles->draw(surface, m_camera);
@@ -804,6 +851,11 @@ namespace obe::scene
         m_render_options = options;
     }
 
+    SceneRenderStatistics Scene::get_render_statistics() const
+    {
+        return m_render_statistics;
+    }
+
     component::ComponentBase* Scene::get_component(const std::string& id) const
     {
         return m_components.at(id);
@@ -0,0 +1,200 @@
+#include <cstdint>
+#include <filesystem>
+
+#include <fmt/format.h>
+
+#include <Debug/Logger.hpp>
+#include <Script/BytecodeCache.hpp>
+#include <Script/Exceptions.hpp>
+#include <Utils/FileUtils.hpp>
+
+namespace obe::script
+{
+    namespace
+    {
+        constexpr std::string_view Utf8Bom = "\xEF\xBB\xBF";
+
+        // Identifies the version of a file without reading it
+        std::string make_file_stamp(const std::string& path)
+        {
+            std::error_code error;
+            const auto size = std::filesystem::file_size(path, error);
+            if (error)
+            {
+                return "";
+            }
+            const auto write_time = std::filesystem::last_write_time(path, error);
+            if (error)
+            {
+                return "";
+            }
+            return std::to_string(size) + ":"
+                + std::to_string(write_time.time_since_epoch().count());
+        }
+
+        // Cached files are named "<hash of the path>-<hash of the source>.luac"
+        std::string make_cache_file_prefix(const std::string& path)
+        {
+            return fmt::format("{:016x}-", utils::file::hash_content(path));
+        }
+
+        // Removes the bytecode of the previous versions of a script
+        void remove_outdated_cache_files(const std::string& cache_file)
+        {
+            const std::filesystem::path cache_path(cache_file);
+            const std::string file_name = cache_path.filename().string();
+            const std::string prefix = file_name.substr(0, file_name.find('-') + 1);
+            std::error_code error;
+            for (const auto& entry :
+                std::filesystem::directory_iterator(cache_path.parent_path(), error))
+            {
+                const std::string entry_name = entry.path().filename().string();
+                if (entry_name != file_name && entry_name.starts_with(prefix)
+                    && entry_name.ends_with(".luac"))
+                {
+                    std::filesystem::remove(entry.path(), error);
+                }
+            }
+        }
+
+        void run_loaded_script(const std::string& path, sol::load_result& script,
+            const sol::environment* environment)
+        {
+            if (!script.valid())
+            {
+                throw exceptions::InvalidScript(path, script.get<sol::error>().what(), EXC_INFO);
+            }
+            sol::protected_function function = script.get<sol::protected_function>();
+            if (environment)
+            {
+                environment->set_on(function);
+            }
+            if (const sol::protected_function_result result = function(); !result.valid())
+            {
+                throw exceptions::InvalidScript(path, result.get<sol::error>().what(), EXC_INFO);
+            }
+        }
+    }
+
+    BytecodeCache ScriptCache;
+
+    std::string BytecodeCache::get_cache_file_path(
+        const std::string& path, const std::string& source) const
+    {
+        if (m_directory.empty())
+        {
+            return "";
+        }
+        // The bytecode holds the name of its script, which must be part of the key
+        return (std::filesystem::path(m_directory)
+            / fmt::format("{}{:016x}.luac", make_cache_file_prefix(path),
+                utils::file::hash_content(source)))
+                   .string();
+    }
+
+    void BytecodeCache::set_directory(const std::string& directory)
+    {
+        m_directory = directory;
+    }
+
+    std::string BytecodeCache::get_directory() const
+    {
+        return m_directory;
+    }
+
+    sol::load_result BytecodeCache::load_file(sol::state_view lua, const std::string& file_path)
+    {
+        const std::string path = utils::file::normalize_path(
+            std::filesystem::path(file_path).lexically_normal().string());
+        // Same chunk name as luaL_loadfile so error messages do not change
+        const std::string chunk_name = "@" + path;
+        const std::string stamp = make_file_stamp(path);
+        if (const auto entry = m_entries.find(path);
+            entry != m_entries.end() && !stamp.empty() && entry->second.stamp == stamp)
+        {
+            return lua.load(entry->second.bytecode, chunk_name, sol::load_mode::binary);
+        }
+
+        std::string source;
+        if (!utils::file::read_file(path, source))
+        {
+            return lua.load_file(path);
+        }
+        const std::string cache_file = this->get_cache_file_path(path, source);
+        std::string bytecode;
+        if (!cache_file.empty() && utils::file::read_file(cache_file, bytecode))
+        {
+            sol::load_result cached = lua.load(bytecode, chunk_name, sol::load_mode::binary);
+            if (cached.valid())
+            {
+                m_entries[path] = Entry { stamp, std::move(bytecode) };
+                return cached;
+            }
+            // Bytecode written by another version of Lua, compiled again below
+            OBE_DEBUG("<BytecodeCache> Ignoring invalid bytecode {} for script {}", cache_file,
+                path);
+        }
+
+        // luaL_loadfile skips the BOM and the first line of a script when it
+        // starts with '#', the line is commented to keep the line numbers
+        if (source.starts_with(Utf8Bom))
+        {
+            source.erase(0, Utf8Bom.size());
+        }
+        if (source.starts_with("#"))
+        {
+            source.insert(0, "--");
+        }
+        sol::load_result compiled = lua.load(source, chunk_name, sol::load_mode::text);
+        if (!compiled.valid())
+        {
+            return compiled;
+        }
+        bytecode = compiled.get<sol::protected_function>().dump().as_string_view();
+        if (!cache_file.empty())
+        {
+            if (utils::file::write_file(cache_file, bytecode))
+            {
+                remove_outdated_cache_files(cache_file);
+            }
+            else
+            {
+                debug::Log->warn("<BytecodeCache> Could not write bytecode of script {} to {}",
+                    path, cache_file);
+            }
+        }
+        m_entries[path] = Entry { stamp, std::move(bytecode) };
+        return compiled;
+    }
+
+    bool BytecodeCache::precompile(sol::state_view lua, const std::string& path)
+    {
+        if (m_directory.empty())
+        {
+            return false;
+        }
+        // Goes through the cache directory instead of the bytecode kept in memory
+        m_entries.erase(utils::file::normalize_path(
+            std::filesystem::path(path).lexically_normal().string()));
+        const sol::load_result script = this->load_file(lua, path);
+        return script.valid();
+    }
+
+    void BytecodeCache::clear()
+    {
+        m_entries.clear();
+    }
+
+    void run_script_file(sol::state_view lua, const std::string& path)
+    {
+        sol::load_result script = ScriptCache.load_file(lua, path);
+        run_loaded_script(path, script, nullptr);
+    }
+
+    void run_script_file(
+        sol::state_view lua, const std::string& path, const sol::environment& environment)
+    {
+        sol::load_result script = ScriptCache.load_file(lua, path);
+        run_loaded_script(path, script, &environment);
+    }
+} // namespace obe::script
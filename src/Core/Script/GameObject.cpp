@@ -1,16 +1,14 @@
 #include <utility>
 
-#include <vili/parser.hpp>
-
+#include <Config/CompiledVili.hpp>
 #include <Scene/Scene.hpp>
+#include <Script/BytecodeCache.hpp>
 #include <Script/GameObject.hpp>
 #include <Script/ViliLuaBridge.hpp>
 #include <System/Project.hpp>
 
 namespace obe::script
 {
-    static std::unordered_map<std::string, sol::bytecode> ScriptCache;
-
     sol::table GameObject::access() const
     {
         if (m_has_script_engine)
@@ -35,7 +33,7 @@ namespace obe::script
     {
         if (!AllRequires.contains(type))
         {
-            vili::node get_game_object_file = vili::parser::from_file(
+            vili::node get_game_object_file = config::load_vili_file(
                 system::Path("Data/GameObjects/").add(type).add(type + ".obj.vili").find());
             if (get_game_object_file.contains("Requires"))
             {
@@ -59,7 +57,7 @@ namespace obe::script
             if (object_definition_path.empty())
                 throw exceptions::ObjectDefinitionNotFound(type, EXC_INFO);
 
-            vili::node definition_data = vili::parser::from_file(object_definition_path);
+            vili::node definition_data = config::load_vili_file(object_definition_path);
 
             AllDefinitions[type] = definition_data;
             return definition_data;
@@ -180,11 +178,9 @@ namespace obe::script
             m_object_node.add_child(*m_sprite);
             m_sprite->load(obj.at("Sprite"));
             m_sprite->set_parent_id(m_id);
-            scene.reorganize_layers();
         }
         if (obj.contains("Animator"))
         {
-            m_animator = std::make_unique<animation::Animator>();
             vili::node& animator = obj.at("Animator");
             std::string animator_path;
             if (animator.contains("path"))
@@ -198,15 +194,15 @@ namespace obe::script
                 scale_mode
                     = animation::AnimatorTargetScaleModeMeta::from_string(animator.at("scaling"));
             }
+            m_animator_state = std::make_unique<animation::AnimatorState>();
             if (m_sprite)
-                m_animator->set_target(*m_sprite, scale_mode);
+                m_animator_state->set_target(*m_sprite, scale_mode);
+            // The Animator uses the anti-aliasing of the target
             if (!animator_path.empty())
-            {
-                m_animator->load(m_filesystem_context(animator_path), resources);
-            }
+                m_animator_state->load(m_filesystem_context(animator_path), resources);
             if (animator.contains("default"))
             {
-                m_animator->set_animation(animator.at("default"));
+                m_animator_state->set_animation(animator.at("default"));
             }
         }
         // Collider
@@ -220,20 +216,16 @@ namespace obe::script
         }
     }
 
-    void GameObject::update()
+    void GameObject::update(time::TimeUnit dt)
     {
         if (m_can_update)
         {
             if (m_active)
             {
-                if (m_animator)
+                if (m_animator_state)
                 {
-                    if (!m_animator->get_current_animation_name().empty())
-                        m_animator->update();
-                    /*if (m_sprite)
-                    {
-                        m_sprite->set_texture(m_animator->get_current_texture());
-                    }*/
+                    if (!m_animator_state->get_current_animation_name().empty())
+                        m_animator_state->update(dt);
                 }
             }
             else
@@ -250,7 +242,7 @@ namespace obe::script
 
     bool GameObject::does_have_animator() const
     {
-        return static_cast<bool>(m_animator);
+        return static_cast<bool>(m_animator_state);
     }
 
     bool GameObject::does_have_collider() const
@@ -297,10 +289,10 @@ namespace obe::script
         throw exceptions::NoSuchComponent("Collider", m_type, m_id, EXC_INFO);
     }
 
-    animation::Animator& GameObject::get_animator() const
+    animation::AnimatorState& GameObject::get_animator() const
     {
-        if (m_animator)
-            return *m_animator;
+        if (m_animator_state)
+            return *m_animator_state;
         throw exceptions::NoSuchComponent("Animator", m_type, m_id, EXC_INFO);
     }
 
@@ -408,25 +400,7 @@ namespace obe::script
         {
             throw exceptions::ScriptFileNotFound(m_type, m_id, path, EXC_INFO);
         }
-        if (!ScriptCache.contains(full_path))
-        {
-            const sol::load_result target = m_lua.load_file(full_path);
-            if (!target.valid())
-            {
-                throw exceptions::InvalidScript(
-                    full_path, target.get<sol::error>().what(), EXC_INFO);
-            }
-            const sol::protected_function bytecode = target.get<sol::protected_function>();
-            ScriptCache.emplace(full_path, bytecode.dump());
-        }
-        const std::string_view source = ScriptCache.at(full_path).as_string_view();
-        if (const sol::protected_function_result load_result
-            = m_lua.safe_script(source, environment);
-            !load_result.valid())
-        {
-            throw exceptions::InvalidScript(
-                full_path, load_result.get<sol::error>().what(), EXC_INFO);
-        }
+        run_script_file(m_lua, full_path, environment);
     }
 
     bool GameObject::is_parent_of_component(const std::string& component_id) const
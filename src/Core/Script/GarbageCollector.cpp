@@ -0,0 +1,216 @@
+#include <algorithm>
+
+#include <Debug/Logger.hpp>
+#include <Debug/Profiler.hpp>
+#include <Script/GarbageCollector.hpp>
+
+namespace obe::script
+{
+    GarbageCollector::GarbageCollector(sol::state_view lua)
+        : m_lua(lua.lua_state())
+    {
+    }
+
+    void GarbageCollector::configure(const vili::node& config)
+    {
+        if (config.contains("budget"))
+        {
+            const vili::node& budget = config.at("budget");
+            const double budget_ms = budget.is_number()
+                ? budget.as<vili::number>()
+                : static_cast<double>(budget.as<vili::integer>());
+            this->set_budget(budget_ms * time::milliseconds);
+        }
+        if (config.contains("stepSize"))
+        {
+            this->set_step_size(static_cast<int>(config.at("stepSize").as<vili::integer>()));
+        }
+        if (config.contains("pause"))
+        {
+            this->set_pause(static_cast<int>(config.at("pause").as<vili::integer>()));
+        }
+        if (config.contains("limit"))
+        {
+            this->set_limit(static_cast<int>(config.at("limit").as<vili::integer>()));
+        }
+        if (config.contains("enabled"))
+        {
+            this->set_enabled(config.at("enabled").as_boolean());
+        }
+    }
+
+    void GarbageCollector::set_enabled(bool enabled)
+    {
+        if (enabled == m_enabled)
+        {
+            return;
+        }
+        m_enabled = enabled;
+        if (enabled)
+        {
+            // Generational mode does its major collections in a single step,
+            // incremental steps can be spread over several frames
+            m_previous_mode = lua_gc(m_lua, LUA_GCINC, 0, 0, 0);
+            if (m_previous_mode == LUA_GCGEN)
+            {
+                debug::Log->warn("<GarbageCollector> Switching the Lua garbage collector from "
+                                 "generational to incremental mode, set Script.Lua."
+                                 "garbageCollector to \"incremental\" or disable "
+                                 "Script.Lua.GarbageCollector to keep generational mode");
+            }
+            lua_gc(m_lua, LUA_GCSTOP);
+            m_cycle_running = false;
+            m_heap_after_cycle = this->get_heap_size();
+            debug::Log->debug("<GarbageCollector> Collecting Lua garbage with a budget of "
+                              "{}ms per frame (step size: {}KB, pause: {}%, limit: {}%)",
+                m_budget / time::milliseconds, m_step_size, m_pause, std::max(m_limit, m_pause));
+        }
+        else
+        {
+            if (m_previous_mode == LUA_GCGEN)
+            {
+                lua_gc(m_lua, LUA_GCGEN, 0, 0);
+            }
+            lua_gc(m_lua, LUA_GCRESTART);
+        }
+    }
+
+    bool GarbageCollector::is_enabled() const
+    {
+        return m_enabled;
+    }
+
+    void GarbageCollector::set_budget(time::TimeUnit budget)
+    {
+        m_budget = std::max(budget, 0.0);
+    }
+
+    time::TimeUnit GarbageCollector::get_budget() const
+    {
+        return m_budget;
+    }
+
+    void GarbageCollector::set_step_size(int step_size)
+    {
+        m_step_size = std::max(step_size, 1);
+    }
+
+    int GarbageCollector::get_step_size() const
+    {
+        return m_step_size;
+    }
+
+    void GarbageCollector::set_pause(int pause)
+    {
+        m_pause = std::max(pause, 100);
+    }
+
+    int GarbageCollector::get_pause() const
+    {
+        return m_pause;
+    }
+
+    void GarbageCollector::set_limit(int limit)
+    {
+        m_limit = std::max(limit, 100);
+    }
+
+    int GarbageCollector::get_limit() const
+    {
+        return std::max(m_limit, m_pause);
+    }
+
+    void GarbageCollector::collect(time::TimeUnit budget)
+    {
+        OBE_PROFILE_SCOPE("GarbageCollector::collect");
+        const time::TimeUnit start = time::epoch();
+        time::TimeUnit elapsed = 0;
+        // At least one step is done so a collection always progresses
+        do
+        {
+            m_statistics.steps++;
+            const bool cycle_completed = lua_gc(m_lua, LUA_GCSTEP, m_step_size);
+            elapsed = time::epoch() - start;
+            if (cycle_completed)
+            {
+                m_statistics.cycles++;
+                m_cycle_running = false;
+                m_heap_after_cycle = this->get_heap_size();
+                break;
+            }
+            m_cycle_running = true;
+        } while (elapsed < budget);
+        m_frame_pause += elapsed;
+    }
+
+    void GarbageCollector::collect_past_limit()
+    {
+        if (this->get_heap_size() * 100
+            < m_heap_after_cycle * static_cast<std::size_t>(this->get_limit()))
+        {
+            return;
+        }
+        OBE_PROFILE_SCOPE("GarbageCollector::collect_past_limit");
+        const time::TimeUnit start = time::epoch();
+        lua_gc(m_lua, LUA_GCCOLLECT);
+        m_statistics.full_collections++;
+        m_statistics.cycles++;
+        m_cycle_running = false;
+        m_heap_after_cycle = this->get_heap_size();
+        m_frame_pause += time::epoch() - start;
+    }
+
+    void GarbageCollector::collect_in_slack(time::TimeUnit time_left)
+    {
+        if (!m_enabled)
+        {
+            return;
+        }
+        this->collect_past_limit();
+        const time::TimeUnit budget = std::min(m_budget - m_frame_pause, time_left);
+        if (budget <= 0)
+        {
+            return;
+        }
+        // New cycles only start once there is some garbage to collect
+        if (!m_cycle_running
+            && this->get_heap_size() < m_heap_after_cycle + static_cast<std::size_t>(m_step_size))
+        {
+            return;
+        }
+        this->collect(budget);
+    }
+
+    void GarbageCollector::end_frame()
+    {
+        if (!m_enabled)
+        {
+            return;
+        }
+        this->collect_past_limit();
+        if (this->get_heap_size() * 100 >= m_heap_after_cycle * static_cast<std::size_t>(m_pause))
+        {
+            m_statistics.forced_frames++;
+            this->collect(m_budget - m_frame_pause);
+        }
+        m_statistics.last_frame_pause = m_frame_pause;
+        m_statistics.max_frame_pause = std::max(m_statistics.max_frame_pause, m_frame_pause);
+        m_statistics.total_pause += m_frame_pause;
+        m_frame_pause = 0;
+    }
+
+    std::size_t GarbageCollector::get_heap_size() const
+    {
+        return static_cast<std::size_t>(lua_gc(m_lua, LUA_GCCOUNT));
+    }
+
+    const GarbageCollectorStatistics& GarbageCollector::get_statistics() const
+    {
+        return m_statistics;
+    }
+
+    void GarbageCollector::reset_statistics()
+    {
+        m_statistics = GarbageCollectorStatistics {};
+    }
+} // namespace obe::script
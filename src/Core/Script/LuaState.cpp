@@ -1,3 +1,5 @@
+#include <Debug/Logger.hpp>
+#include <Script/BytecodeCache.hpp>
 #include <Script/LuaState.hpp>
 #include <System/Path.hpp>
 
@@ -5,9 +7,24 @@ namespace obe::script
 {
     void LuaState::load_config(const vili::node& config)
     {
+        if (config.contains("bytecodeCache"))
+        {
+            // The directory is created with the first cached script when it does not exist
+            const std::string cache_directory
+                = system::Path(config.at("bytecodeCache").as_string())
+                      .find(system::PathType::Directory)
+                      .hypothetical_path();
+            if (cache_directory.empty())
+            {
+                debug::Log->warn("<LuaState> Could not resolve bytecode cache directory '{}', "
+                                 "bytecode will only be kept in memory",
+                    config.at("bytecodeCache").as_string());
+            }
+            ScriptCache.set_directory(cache_directory);
+        }
         if (config.contains("patchIO") && config.at("patchIO").as_boolean())
         {
-            this->safe_script_file("obe://Lib/Internal/Filesystem.lua"_fs);
+            run_script_file(*this, "obe://Lib/Internal/Filesystem.lua"_fs);
         }
         std::string garbage_collector_mode = "generational";
         if (config.contains("garbageCollector"))
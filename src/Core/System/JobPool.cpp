@@ -0,0 +1,216 @@
+#include <Debug/Logger.hpp>
+#include <System/JobPool.hpp>
+
+namespace obe::system
+{
+    namespace
+    {
+        thread_local const JobPool* t_current_pool = nullptr;
+        thread_local std::size_t t_worker_index = 0;
+    }
+
+    JobPool::JobPool(std::size_t workers_amount)
+    {
+        if (workers_amount == 0)
+        {
+            const std::size_t hardware_threads = std::thread::hardware_concurrency();
+            workers_amount = (hardware_threads > 1) ? hardware_threads - 1 : 0;
+        }
+        m_queues.reserve(workers_amount);
+        for (std::size_t i = 0; i < workers_amount; i++)
+        {
+            m_queues.push_back(std::make_unique<JobQueue>());
+        }
+        m_workers.reserve(workers_amount);
+        for (std::size_t i = 0; i < workers_amount; i++)
+        {
+            m_workers.emplace_back(&JobPool::worker_loop, this, i);
+        }
+    }
+
+    JobPool::~JobPool()
+    {
+        {
+            std::lock_guard lock(m_sleep_mutex);
+            m_stop = true;
+        }
+        m_wake.notify_all();
+        for (std::thread& worker : m_workers)
+        {
+            worker.join();
+        }
+    }
+
+    void JobPool::push(Job job)
+    {
+        const std::size_t queue_index = (t_current_pool == this)
+            ? t_worker_index
+            : m_next_queue.fetch_add(1, std::memory_order_relaxed) % m_queues.size();
+        m_pending.fetch_add(1, std::memory_order_release);
+        {
+            JobQueue& queue = *m_queues[queue_index];
+            std::lock_guard lock(queue.mutex);
+            queue.jobs.push_back(std::move(job));
+        }
+        // Taking the lock guarantees a worker is either awake or already waiting
+        {
+            std::lock_guard lock(m_sleep_mutex);
+        }
+        m_wake.notify_one();
+    }
+
+    bool JobPool::pop(std::size_t queue_index, Job& job)
+    {
+        JobQueue& queue = *m_queues[queue_index];
+        std::lock_guard lock(queue.mutex);
+        if (queue.jobs.empty())
+        {
+            return false;
+        }
+        job = std::move(queue.jobs.back());
+        queue.jobs.pop_back();
+        return true;
+    }
+
+    bool JobPool::steal(std::size_t thief_index, Job& job)
+    {
+        const std::size_t queues_amount = m_queues.size();
+        for (std::size_t offset = 1; offset <= queues_amount; offset++)
+        {
+            JobQueue& queue = *m_queues[(thief_index + offset) % queues_amount];
+            std::lock_guard lock(queue.mutex);
+            if (!queue.jobs.empty())
+            {
+                job = std::move(queue.jobs.front());
+                queue.jobs.pop_front();
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool JobPool::run_pending_job()
+    {
+        if (m_queues.empty())
+        {
+            return false;
+        }
+        const bool is_worker = (t_current_pool == this);
+        const std::size_t index = is_worker ? t_worker_index : m_queues.size();
+        Job job;
+        if (!((is_worker && this->pop(index, job)) || this->steal(index, job)))
+        {
+            return false;
+        }
+        m_pending.fetch_sub(1, std::memory_order_acq_rel);
+        try
+        {
+            job();
+        }
+        catch (const std::exception& e)
+        {
+            debug::Log->error("<JobPool> Uncaught exception in job : {}", e.what());
+        }
+        catch (...)
+        {
+            debug::Log->error("<JobPool> Uncaught unknown exception in job");
+        }
+        return true;
+    }
+
+    void JobPool::worker_loop(std::size_t worker_index)
+    {
+        t_current_pool = this;
+        t_worker_index = worker_index;
+        while (true)
+        {
+            if (this->run_pending_job())
+            {
+                continue;
+            }
+            std::unique_lock lock(m_sleep_mutex);
+            m_wake.wait(lock,
+                [this]() { return m_stop || m_pending.load(std::memory_order_acquire) > 0; });
+            if (m_stop)
+            {
+                return;
+            }
+        }
+    }
+
+    std::size_t JobPool::get_workers_amount() const
+    {
+        return m_workers.size();
+    }
+
+    void JobPool::submit(Job job)
+    {
+        if (m_workers.empty())
+        {
+            job();
+            return;
+        }
+        this->push(std::move(job));
+    }
+
+    void JobPool::parallel_for(std::size_t size, std::size_t grain, const RangeJob& job)
+    {
+        if (size == 0)
+        {
+            return;
+        }
+        grain = std::max<std::size_t>(grain, 1);
+        const std::size_t chunks_amount = (size + grain - 1) / grain;
+        if (m_workers.empty() || chunks_amount == 1)
+        {
+            for (std::size_t begin = 0; begin < size; begin += grain)
+            {
+                job(begin, std::min(begin + grain, size));
+            }
+            return;
+        }
+
+        std::atomic<std::size_t> remaining = chunks_amount - 1;
+        std::exception_ptr error;
+        std::mutex error_mutex;
+        const auto run_chunk = [&](std::size_t begin, std::size_t end)
+        {
+            try
+            {
+                job(begin, end);
+            }
+            catch (...)
+            {
+                std::lock_guard lock(error_mutex);
+                if (!error)
+                {
+                    error = std::current_exception();
+                }
+            }
+        };
+        for (std::size_t chunk = 1; chunk < chunks_amount; chunk++)
+        {
+            const std::size_t begin = chunk * grain;
+            const std::size_t end = std::min(begin + grain, size);
+            this->push(
+                [&run_chunk, &remaining, begin, end]()
+                {
+                    run_chunk(begin, end);
+                    remaining.fetch_sub(1, std::memory_order_acq_rel);
+                });
+        }
+        run_chunk(0, std::min(grain, size));
+        // The calling thread helps the workers instead of blocking
+        while (remaining.load(std::memory_order_acquire) > 0)
+        {
+            if (!this->run_pending_job())
+            {
+                std::this_thread::yield();
+            }
+        }
+        if (error)
+        {
+            std::rethrow_exception(error);
+        }
+    }
+} // namespace obe::system
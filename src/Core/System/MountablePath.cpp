@@ -1,9 +1,9 @@
 #include <string>
 
 #include <platformfolders/platform_folders.h>
-#include <vili/parser.hpp>
 #include <vld8/validator.hpp>
 
+#include <Config/CompiledVili.hpp>
 #include <Config/Validators.hpp>
 #include <Debug/Logger.hpp>
 #include <System/MountablePath.hpp>
@@ -123,7 +123,7 @@ namespace obe::system
         vili::node mounted_paths;
         try
         {
-            mounted_paths = vili::parser::from_file(mount_file_path);
+            mounted_paths = config::load_vili_file(mount_file_path);
         }
         catch (const vili::exceptions::file_not_found& e)
         {
@@ -1,64 +1,24 @@
+#include <cmath>
+#include <numeric>
 #include <utility>
 
 #include <Tiles/Animation.hpp>
 
 namespace obe::tiles
 {
-    void update_quad(
-        sf::Vertex* quad, const Tileset& tileset, uint32_t tile_id, TileInfo additional_tile_info)
-    {
-        if (!tile_id)
-            return;
-
-        TileInfo tile_info = get_tile_info(tile_id);
-        tile_info.flip_diagonal = tile_info.flip_diagonal ^ additional_tile_info.flip_diagonal;
-        tile_info.flip_horizontal
-            = tile_info.flip_horizontal ^ additional_tile_info.flip_horizontal;
-        tile_info.flip_vertical = tile_info.flip_vertical ^ additional_tile_info.flip_vertical;
-
-        const uint32_t first_tile_id = tileset.get_first_tile_id();
-
-        const uint32_t tile_width = tileset.get_tile_width();
-        const uint32_t tile_height = tileset.get_tile_height();
-
-        const int texture_x = (tile_id - first_tile_id) % (tileset.get_image_width() / tile_width);
-        const int texture_y = (tile_id - first_tile_id) / (tileset.get_image_width() / tile_width);
-
-        TextureQuadsIndex quads;
-        quads.transform(tile_info);
-
-        quad[quads.q0].texCoords = sf::Vector2f(texture_x * tile_width, texture_y * tile_height);
-        quad[quads.q1].texCoords
-            = sf::Vector2f((texture_x + 1) * tile_width, texture_y * tile_height);
-        quad[quads.q2].texCoords
-            = sf::Vector2f((texture_x + 1) * tile_width, (texture_y + 1) * tile_height);
-        quad[quads.q3].texCoords
-            = sf::Vector2f(texture_x * tile_width, (texture_y + 1) * tile_height);
-    }
-
     AnimatedTile::AnimatedTile(
         const Tileset& tileset, std::vector<uint32_t> tile_ids, std::vector<time::TimeUnit> sleeps)
         : m_tileset(tileset)
         , m_tile_ids(std::move(tile_ids))
         , m_sleeps(std::move(sleeps))
     {
-    }
-
-    void AnimatedTile::attach_quad(sf::Vertex* quad, TileInfo tile_info)
-    {
-        m_quads.emplace_back(quad, tile_info);
-    }
-
-    void AnimatedTile::detach_quad(sf::Vertex* quad)
-    {
-        std::erase_if(m_quads,
-            [&quad](const std::pair<sf::Vertex*, TileInfo>& item) { return item.first == quad; });
+        m_duration = std::accumulate(m_sleeps.begin(), m_sleeps.end(), time::TimeUnit(0));
     }
 
     void AnimatedTile::start()
     {
         m_started = true;
-        m_clock = time::epoch();
+        m_clock = 0;
     }
 
     void AnimatedTile::stop()
@@ -71,20 +31,70 @@ namespace obe::tiles
         return m_tile_ids[0];
     }
 
-    void AnimatedTile::update()
+    std::size_t AnimatedTile::get_frame_index() const
+    {
+        return m_index;
+    }
+
+    uint32_t AnimatedTile::get_current_tile_id() const
     {
-        if (m_started && time::epoch() - m_clock >= m_sleeps[m_index])
+        return m_tile_ids[m_index];
+    }
+
+    void AnimatedTile::update_quad(sf::Vertex* quad, TileInfo tile_info) const
+    {
+        const uint32_t tile_id = m_tile_ids[m_index];
+        if (!tile_id)
+            return;
+
+        TileInfo frame_info = get_tile_info(tile_id);
+        frame_info.flip_diagonal = frame_info.flip_diagonal ^ tile_info.flip_diagonal;
+        frame_info.flip_horizontal = frame_info.flip_horizontal ^ tile_info.flip_horizontal;
+        frame_info.flip_vertical = frame_info.flip_vertical ^ tile_info.flip_vertical;
+
+        const uint32_t first_tile_id = m_tileset.get_first_tile_id();
+
+        const uint32_t tile_width = m_tileset.get_tile_width();
+        const uint32_t tile_height = m_tileset.get_tile_height();
+
+        const int texture_x
+            = (tile_id - first_tile_id) % (m_tileset.get_image_width() / tile_width);
+        const int texture_y
+            = (tile_id - first_tile_id) / (m_tileset.get_image_width() / tile_width);
+
+        TextureQuadsIndex quads;
+        quads.transform(frame_info);
+
+        quad[quads.q0].texCoords = sf::Vector2f(texture_x * tile_width, texture_y * tile_height);
+        quad[quads.q1].texCoords
+            = sf::Vector2f((texture_x + 1) * tile_width, texture_y * tile_height);
+        quad[quads.q2].texCoords
+            = sf::Vector2f((texture_x + 1) * tile_width, (texture_y + 1) * tile_height);
+        quad[quads.q3].texCoords
+            = sf::Vector2f(texture_x * tile_width, (texture_y + 1) * tile_height);
+    }
+
+    void AnimatedTile::update(time::TimeUnit dt)
+    {
+        if (!m_started)
+        {
+            return;
+        }
+        m_clock += dt;
+        if (m_duration <= 0)
+        {
+            // Frames without duration are shown for a single update
+            m_index = (m_index + 1) % m_sleeps.size();
+            m_clock = 0;
+            return;
+        }
+        // Whole loops of the animation are skipped, the clock keeps the time
+        // spent in the current frame
+        m_clock = std::fmod(m_clock, m_duration);
+        while (m_clock >= m_sleeps[m_index])
         {
-            m_index++;
-            if (m_index == m_sleeps.size())
-            {
-                m_index = 0;
-            }
-            m_clock = time::epoch();
-            for (const auto& quad : m_quads)
-            {
-                update_quad(quad.first, m_tileset, m_tile_ids[m_index], quad.second);
-            }
+            m_clock -= m_sleeps[m_index];
+            m_index = (m_index + 1) % m_sleeps.size();
         }
     }
 }
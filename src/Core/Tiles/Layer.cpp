@@ -1,7 +1,12 @@
+#include <algorithm>
+#include <cmath>
+
 #include <Graphics/DrawUtils.hpp>
 #include <Scene/Scene.hpp>
+#include <Tiles/Animation.hpp>
 #include <Tiles/Exceptions.hpp>
 #include <Tiles/Layer.hpp>
+#include <Tiles/Meshing.hpp>
 
 constexpr std::string_view TILE_FRAGMENT_SHADER_SOURCE = "\
 #version 130\n\
@@ -29,68 +34,176 @@ void main()\n\
 
 namespace obe::tiles
 {
+    namespace
+    {
+        sf::FloatRect merge_rects(const sf::FloatRect& first, const sf::FloatRect& second)
+        {
+            const float left = std::min(first.left, second.left);
+            const float top = std::min(first.top, second.top);
+            const float right = std::max(first.left + first.width, second.left + second.width);
+            const float bottom = std::max(first.top + first.height, second.top + second.height);
+            return sf::FloatRect(left, top, right - left, bottom - top);
+        }
+
+        sf::FloatRect grow_rect(const sf::FloatRect& rect, float width, float height)
+        {
+            return sf::FloatRect(rect.left - width, rect.top - height, rect.width + width * 2,
+                rect.height + height * 2);
+        }
+    }
+
     void TileLayer::build_tile(uint32_t x, uint32_t y, uint32_t tile_id)
     {
         if (!tile_id)
             return;
 
-        const uint32_t tile_index = y + x * m_height;
         const uint32_t tile_data_index = x + y * m_width;
 
         const TileInfo tile_info = get_tile_info(tile_id);
 
         const Tileset& tileset = m_scene.get_tilesets().tileset_from_tile_id(tile_info.tile_id);
-        const uint32_t first_tile_id = tileset.get_first_tile_id();
-        sfe::SpannableVertexArray& vertices = m_sublayers_by_tileset[tileset.get_first_tile_id()];
-        sf::Vertex* quad = &vertices[tile_index * 4];
-        for (auto& animation : m_scene.get_animated_tiles())
+        // Solid tiles share the colliders built by merge_colliders instead
+        const bool solid = m_scene.get_solid_group(tile_info.tile_id) != 0;
+        if (!solid)
         {
-            if (animation->get_id() == tile_info.tile_id)
+            for (const auto& collider : m_scene.get_tile_collider_models(tile_info.tile_id))
             {
-                animation->attach_quad(quad, tile_info);
-                break;
+                collision::ColliderComponent& tile_collider = m_scene.get_scene().create_collider();
+                m_colliders[tile_data_index].push_back(&tile_collider);
+                tile_collider = *collider;
+                // Collider models are in SceneUnits, relative to their tile
+                const transform::UnitVector collider_offset
+                    = collider->get_inner_collider()->get_position();
+                tile_collider.get_inner_collider()->set_position(
+                    transform::UnitVector(tile_pixels_to_units(x * tileset.get_tile_width())
+                            + collider_offset.x,
+                        tile_pixels_to_units(y * tileset.get_tile_height()) + collider_offset.y,
+                        transform::Units::SceneUnits));
             }
         }
-        for (auto& collider : m_scene.get_collider_models())
+        for (const auto& game_object : m_scene.get_tile_game_objects_models(tile_info.tile_id))
+        {
+            std::string game_object_id = utils::string::replace(game_object.at("id"), "{index}",
+                std::to_string(m_scene.get_scene().get_game_object_amount()));
+            vili::node requirements = game_object.at("Requires");
+            transform::UnitVector game_object_position(x * tileset.get_tile_width(),
+                y * tileset.get_tile_height(), transform::Units::ScenePixels);
+            requirements["x"] = requirements["x"].as_number() + game_object_position.x;
+            requirements["y"] = requirements["y"].as_number() + game_object_position.y;
+            m_scene.get_scene()
+                .create_game_object(game_object.at("type"), game_object_id)
+                .init_from_vili(requirements);
+        }
+    }
+
+    void TileLayer::clear_tile(uint32_t x, uint32_t y)
+    {
+        const uint32_t tile_data_index = x + y * m_width;
+        if (const auto tile_colliders = m_colliders.find(tile_data_index);
+            tile_colliders != m_colliders.end())
+        {
+            for (const collision::ColliderComponent* collider : tile_colliders->second)
+            {
+                m_scene.get_scene().remove_collider(collider->get_id());
+            }
+            m_colliders.erase(tile_colliders);
+        }
+
+        // TODO: Clear GameObjects when necessary
+    }
+
+    void TileLayer::clear_tiles_colliders()
+    {
+        for (const auto& [tile_data_index, colliders] : m_colliders)
         {
-            if (collider->get_id() == std::to_string(tile_info.tile_id))
+            for (const collision::ColliderComponent* collider : colliders)
             {
-                m_colliders[tile_data_index] = &m_scene.get_scene().create_collider();
-                (*m_colliders[tile_data_index]) = *collider;
-                // m_colliders[tile_data_index]->set_parent_id("tile_" + std::to_string(tile_info.tile_id));
-                // TODO: Fix this horrible code
-                // TODO: I mean, really, fix this
-                auto camera_size_backup = m_scene.get_scene().get_camera().get_size().y / 2;
-                m_scene.get_scene().get_camera().set_size(1);
-                transform::UnitVector collider_offset
-                    = collider->get_inner_collider()->get_position().to<transform::Units::ScenePixels>();
-                m_colliders.at(tile_data_index)
-                    ->get_inner_collider()
-                    ->set_position(
-                        transform::UnitVector(x * tileset.get_tile_width() + collider_offset.x,
-                            y * tileset.get_tile_height() + collider_offset.y,
-                            transform::Units::ScenePixels));
-                // Backup camera size
-                m_scene.get_scene().get_camera().set_size(camera_size_backup);
+                m_scene.get_scene().remove_collider(collider->get_id());
             }
         }
-        for (const auto& game_object : m_scene.get_game_objects_models())
+        m_colliders.clear();
+    }
+
+    void TileLayer::merge_colliders(
+        uint32_t first_x, uint32_t first_y, uint32_t last_x, uint32_t last_y)
+    {
+        const uint32_t region_width = last_x - first_x;
+        const uint32_t region_height = last_y - first_y;
+        // Collision group of each tile of the region, 0 for the tiles which are not solid
+        std::vector<uint32_t> groups(region_width * region_height, 0);
+        bool has_solid_tiles = false;
+        for (uint32_t y = 0; y < region_height; y++)
         {
-            if (game_object.at("tileId").as<vili::integer>() == tile_info.tile_id)
+            for (uint32_t x = 0; x < region_width; x++)
             {
-                std::string game_object_id = utils::string::replace(game_object.at("id"), "{index}",
-                    std::to_string(m_scene.get_scene().get_game_object_amount()));
-                vili::node requirements = game_object.at("Requires");
-                transform::UnitVector game_object_position(x * tileset.get_tile_width(),
-                    y * tileset.get_tile_height(), transform::Units::ScenePixels);
-                requirements["x"] = requirements["x"].as_number() + game_object_position.x;
-                requirements["y"] = requirements["y"].as_number() + game_object_position.y;
-                m_scene.get_scene()
-                    .create_game_object(game_object.at("type"), game_object_id)
-                    .init_from_vili(requirements);
+                if (const uint32_t tile_id = m_data[(first_x + x) + (first_y + y) * m_width])
+                {
+                    const uint32_t group = m_scene.get_solid_group(strip_tile_flags(tile_id));
+                    groups[x + y * region_width] = group;
+                    has_solid_tiles = has_solid_tiles || group;
+                }
             }
         }
-        m_positions[tile_index] = quad;
+        if (!has_solid_tiles)
+        {
+            return;
+        }
+
+        scene::Scene& scene = m_scene.get_scene();
+        const double tile_width = m_scene.get_tile_width();
+        const double tile_height = m_scene.get_tile_height();
+        for (const TileRectangle& rectangle : merge_tiles(std::move(groups), region_width))
+        {
+            const uint32_t x = first_x + rectangle.x;
+            const uint32_t y = first_y + rectangle.y;
+            collision::ColliderComponent& collider = scene.create_collider();
+            collider.load(vili::object { { "type", "Rectangle" }, { "unit", "SceneUnits" },
+                { "tag", m_scene.get_solid_group_tag(rectangle.group) },
+                { "x", tile_pixels_to_units(x * tile_width) },
+                { "y", tile_pixels_to_units(y * tile_height) },
+                { "width", tile_pixels_to_units(rectangle.width * tile_width) },
+                { "height", tile_pixels_to_units(rectangle.height * tile_height) } });
+            m_merged_colliders.push_back(
+                MergedTileCollider { x, y, rectangle.width, rectangle.height, &collider });
+        }
+    }
+
+    void TileLayer::update_merged_colliders(uint32_t x, uint32_t y)
+    {
+        const auto covering = std::find_if(m_merged_colliders.begin(), m_merged_colliders.end(),
+            [x, y](const MergedTileCollider& merged)
+            {
+                return x >= merged.x && x < merged.x + merged.width && y >= merged.y
+                    && y < merged.y + merged.height;
+            });
+        if (covering == m_merged_colliders.end())
+        {
+            this->merge_colliders(x, y, x + 1, y + 1);
+            return;
+        }
+        // Only the rectangle containing the tile is merged again
+        const MergedTileCollider region = *covering;
+        m_scene.get_scene().remove_collider(region.collider->get_id());
+        m_merged_colliders.erase(covering);
+        this->merge_colliders(
+            region.x, region.y, region.x + region.width, region.y + region.height);
+    }
+
+    void TileLayer::clear_merged_colliders()
+    {
+        for (const MergedTileCollider& merged : m_merged_colliders)
+        {
+            m_scene.get_scene().remove_collider(merged.collider->get_id());
+        }
+        m_merged_colliders.clear();
+    }
+
+    void TileLayer::build_quad(sf::Vertex* quad, uint32_t x, uint32_t y, uint32_t tile_id) const
+    {
+        const TileInfo tile_info = get_tile_info(tile_id);
+        const Tileset& tileset = m_scene.get_tilesets().tileset_from_tile_id(tile_info.tile_id);
+
+        const uint32_t first_tile_id = tileset.get_first_tile_id();
 
         const uint32_t tile_width = tileset.get_tile_width();
         const uint32_t tile_height = tileset.get_tile_height();
@@ -117,66 +230,170 @@ namespace obe::tiles
             = sf::Vector2f(texture_x * tile_width, (texture_y + 1) * tile_height);
     }
 
-    void TileLayer::clear_tile(uint32_t x, uint32_t y)
+    sf::FloatRect TileLayer::get_chunk_area(const TileChunk& chunk) const
     {
-        const uint32_t tile_index = y + x * m_height;
-        const uint32_t tile_data_index = x + y * m_width;
-        sf::Vertex* quad = m_positions[tile_index];
-        const uint32_t old_tile_id = m_data[tile_data_index];
-        for (const auto& animation : m_scene.get_animated_tiles())
+        const uint32_t first_x = chunk.x * m_chunk_size;
+        const uint32_t first_y = chunk.y * m_chunk_size;
+        const uint32_t columns = std::min(first_x + m_chunk_size, m_width) - first_x;
+        const uint32_t rows = std::min(first_y + m_chunk_size, m_height) - first_y;
+        const float tile_width = static_cast<float>(m_scene.get_tile_width());
+        const float tile_height = static_cast<float>(m_scene.get_tile_height());
+        return sf::FloatRect(
+            first_x * tile_width, first_y * tile_height, columns * tile_width, rows * tile_height);
+    }
+
+    void TileLayer::load_chunk(TileChunk& chunk)
+    {
+        const TilesetCollection& tilesets = m_scene.get_tilesets();
+        const uint32_t first_x = chunk.x * m_chunk_size;
+        const uint32_t first_y = chunk.y * m_chunk_size;
+        const uint32_t last_x = std::min(first_x + m_chunk_size, m_width);
+        const uint32_t last_y = std::min(first_y + m_chunk_size, m_height);
+
+        // Quads are counted before being built so each VertexArray is only
+        // allocated once
+        std::unordered_map<uint32_t, std::size_t> quads_by_tileset;
+        for (uint32_t y = first_y; y < last_y; y++)
         {
-            if (animation->get_id() == old_tile_id)
+            for (uint32_t x = first_x; x < last_x; x++)
             {
-                animation->detach_quad(quad);
-                break;
+                if (const uint32_t tile_id = m_data[x + y * m_width])
+                {
+                    const uint32_t stripped_tile_id = strip_tile_flags(tile_id);
+                    quads_by_tileset[tilesets.tileset_from_tile_id(stripped_tile_id)
+                                         .get_first_tile_id()]++;
+                }
             }
         }
-        if (const auto tile_collision = m_colliders.find(tile_data_index);
-            tile_collision != m_colliders.end())
+        for (auto& [first_tile_id, quads_amount] : quads_by_tileset)
         {
-            m_scene.get_scene().remove_collider(tile_collision->second->get_id());
-            m_colliders.erase(tile_collision);
+            sf::VertexArray& vertices = chunk.vertices_by_tileset[first_tile_id];
+            vertices.setPrimitiveType(sf::Quads);
+            vertices.resize(quads_amount * 4);
+            quads_amount = 0;
         }
 
-        // TODO: Clear GameObjects when necessary
-        this->clear_quad(quad);
-        m_positions.erase(tile_index);
+        for (uint32_t y = first_y; y < last_y; y++)
+        {
+            for (uint32_t x = first_x; x < last_x; x++)
+            {
+                const uint32_t tile_id = m_data[x + y * m_width];
+                if (!tile_id)
+                {
+                    continue;
+                }
+                const TileInfo tile_info = get_tile_info(tile_id);
+                const uint32_t first_tile_id
+                    = tilesets.tileset_from_tile_id(tile_info.tile_id).get_first_tile_id();
+                const std::size_t vertex_index = quads_by_tileset[first_tile_id]++ * 4;
+                this->build_quad(
+                    &chunk.vertices_by_tileset[first_tile_id][vertex_index], x, y, tile_id);
+                if (AnimatedTile* animation = m_scene.get_tile_animation(tile_info.tile_id))
+                {
+                    auto animated = std::find_if(chunk.animations.begin(), chunk.animations.end(),
+                        [animation](const AnimatedTileQuads& animated_quads)
+                        { return animated_quads.animation == animation; });
+                    if (animated == chunk.animations.end())
+                    {
+                        // Tiles are built with the first frame of their animation
+                        animated = chunk.animations.insert(chunk.animations.end(),
+                            AnimatedTileQuads { animation, first_tile_id, 0, {} });
+                    }
+                    animated->quads.emplace_back(vertex_index, tile_info);
+                }
+            }
+        }
+
+        chunk.bounds = sf::FloatRect();
+        bool first_bounds = true;
+        for (const auto& [first_tile_id, vertices] : chunk.vertices_by_tileset)
+        {
+            chunk.bounds = first_bounds ? vertices.getBounds()
+                                        : merge_rects(chunk.bounds, vertices.getBounds());
+            first_bounds = false;
+        }
+        chunk.loaded = true;
     }
 
-    void TileLayer::update_quad(sf::Vertex* quad, uint32_t tile_id) const
+    void TileLayer::unload_chunk(TileChunk& chunk)
     {
-        if (!tile_id)
-            return;
+        chunk.vertices_by_tileset.clear();
+        chunk.animations.clear();
+        chunk.bounds = sf::FloatRect();
+        chunk.loaded = false;
+    }
 
-        const TileInfo tile_info = get_tile_info(tile_id);
-        const Tileset& tileset = m_scene.get_tilesets().tileset_from_tile_id(tile_info.tile_id);
+    sf::Transform TileLayer::get_camera_transform(const scene::Camera& camera) const
+    {
+        sf::Transform transform = sf::Transform::Identity;
 
-        const uint32_t first_tile_id = tileset.get_first_tile_id();
+        const transform::UnitVector middle_camera
+            = camera.get_position(transform::Referential::Center)
+                  .to<transform::Units::SceneUnits>();
+        const transform::UnitVector camera_size = camera.get_size();
 
-        const uint32_t tile_width = tileset.get_tile_width();
-        const uint32_t tile_height = tileset.get_tile_height();
+        const float middle_x = transform::UnitVector::Screen.w / 2.0;
+        const float middle_y = transform::UnitVector::Screen.h / 2.0;
 
-        const int texture_x = (tile_id - first_tile_id) % (tileset.get_image_width() / tile_width);
-        const int texture_y = (tile_id - first_tile_id) / (tileset.get_image_width() / tile_width);
+        // Scale layers based on camera size
+        const double camera_scale = 1.0 / (camera_size.y / 2.0);
+        transform.scale(camera_scale, camera_scale, middle_x, middle_y);
 
-        TextureQuadsIndex quads;
-        quads.transform(tile_info);
+        float translate_x = -(middle_camera.x * (transform::UnitVector::Screen.h / 2.f))
+            + (transform::UnitVector::Screen.w / 2);
+        float translate_y = -(middle_camera.y * (transform::UnitVector::Screen.h / 2.f))
+            + (transform::UnitVector::Screen.h / 2);
 
-        quad[quads.q0].texCoords = sf::Vector2f(texture_x * tile_width, texture_y * tile_height);
-        quad[quads.q1].texCoords
-            = sf::Vector2f((texture_x + 1) * tile_width, texture_y * tile_height);
-        quad[quads.q2].texCoords
-            = sf::Vector2f((texture_x + 1) * tile_width, (texture_y + 1) * tile_height);
-        quad[quads.q3].texCoords
-            = sf::Vector2f(texture_x * tile_width, (texture_y + 1) * tile_height);
+        // Translate layers based on camera position
+        if (!m_scene.is_anti_aliased())
+        {
+            translate_x = std::round(translate_x);
+            translate_y = std::round(translate_y);
+        }
+        transform.translate(translate_x, translate_y);
+        return transform;
     }
 
-    void TileLayer::clear_quad(sf::Vertex* quad)
+    void TileLayer::update_streamed_chunks(const sf::FloatRect& visible_area)
     {
-        for (uint8_t i = 0; i < 4; i++)
+        const float chunk_width = static_cast<float>(m_chunk_size * m_scene.get_tile_width());
+        const float chunk_height = static_cast<float>(m_chunk_size * m_scene.get_tile_height());
+        const float margin = static_cast<float>(m_scene.get_streaming_margin());
+        const sf::FloatRect load_area
+            = grow_rect(visible_area, chunk_width * margin, chunk_height * margin);
+        // Chunks are unloaded one chunk further than they are loaded so a camera
+        // moving around the border of a chunk does not rebuild it every frame
+        const sf::FloatRect unload_area
+            = grow_rect(visible_area, chunk_width * (margin + 1), chunk_height * (margin + 1));
+        for (TileChunk& chunk : m_chunks)
         {
-            quad[i].position = sf::Vector2f(0, 0);
-            quad[i].texCoords = sf::Vector2f(0, 0);
+            const sf::FloatRect chunk_area = this->get_chunk_area(chunk);
+            if (!chunk.loaded && chunk_area.intersects(load_area))
+            {
+                this->load_chunk(chunk);
+            }
+            else if (chunk.loaded && !chunk_area.intersects(unload_area))
+            {
+                this->unload_chunk(chunk);
+            }
+        }
+    }
+
+    void TileLayer::animate_chunk(TileChunk& chunk)
+    {
+        for (AnimatedTileQuads& animated : chunk.animations)
+        {
+            const std::size_t frame_index = animated.animation->get_frame_index();
+            if (frame_index == animated.frame_index)
+            {
+                continue;
+            }
+            sf::VertexArray& vertices = chunk.vertices_by_tileset[animated.tileset];
+            for (const auto& [vertex_index, tile_info] : animated.quads)
+            {
+                animated.animation->update_quad(&vertices[vertex_index], tile_info);
+            }
+            animated.frame_index = frame_index;
         }
     }
 
@@ -202,14 +419,30 @@ namespace obe::tiles
 
     void TileLayer::build()
     {
-        m_sublayers_by_tileset.clear();
-        for (const uint32_t first_tile_id : m_scene.get_tilesets().get_tilesets_first_tiles_ids())
+        for (TileChunk& chunk : m_chunks)
+        {
+            if (chunk.loaded)
+            {
+                this->unload_chunk(chunk);
+            }
+        }
+        m_chunks.clear();
+
+        m_chunk_size = std::max(m_scene.get_chunk_size(), 1u);
+        m_chunks_columns = (m_width + m_chunk_size - 1) / m_chunk_size;
+        const uint32_t chunks_rows = (m_height + m_chunk_size - 1) / m_chunk_size;
+        m_chunks.reserve(m_chunks_columns * chunks_rows);
+        for (uint32_t y = 0; y < chunks_rows; y++)
         {
-            m_sublayers_by_tileset[first_tile_id] = sfe::SpannableVertexArray {};
-            m_sublayers_by_tileset[first_tile_id].setPrimitiveType(sf::Quads);
-            m_sublayers_by_tileset[first_tile_id].resize(m_width * m_height * 4);
+            for (uint32_t x = 0; x < m_chunks_columns; x++)
+            {
+                m_chunks.push_back(TileChunk { x, y });
+            }
         }
 
+        // Colliders of a previous build are replaced
+        this->clear_tiles_colliders();
+        this->clear_merged_colliders();
         for (unsigned int x = 0; x < m_width; ++x)
         {
             for (unsigned int y = 0; y < m_height; ++y)
@@ -219,6 +452,16 @@ namespace obe::tiles
                 build_tile(x, y, tile_id);
             }
         }
+        this->merge_colliders(0, 0, m_width, m_height);
+
+        // Streamed chunks are loaded once the camera gets close to them
+        if (!m_scene.is_streaming())
+        {
+            for (TileChunk& chunk : m_chunks)
+            {
+                this->load_chunk(chunk);
+            }
+        }
     }
 
     void TileLayer::draw(graphics::RenderTarget& surface, const scene::Camera& camera)
@@ -229,56 +472,61 @@ namespace obe::tiles
         }
 
         sf::RenderStates states;
-        states.transform = sf::Transform::Identity;
-
-        const transform::UnitVector middle_camera
-            = camera.get_position(transform::Referential::Center)
-                  .to<transform::Units::SceneUnits>();
-        const transform::UnitVector camera_size = camera.get_size();
-
-        const float middle_x = transform::UnitVector::Screen.w / 2.0;
-        const float middle_y = transform::UnitVector::Screen.h / 2.0;
-
-        // Scale layers based on camera size
-        const double camera_scale = 1.0 / (camera_size.y / 2.0);
-        states.transform.scale(camera_scale, camera_scale, middle_x, middle_y);
+        states.transform = this->get_camera_transform(camera);
 
-        float translate_x = -(middle_camera.x * (transform::UnitVector::Screen.h / 2.f))
-            + (transform::UnitVector::Screen.w / 2);
-        float translate_y = -(middle_camera.y * (transform::UnitVector::Screen.h / 2.f))
-            + (transform::UnitVector::Screen.h / 2);
+        // Area of the layer (in pixels) covered by the screen once the camera applied
+        const sf::FloatRect visible_area = states.transform.getInverse().transformRect(
+            sf::FloatRect(0, 0, transform::UnitVector::Screen.w, transform::UnitVector::Screen.h));
+        this->update_visible_chunks(visible_area);
 
-        // Translate layers based on camera position
-        if (!m_scene.is_anti_aliased())
+        for (TileChunk& chunk : m_chunks)
         {
-            translate_x = std::round(translate_x);
-            translate_y = std::round(translate_y);
+            if (!this->is_chunk_drawn(chunk, visible_area))
+            {
+                continue;
+            }
+            for (const auto& [first_tile_id, vertices] : chunk.vertices_by_tileset)
+            {
+                const Tileset& tileset = m_scene.get_tilesets().tileset_from_tile_id(first_tile_id);
+                states.texture = &tileset.get_texture().operator const sf::Texture&();
+                surface.draw(vertices, states);
+            }
         }
-        states.transform.translate(translate_x, translate_y);
-
-        const transform::UnitVector camera_position = camera.get_position();
-        const int64_t camera_x = (camera_position.x * transform::UnitVector::Screen.h / 2.f);
-        const int64_t camera_width = std::ceil(camera_size.y * transform::UnitVector::Screen.w / 2);
-
-        uint32_t vertex_count = 0;
+    }
 
-        for (auto& [first_tile_id, layer] : m_sublayers_by_tileset)
+    void TileLayer::update_visible_chunks(const sf::FloatRect& visible_area)
+    {
+        if (m_scene.is_streaming())
         {
-            const Tileset& tileset = m_scene.get_tilesets().tileset_from_tile_id(first_tile_id);
-            states.texture = &tileset.get_texture().operator const sf::Texture&();
-
-            // Finding out VertexArray rendering span based on camera size and position
-            const uint32_t tileset_tile_width = tileset.get_tile_width();
-            const uint32_t tileset_tile_height = tileset.get_tile_width();
-            const size_t span_start
-                = std::max(0ll, static_cast<long long int>(((camera_x / tileset_tile_width)) * 4 * m_height));
-            const size_t span_end = std::min(layer.getVertexCount(),
-                static_cast<size_t>((((camera_x + camera_width) / tileset_tile_width) + 1) * 4 * m_height));
-            layer.setSpan(span_start, span_end);
+            this->update_streamed_chunks(visible_area);
+        }
+        for (TileChunk& chunk : m_chunks)
+        {
+            // Hidden chunks catch up with the animations once they are visible again
+            if (this->is_chunk_drawn(chunk, visible_area))
+            {
+                this->animate_chunk(chunk);
+            }
+        }
+    }
 
-            // Rendering entire VertexArray
-            surface.draw(layer, states);
+    bool TileLayer::is_chunk_drawn(const TileChunk& chunk, const sf::FloatRect& visible_area) const
+    {
+        if (!chunk.loaded)
+        {
+            return false;
         }
+        // Chunks are culled like the other Renderables of the Scene
+        return !m_scene.get_scene().get_render_options().culling
+            || chunk.bounds.intersects(visible_area);
+    }
+
+    void TileLayer::update_chunks(const scene::Camera& camera)
+    {
+        const sf::FloatRect visible_area
+            = this->get_camera_transform(camera).getInverse().transformRect(sf::FloatRect(
+                0, 0, transform::UnitVector::Screen.w, transform::UnitVector::Screen.h));
+        this->update_visible_chunks(visible_area);
     }
 
     void TileLayer::set_tile(uint32_t x, uint32_t y, uint32_t tile_id)
@@ -295,6 +543,21 @@ namespace obe::tiles
         }
         m_data[tile_data_index] = tile_id;
         this->build_tile(x, y, tile_id);
+
+        if (m_chunks.empty())
+        {
+            return;
+        }
+        this->update_merged_colliders(x, y);
+
+        // The VertexArrays of a chunk only hold its non-empty tiles, the whole
+        // chunk is rebuilt when one of its tiles changes
+        TileChunk& chunk = m_chunks[x / m_chunk_size + (y / m_chunk_size) * m_chunks_columns];
+        if (chunk.loaded)
+        {
+            this->unload_chunk(chunk);
+            this->load_chunk(chunk);
+        }
     }
 
     uint32_t TileLayer::get_tile(uint32_t x, uint32_t y) const
@@ -306,4 +569,20 @@ namespace obe::tiles
         const uint32_t tile_data_index = x + y * m_width;
         return m_data[tile_data_index];
     }
+
+    std::size_t TileLayer::get_chunks_amount() const
+    {
+        return m_chunks.size();
+    }
+
+    const TileChunk& TileLayer::get_chunk(std::size_t index) const
+    {
+        return m_chunks.at(index);
+    }
+
+    std::size_t TileLayer::get_loaded_chunks_amount() const
+    {
+        return std::count_if(
+            m_chunks.begin(), m_chunks.end(), [](const TileChunk& chunk) { return chunk.loaded; });
+    }
 }
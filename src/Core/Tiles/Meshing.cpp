@@ -0,0 +1,57 @@
+#include <algorithm>
+
+#include <Tiles/Meshing.hpp>
+
+namespace obe::tiles
+{
+    std::vector<TileRectangle> merge_tiles(std::vector<uint32_t> groups, uint32_t width)
+    {
+        std::vector<TileRectangle> rectangles;
+        if (width == 0)
+        {
+            return rectangles;
+        }
+        const uint32_t height = static_cast<uint32_t>(groups.size() / width);
+        // Tiles are reset once they are covered by a rectangle
+        const auto group_at = [&groups, width](uint32_t x, uint32_t y) -> uint32_t&
+        { return groups[x + y * width]; };
+
+        for (uint32_t y = 0; y < height; y++)
+        {
+            for (uint32_t x = 0; x < width; x++)
+            {
+                const uint32_t group = group_at(x, y);
+                if (!group)
+                {
+                    continue;
+                }
+                uint32_t rectangle_width = 1;
+                while (x + rectangle_width < width && group_at(x + rectangle_width, y) == group)
+                {
+                    rectangle_width++;
+                }
+                uint32_t rectangle_height = 1;
+                while (y + rectangle_height < height)
+                {
+                    bool full_row = true;
+                    for (uint32_t i = 0; i < rectangle_width && full_row; i++)
+                    {
+                        full_row = group_at(x + i, y + rectangle_height) == group;
+                    }
+                    if (!full_row)
+                    {
+                        break;
+                    }
+                    rectangle_height++;
+                }
+                for (uint32_t covered_y = y; covered_y < y + rectangle_height; covered_y++)
+                {
+                    std::fill_n(&group_at(x, covered_y), rectangle_width, 0);
+                }
+                rectangles.push_back(
+                    TileRectangle { x, y, rectangle_width, rectangle_height, group });
+            }
+        }
+        return rectangles;
+    }
+} // namespace obe::tiles
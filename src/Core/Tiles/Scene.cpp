@@ -6,6 +6,38 @@
 
 namespace obe::tiles
 {
+    namespace
+    {
+        // Collision models in pixels are converted to SceneUnits once, so they
+        // no longer depend on the size of the Camera when they are placed
+        vili::node to_scene_units(const vili::node& collision)
+        {
+            if (collision.contains("unit")
+                && collision.at("unit").as<vili::string>() != "ScenePixels")
+            {
+                return collision;
+            }
+            vili::node converted = collision;
+            converted["unit"] = "SceneUnits";
+            for (const char* field : { "x", "y", "width", "height" })
+            {
+                if (converted.contains(field))
+                {
+                    converted[field] = tile_pixels_to_units(converted.at(field));
+                }
+            }
+            if (converted.contains("points"))
+            {
+                for (vili::node& point : converted["points"])
+                {
+                    point["x"] = tile_pixels_to_units(point.at("x"));
+                    point["y"] = tile_pixels_to_units(point.at("y"));
+                }
+            }
+            return converted;
+        }
+    }
+
     void TileScene::build()
     {
         debug::Log->info(
@@ -16,6 +48,37 @@ namespace obe::tiles
         }
     }
 
+    void TileScene::add_solid_tile(uint32_t tile_id, const std::string& tag)
+    {
+        const auto group = std::find(m_solid_groups_tags.begin(), m_solid_groups_tags.end(), tag);
+        if (group == m_solid_groups_tags.end())
+        {
+            m_solid_groups_tags.push_back(tag);
+            m_solid_tiles[tile_id] = static_cast<uint32_t>(m_solid_groups_tags.size());
+        }
+        else
+        {
+            m_solid_tiles[tile_id]
+                = static_cast<uint32_t>(std::distance(m_solid_groups_tags.begin(), group) + 1);
+        }
+    }
+
+    void TileScene::index_models()
+    {
+        m_animated_tiles_by_tile_id.clear();
+        m_game_objects_models_by_tile_id.clear();
+        // The first animation of a tile wins, like when they were looked up in order
+        for (const auto& animation : m_animated_tiles)
+        {
+            m_animated_tiles_by_tile_id.emplace(animation->get_id(), animation.get());
+        }
+        for (const vili::node& game_object : m_game_objects_models)
+        {
+            const vili::integer tile_id = game_object.at("tileId");
+            m_game_objects_models_by_tile_id[static_cast<uint32_t>(tile_id)].push_back(game_object);
+        }
+    }
+
     TileScene::TileScene(scene::Scene& scene)
         : m_scene(scene)
     {
@@ -41,11 +104,32 @@ namespace obe::tiles
         {
             m_smooth = data["smooth"];
         }
+        if (data.contains("chunkSize"))
+        {
+            m_chunk_size = data["chunkSize"];
+        }
+        if (data.contains("streaming"))
+        {
+            m_streaming = data["streaming"];
+        }
+        if (data.contains("streamingMargin"))
+        {
+            m_streaming_margin = data["streamingMargin"];
+        }
+        if (data.contains("mergeColliders"))
+        {
+            m_merge_colliders = data["mergeColliders"];
+        }
 
         const vili::node& tilesets = data["sources"];
         for (const auto& [tileset_id, tileset] : tilesets.items())
         {
-            m_tilesets.add_tileset(tileset["firstTileId"], tileset_id, tileset["image"]["path"],
+            std::string image_path;
+            if (tileset.contains("image"))
+            {
+                image_path = tileset.at("image").at("path");
+            }
+            m_tilesets.add_tileset(tileset["firstTileId"], tileset_id, image_path,
                 tileset["columns"], tileset["tile"]["width"], tileset["tile"]["height"],
                 tileset["tilecount"]);
 
@@ -71,15 +155,47 @@ namespace obe::tiles
             }
             if (tileset.contains("collisions"))
             {
+                // Tiles which single collider covers the whole tile, by tag
+                std::unordered_map<uint32_t, std::string> whole_tiles;
                 for (const vili::node& collision : tileset.at("collisions"))
                 {
-                    const std::string collision_id
-                        = std::to_string(collision.at("id").as<vili::integer>()
+                    const uint32_t collision_tile_id
+                        = static_cast<uint32_t>(collision.at("id").as<vili::integer>()
                             + tileset.at("firstTileId").as<vili::integer>());
+                    const std::string collision_id = std::to_string(collision_tile_id);
                     std::unique_ptr<collision::ColliderComponent> model
                         = std::make_unique<collision::ColliderComponent>(collision_id);
-                    model->load(collision);
+                    model->load(to_scene_units(collision));
+                    m_collider_models_by_tile_id[collision_tile_id].push_back(model.get());
                     m_collider_models.push_back(std::move(model));
+
+                    const bool pixels = !collision.contains("unit")
+                        || collision.at("unit").as<vili::string>() == "ScenePixels";
+                    const bool whole_tile = collision.at("type").as<vili::string>() == "Rectangle"
+                        && static_cast<double>(collision.at("x")) == 0
+                        && static_cast<double>(collision.at("y")) == 0
+                        && static_cast<double>(collision.at("width")) == m_tile_width
+                        && static_cast<double>(collision.at("height")) == m_tile_height;
+                    const bool same_tile_size = current_tileset.get_tile_width() == m_tile_width
+                        && current_tileset.get_tile_height() == m_tile_height;
+                    if (pixels && whole_tile && same_tile_size)
+                    {
+                        std::string tag;
+                        if (collision.contains("tag"))
+                        {
+                            tag = collision.at("tag");
+                        }
+                        whole_tiles[collision_tile_id] = tag;
+                    }
+                }
+                // Only tiles with a single whole tile Rectangle can be merged with
+                // the neighbouring tiles, their other colliders would be lost
+                for (const auto& [tile_id, tag] : whole_tiles)
+                {
+                    if (m_collider_models_by_tile_id.at(tile_id).size() == 1)
+                    {
+                        this->add_solid_tile(tile_id, tag);
+                    }
                 }
             }
             if (tileset.contains("objects"))
@@ -91,7 +207,7 @@ namespace obe::tiles
             }
         }
 
-        AnimatedTiles animations = this->get_animated_tiles();
+        this->index_models();
 
         const vili::node& layers = data["layers"];
         for (const auto& [layer_id, layer] : layers.items())
@@ -126,11 +242,11 @@ namespace obe::tiles
         }
     }
 
-    void TileScene::update() const
+    void TileScene::update(time::TimeUnit dt) const
     {
         for (const auto& animation : m_animated_tiles)
         {
-            animation->update();
+            animation->update(dt);
         }
     }
 
@@ -140,10 +256,20 @@ namespace obe::tiles
         m_layers.clear();
         m_animated_tiles.clear();
         m_collider_models.clear();
+        m_game_objects_models.clear();
+        m_animated_tiles_by_tile_id.clear();
+        m_collider_models_by_tile_id.clear();
+        m_game_objects_models_by_tile_id.clear();
+        m_solid_tiles.clear();
+        m_solid_groups_tags.clear();
         m_width = 0;
         m_height = 0;
         m_tile_width = 0;
         m_tile_height = 0;
+        m_chunk_size = 32;
+        m_streaming = false;
+        m_streaming_margin = 1;
+        m_merge_colliders = true;
     }
 
     std::vector<TileLayer*> TileScene::get_all_layers() const
@@ -218,6 +344,39 @@ namespace obe::tiles
         return m_game_objects_models;
     }
 
+    AnimatedTile* TileScene::get_tile_animation(uint32_t tile_id) const
+    {
+        if (const auto animation = m_animated_tiles_by_tile_id.find(tile_id);
+            animation != m_animated_tiles_by_tile_id.end())
+        {
+            return animation->second;
+        }
+        return nullptr;
+    }
+
+    const std::vector<collision::ColliderComponent*>& TileScene::get_tile_collider_models(
+        uint32_t tile_id) const
+    {
+        static const std::vector<collision::ColliderComponent*> no_models;
+        if (const auto models = m_collider_models_by_tile_id.find(tile_id);
+            models != m_collider_models_by_tile_id.end())
+        {
+            return models->second;
+        }
+        return no_models;
+    }
+
+    const std::vector<vili::node>& TileScene::get_tile_game_objects_models(uint32_t tile_id) const
+    {
+        static const std::vector<vili::node> no_models;
+        if (const auto models = m_game_objects_models_by_tile_id.find(tile_id);
+            models != m_game_objects_models_by_tile_id.end())
+        {
+            return models->second;
+        }
+        return no_models;
+    }
+
     uint32_t TileScene::get_width() const
     {
         return m_width;
@@ -243,6 +402,44 @@ namespace obe::tiles
         return m_smooth;
     }
 
+    uint32_t TileScene::get_chunk_size() const
+    {
+        return m_chunk_size;
+    }
+
+    bool TileScene::is_streaming() const
+    {
+        return m_streaming;
+    }
+
+    uint32_t TileScene::get_streaming_margin() const
+    {
+        return m_streaming_margin;
+    }
+
+    bool TileScene::is_merging_colliders() const
+    {
+        return m_merge_colliders;
+    }
+
+    uint32_t TileScene::get_solid_group(uint32_t tile_id) const
+    {
+        if (!m_merge_colliders)
+        {
+            return 0;
+        }
+        if (const auto solid_tile = m_solid_tiles.find(tile_id); solid_tile != m_solid_tiles.end())
+        {
+            return solid_tile->second;
+        }
+        return 0;
+    }
+
+    const std::string& TileScene::get_solid_group_tag(uint32_t group) const
+    {
+        return m_solid_groups_tags.at(group - 1);
+    }
+
     scene::Scene& TileScene::get_scene() const
     {
         return m_scene;
@@ -1,6 +1,7 @@
 #include <tuple>
 
 #include <Tiles/Tile.hpp>
+#include <Transform/UnitVector.hpp>
 
 namespace obe::tiles
 {
@@ -25,6 +26,12 @@ namespace obe::tiles
         return tile_id & ~(FLIP_HORIZONTAL_FLAG | FLIP_VERTICAL_FLAG | FLIP_DIAGONAL_FLAG);
     }
 
+    double tile_pixels_to_units(double pixels)
+    {
+        // A Camera of size 1 covers 2 SceneUnits of the height of the screen
+        return pixels * 2.0 / transform::UnitVector::Screen.h;
+    }
+
     void TextureQuadsIndex::transform(const TileInfo& info)
     {
         if (info.flip_diagonal)
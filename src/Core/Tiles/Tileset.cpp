@@ -19,6 +19,15 @@ namespace obe::tiles
         , m_tile_height(tile_height)
         , m_image_path(image_path)
     {
+        // Tilesets without image only hold the collisions, animations and
+        // objects of their tiles, they can be loaded without a window
+        if (m_image_path.empty())
+        {
+            const uint32_t rows = columns ? (tile_count + columns - 1) / columns : 0;
+            m_image_width = columns * tile_width;
+            m_image_height = rows * tile_height;
+            return;
+        }
         m_image.load_from_file(system::Path(m_image_path).find());
         // m_image.set_anti_aliasing(true);
         m_image_width = m_image.get_size().to<transform::Units::ScenePixels>().x;
@@ -1,3 +1,4 @@
+#include <algorithm>
 #include <thread>
 
 #include <Debug/Logger.hpp>
@@ -8,6 +9,7 @@ namespace obe::time
     FramerateManager::FramerateManager(system::Window& window)
         : m_window(window)
         , m_clock(epoch())
+        , m_update_clock(m_clock)
         , m_current_frame(0)
         , m_frame_progression(0)
         , m_need_to_render(false)
@@ -39,19 +41,25 @@ namespace obe::time
 
     void FramerateManager::update()
     {
-        const time::TimeUnit since_last_update = epoch() - m_clock;
+        const time::TimeUnit now = epoch();
+        const time::TimeUnit since_last_update = now - m_clock;
         const time::TimeUnit expected_frame_time
-            = 1.0 / static_cast<double>(m_framerate_target.value());
+            = m_framerate_target ? 1.0 / static_cast<double>(m_framerate_target.value()) : 0;
         if (!m_framerate_target || since_last_update > expected_frame_time)
         {
             m_need_to_render = true;
-            m_delta_time = epoch() - m_clock;
-            m_clock = epoch();
+            m_delta_time = since_last_update;
+            m_clock = now;
         }
         else if (!m_sync_update_render)
         {
             std::this_thread::sleep_for(std::chrono::duration<double>(expected_frame_time / 20.f));
         }
+        if (this->should_update())
+        {
+            m_update_delta_time = now - m_update_clock;
+            m_update_clock = now;
+        }
     }
 
     TimeUnit FramerateManager::get_raw_delta_time() const
@@ -64,6 +72,11 @@ namespace obe::time
         return std::min(m_delta_time * m_speed_coefficient, m_max_delta_time);
     }
 
+    double FramerateManager::get_update_delta_time() const
+    {
+        return std::min(m_update_delta_time * m_speed_coefficient, m_max_delta_time);
+    }
+
     double FramerateManager::get_speed_coefficient() const
     {
         return m_speed_coefficient;
@@ -79,6 +92,17 @@ namespace obe::time
         return m_framerate_target.value_or(0);
     }
 
+    TimeUnit FramerateManager::get_time_before_next_frame() const
+    {
+        if (!m_framerate_target)
+        {
+            return 0;
+        }
+        const time::TimeUnit expected_frame_time
+            = 1.0 / static_cast<double>(m_framerate_target.value());
+        return std::max(expected_frame_time - (epoch() - m_clock), 0.0);
+    }
+
     bool FramerateManager::is_vsync_enabled() const
     {
         return m_vsync_enabled;
@@ -123,6 +147,7 @@ namespace obe::time
     void FramerateManager::start()
     {
         m_clock = epoch();
+        m_update_clock = m_clock;
     }
 
     void FramerateManager::reset()
@@ -1,4 +1,5 @@
 #include <fstream>
+#include <iterator>
 #include <string>
 #include <sys/stat.h>
 #include <sys/types.h>
@@ -31,7 +32,7 @@ namespace obe::utils::file
 {
     std::vector<std::string> get_directory_list(const std::string& path)
     {
-        debug::Log->trace("<FileUtils> Get Directory List at {0}", path);
+        OBE_TRACE("<FileUtils> Get Directory List at {0}", path);
         std::vector<std::string> folder_list;
 #ifdef _USE_FILESYSTEM_FALLBACK
         tinydir_dir dir;
@@ -63,7 +64,7 @@ namespace obe::utils::file
 
     std::vector<std::string> get_file_list(const std::string& path)
     {
-        debug::Log->trace("<FileUtils> Get File List at {0}", path);
+        OBE_TRACE("<FileUtils> Get File List at {0}", path);
 
         std::vector<std::string> file_list;
 #ifdef _USE_FILESYSTEM_FALLBACK
@@ -96,7 +97,7 @@ namespace obe::utils::file
 
     bool file_exists(const std::string& path)
     {
-        debug::Log->trace("<FileUtils> Test File existence at {0}", path);
+        OBE_TRACE("<FileUtils> Test File existence at {0}", path);
 
 #ifdef _USE_FILESYSTEM_FALLBACK
         struct stat buffer;
@@ -109,7 +110,7 @@ namespace obe::utils::file
 
     bool directory_exists(const std::string& path)
     {
-        debug::Log->trace("<FileUtils> Get Directory existence at {0}", path);
+        OBE_TRACE("<FileUtils> Get Directory existence at {0}", path);
 
 #ifdef _USE_FILESYSTEM_FALLBACK
         if (FsAccess(path.c_str(), 0) == 0)
@@ -126,7 +127,7 @@ namespace obe::utils::file
 
     bool create_directory(const std::string& path)
     {
-        debug::Log->trace("<FileUtils> Create Directory at {0}", path);
+        OBE_TRACE("<FileUtils> Create Directory at {0}", path);
 
 #ifdef _USE_FILESYSTEM_FALLBACK
 #ifdef _WIN32
@@ -142,14 +143,14 @@ namespace obe::utils::file
 
     void create_file(const std::string& path)
     {
-        debug::Log->trace("<FileUtils> Create File at {0}", path);
+        OBE_TRACE("<FileUtils> Create File at {0}", path);
         std::ofstream dst(path, std::ios::binary);
         dst.close();
     }
 
     void copy(const std::string& source, const std::string& target)
     {
-        debug::Log->trace("<FileUtils> Copy file from {0} to {1}", source, target);
+        OBE_TRACE("<FileUtils> Copy file from {0} to {1}", source, target);
 
         // std::filesystem::copy(source, target); (Doesn't work for now)
         const std::ifstream src(source, std::ios::binary);
@@ -161,13 +162,13 @@ namespace obe::utils::file
     bool delete_file(const std::string& path)
     {
         if (debug::Log != nullptr)
-            debug::Log->trace("<FileUtils> Delete File at {0}", path);
+            OBE_TRACE("<FileUtils> Delete File at {0}", path);
         return std::remove(path.c_str()) == 0;
     }
 
     bool delete_directory(const std::string& path)
     {
-        debug::Log->trace("<FileUtils> Delete Directory at {0}", path);
+        OBE_TRACE("<FileUtils> Delete Directory at {0}", path);
 
 #ifdef _USE_FILESYSTEM_FALLBACK
         debug::Log->error("<FileUtils> Unimplemented delete_directory for "
@@ -179,6 +180,37 @@ namespace obe::utils::file
         return false;
     }
 
+    bool read_file(const std::string& path, std::string& content)
+    {
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+        {
+            return false;
+        }
+        content.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+        return !file.bad();
+    }
+
+    bool write_file(const std::string& path, std::string_view content)
+    {
+        std::error_code error;
+        std::filesystem::create_directories(std::filesystem::path(path).parent_path(), error);
+        std::ofstream file(path, std::ios::binary);
+        file.write(content.data(), static_cast<std::streamsize>(content.size()));
+        return static_cast<bool>(file);
+    }
+
+    std::uint64_t hash_content(std::string_view content)
+    {
+        std::uint64_t hash = 14695981039346656037ull;
+        for (const char character : content)
+        {
+            hash ^= static_cast<unsigned char>(character);
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
     std::string get_current_directory()
     {
 #ifdef _USE_FILESYSTEM_FALLBACK
@@ -5,16 +5,12 @@
 #include <sol/sol.hpp>
 #include <styler/styler.hpp>
 
+#include <Bindings/Index.hpp>
 #include <Debug/Logger.hpp>
 #include <Graphics/Color.hpp>
 #include <Script/Scripting.hpp>
 #include <System/Path.hpp>
 
-namespace obe::bindings
-{
-    void index_core_bindings(sol::state_view state);
-}
-
 int lua_exception_handler2(lua_State* L, sol::optional<const std::exception&> maybe_exception,
     sol::string_view description)
 {
@@ -86,7 +82,8 @@ void run(std::string command)
     // Table shared across all environments, for easy value sharing
     lua["Global"] = sol::new_table();
 
-    bindings::index_core_bindings(lua);
+    // Commands only use a few namespaces, the others are loaded when needed
+    bindings::index_core_bindings(lua, bindings::BindingsLoading::Lazy);
     lua.safe_script_file("obe://Lib/Internal/Require.lua"_fs);
     lua.safe_script_file("obe://Lib/Internal/Helpers.lua"_fs);
     lua.safe_script_file("obe://Lib/Internal/Logger.lua"_fs);
@@ -0,0 +1,90 @@
+#include <vector>
+
+#include <catch_amalgamated.hpp>
+
+#include <Animation/AnimationGroup.hpp>
+
+#include <TestUtils.hpp>
+
+using namespace obe::animation;
+
+namespace
+{
+    AnimationGroup make_group()
+    {
+        AnimationGroup group("walk");
+        for (uint32_t frame_index = 0; frame_index < 3; frame_index++)
+        {
+            group.push_frame_index(frame_index);
+        }
+        group.set_delay(0.5);
+        group.set_loops(2);
+        return group;
+    }
+
+    /**
+     * \brief Updates the group with `updates_per_frame` steps of `dt` before each
+     *        call to next and returns the group index of every frame until it is over
+     */
+    std::vector<std::size_t> play(
+        AnimationGroup& group, obe::time::TimeUnit dt, std::size_t updates_per_frame)
+    {
+        std::vector<std::size_t> indexes;
+        while (!group.is_over() && indexes.size() < 100)
+        {
+            for (std::size_t i = 0; i < updates_per_frame; i++)
+            {
+                group.update(dt);
+            }
+            group.next();
+            if (!group.is_over())
+            {
+                indexes.push_back(group.get_group_index());
+            }
+        }
+        return indexes;
+    }
+}
+
+TEST_CASE("AnimationGroups advance with the delta time", "[obe.Animation.AnimationGroup]")
+{
+    obe::tests::ensure_logger();
+    AnimationGroup group = make_group();
+    // The first update starts from an elapsed clock so the first frame is shown at once,
+    // the next ones are shown when more than 0.5s have elapsed
+    const std::vector<std::size_t> expected
+        = { 0, 0, 0, 1, 1, 1, 2, 2, 2, 0, 0, 0, 1, 1, 1, 2, 2, 2 };
+    REQUIRE(play(group, 0.25, 1) == expected);
+
+    SECTION("The same time split in smaller steps gives the same frames")
+    {
+        AnimationGroup split = make_group();
+        REQUIRE(play(split, 0.125, 2) == expected);
+    }
+    SECTION("A reset group is back on its first frame and steps on its next update")
+    {
+        group.reset();
+        REQUIRE(group.get_group_index() == 0);
+        REQUIRE_FALSE(group.is_over());
+        REQUIRE(play(group, 0.25, 1)
+            == std::vector<std::size_t> { 1, 1, 1, 2, 2, 2, 0, 0, 0, 1, 1, 1, 2, 2, 2 });
+    }
+}
+
+TEST_CASE("AnimationGroups don't advance without delta time", "[obe.Animation.AnimationGroup]")
+{
+    obe::tests::ensure_logger();
+    AnimationGroup group = make_group();
+    group.update(0);
+    group.next();
+    REQUIRE(group.get_group_index() == 0);
+    for (int i = 0; i < 10; i++)
+    {
+        group.update(0);
+        group.next();
+    }
+    REQUIRE(group.get_group_index() == 0);
+    group.update(0.75);
+    group.next();
+    REQUIRE(group.get_group_index() == 1);
+}
@@ -0,0 +1,34 @@
+#include <catch_amalgamated.hpp>
+
+#include <Animation/Animator.hpp>
+#include <Animation/Exceptions.hpp>
+
+#include <TestUtils.hpp>
+
+using namespace obe::animation;
+
+TEST_CASE("An AnimatorState has no Animation until an Animator is loaded",
+    "[obe.Animation.AnimatorState]")
+{
+    obe::tests::ensure_logger();
+    AnimatorState state;
+    state.load();
+
+    REQUIRE(state.get_all_animations_names().empty());
+    REQUIRE(state.get_current_animation_name().empty());
+    REQUIRE(state.get_current_animation() == nullptr);
+    REQUIRE_THROWS_AS(state.set_animation("idle"), exceptions::UnknownAnimation);
+    REQUIRE_THROWS_AS(state.update(0.016), exceptions::NoSelectedAnimation);
+    // Paused AnimatorStates are not updated
+    state.set_paused(true);
+    REQUIRE_NOTHROW(state.update(0.016));
+}
+
+TEST_CASE("AnimatorStates without Animator don't allocate one each",
+    "[obe.Animation.AnimatorState]")
+{
+    const AnimatorState first;
+    const AnimatorState second;
+    REQUIRE(&first.get_animator() == &second.get_animator());
+    REQUIRE(first.get_animator().get_all_animations_names().empty());
+}
@@ -0,0 +1,140 @@
+#include <algorithm>
+#include <cctype>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <regex>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <catch_amalgamated.hpp>
+
+namespace
+{
+    const std::filesystem::path BindingsDirectory
+        = std::filesystem::path(OBE_CORE_SOURCE_DIRECTORY) / "Bindings";
+
+    std::string read_file(const std::filesystem::path& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    // Reads the Groups table of the lazy bindings loader
+    std::map<std::string, std::vector<std::string>> read_groups()
+    {
+        const std::string index = read_file(BindingsDirectory / "index.cpp");
+        const std::regex group_pattern(
+            R"regex(\{\s*"([\w.]+)",\s*\{([^}]*)\},\s*&load_\w+\s*\})regex");
+        const std::regex dependency_pattern(R"regex("([\w.]+)")regex");
+        std::map<std::string, std::vector<std::string>> groups;
+        for (auto group = std::sregex_iterator(index.begin(), index.end(), group_pattern);
+             group != std::sregex_iterator(); ++group)
+        {
+            std::vector<std::string>& dependencies = groups[(*group)[1].str()];
+            const std::string list = (*group)[2].str();
+            for (auto dependency
+                 = std::sregex_iterator(list.begin(), list.end(), dependency_pattern);
+                 dependency != std::sregex_iterator(); ++dependency)
+            {
+                dependencies.push_back((*dependency)[1].str());
+            }
+        }
+        return groups;
+    }
+
+    void collect_dependencies(const std::map<std::string, std::vector<std::string>>& groups,
+        const std::string& group, std::set<std::string>& loaded)
+    {
+        if (!loaded.insert(group).second)
+        {
+            return;
+        }
+        for (const std::string& dependency : groups.at(group))
+        {
+            collect_dependencies(groups, dependency, loaded);
+        }
+    }
+
+    // "obe/graphics/canvas/Canvas.cpp" belongs to the "obe.graphics" group
+    std::string get_file_group(const std::map<std::string, std::vector<std::string>>& groups,
+        const std::filesystem::path& file)
+    {
+        std::string name = std::filesystem::relative(file.parent_path(), BindingsDirectory)
+                               .generic_string();
+        std::replace(name.begin(), name.end(), '/', '.');
+        while (!groups.contains(name) && name.find('.') != std::string::npos)
+        {
+            name.erase(name.rfind('.'));
+        }
+        return name;
+    }
+
+    // Splits the content of sol::bases<...> on its top level commas
+    std::vector<std::string> read_base_classes(const std::string& source)
+    {
+        std::vector<std::string> bases;
+        constexpr std::string_view BasesPrefix = "sol::bases<";
+        for (std::size_t position = source.find(BasesPrefix); position != std::string::npos;
+             position = source.find(BasesPrefix, position))
+        {
+            position += BasesPrefix.size();
+            std::string base;
+            for (int depth = 0; position < source.size(); position++)
+            {
+                const char character = source[position];
+                if ((character == ',' || character == '>') && depth == 0)
+                {
+                    bases.push_back(base);
+                    base.clear();
+                    if (character == '>')
+                    {
+                        break;
+                    }
+                }
+                else if (!std::isspace(static_cast<unsigned char>(character)))
+                {
+                    depth += (character == '<') - (character == '>');
+                    base.push_back(character);
+                }
+            }
+        }
+        return bases;
+    }
+}
+
+TEST_CASE("Base classes are bound by the group or one of its dependencies",
+    "[obe.Bindings.Groups]")
+{
+    const auto groups = read_groups();
+    REQUIRE(groups.contains("obe"));
+    REQUIRE(groups.contains("obe.graphics"));
+
+    const std::regex namespace_pattern(R"(^(vili|obe)::(\w+)(::)?)");
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(BindingsDirectory))
+    {
+        if (entry.path().extension() != ".cpp" || entry.path().parent_path() == BindingsDirectory)
+        {
+            continue;
+        }
+        const std::string group = get_file_group(groups, entry.path());
+        REQUIRE(groups.contains(group));
+        // The root namespace is always loaded first
+        std::set<std::string> loaded = { "obe" };
+        collect_dependencies(groups, group, loaded);
+        for (const std::string& base : read_base_classes(read_file(entry.path())))
+        {
+            std::smatch match;
+            REQUIRE(std::regex_search(base, match, namespace_pattern));
+            std::string base_group = match[1].str();
+            if (match[1] == "obe" && match[3].matched)
+            {
+                base_group += "." + match[2].str();
+            }
+            INFO(entry.path().filename().string() << " binds a subclass of " << base);
+            CHECK(loaded.contains(base_group));
+        }
+    }
+}
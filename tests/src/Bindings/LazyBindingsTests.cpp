@@ -0,0 +1,98 @@
+#include <catch_amalgamated.hpp>
+
+#include <Bindings/Index.hpp>
+#include <System/MountablePath.hpp>
+#include <Transform/UnitVector.hpp>
+
+#include <TestUtils.hpp>
+
+using namespace obe::bindings;
+
+namespace
+{
+    // Some namespaces run scripts from the obe:// and extlibs:// prefixes
+    void make_lazy_state(sol::state& lua)
+    {
+        obe::tests::ensure_logger();
+        obe::system::MountablePath::mount(
+            obe::system::MountablePath(
+                obe::system::MountablePathType::Path, OBE_ENGINE_DIRECTORY, "obe"),
+            obe::system::SamePrefixPolicy::Replace);
+        obe::system::MountablePath::mount(
+            obe::system::MountablePath(obe::system::MountablePathType::Path,
+                OBE_ENGINE_DIRECTORY "/Lib/Extlibs", "extlibs"),
+            obe::system::SamePrefixPolicy::Replace);
+        lua.open_libraries(sol::lib::base, sol::lib::string, sol::lib::table, sol::lib::package,
+            sol::lib::os, sol::lib::coroutine, sol::lib::math, sol::lib::debug, sol::lib::io);
+        index_core_bindings(lua, BindingsLoading::Lazy);
+    }
+}
+
+TEST_CASE("Namespaces are loaded on their first access", "[obe.Bindings.Lazy]")
+{
+    sol::state lua;
+    make_lazy_state(lua);
+
+    REQUIRE(lua.safe_script("return rawget(obe, 'system') ~= nil").get<bool>());
+    REQUIRE(lua.safe_script("return rawget(obe, 'time') == nil").get<bool>());
+    REQUIRE(lua.safe_script("return type(obe.time.epoch)").get<std::string>() == "function");
+    REQUIRE(lua.safe_script("return rawget(obe, 'time') ~= nil").get<bool>());
+    // Missing namespaces are nil, as with eager bindings
+    REQUIRE(lua.safe_script("return obe.missing == nil").get<bool>());
+
+    SECTION("pairs loads the namespaces which are not loaded yet")
+    {
+        REQUIRE(lua.safe_script(R"(
+            local namespaces = {};
+            for name in pairs(obe) do
+                namespaces[name] = true;
+            end
+            return namespaces.transform and namespaces.graphics and namespaces.tiles
+        )")
+                    .get<bool>());
+    }
+}
+
+TEST_CASE("Usertypes pushed before their namespace is loaded are usable",
+    "[obe.Bindings.Lazy]")
+{
+    sol::state lua;
+    make_lazy_state(lua);
+    REQUIRE(lua.safe_script("return rawget(obe, 'transform') == nil").get<bool>());
+
+    lua["vector"] = obe::transform::UnitVector(1, 2);
+    REQUIRE(lua.safe_script("return vector.x").get<double>() == 1);
+    lua.safe_script("vector.y = 5");
+    REQUIRE(lua.get<obe::transform::UnitVector&>("vector").y == 5);
+    REQUIRE(lua.safe_script("return rawget(obe, 'transform') ~= nil").get<bool>());
+    // Values pushed once the namespace is loaded use the complete usertype
+    lua["other"] = obe::transform::UnitVector(3, 4);
+    REQUIRE(lua.safe_script("return (vector + other).x").get<double>() == 4);
+}
+
+TEST_CASE("A namespace which failed to load is loaded again on its next access",
+    "[obe.Bindings.Lazy]")
+{
+    sol::state lua;
+    make_lazy_state(lua);
+    lua["vector"] = obe::transform::UnitVector(1, 2);
+    // The loader of obe.transform fails when it binds its first class
+    lua.safe_script(R"(
+        rawset(obe, 'transform', setmetatable({}, {
+            __newindex = function() error("broken namespace") end
+        }));
+    )");
+
+    for (int attempt = 0; attempt < 2; attempt++)
+    {
+        const sol::protected_function_result result
+            = lua.safe_script("return vector.x", sol::script_pass_on_error);
+        REQUIRE_FALSE(result.valid());
+        REQUIRE(result.get<sol::error>().what() != std::string());
+    }
+
+    lua.safe_script("rawset(obe, 'transform', nil)");
+    REQUIRE(lua.safe_script("return vector.x").get<double>() == 1);
+    REQUIRE(lua.safe_script("return type(obe.transform.UnitVector)").get<std::string>()
+        == "table");
+}
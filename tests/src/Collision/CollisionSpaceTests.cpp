@@ -0,0 +1,149 @@
+#include <catch_amalgamated.hpp>
+
+#include <Collision/CircleCollider.hpp>
+#include <Collision/CollisionSpace.hpp>
+
+using namespace obe::collision;
+using namespace obe::transform;
+
+TEST_CASE("Colliders moved after insertion are still found", "[obe.Collision.CollisionSpace]")
+{
+    CollisionSpace space;
+    std::vector<std::unique_ptr<CircleCollider>> colliders;
+    // Enough colliders to force the Quadtree to split
+    for (int i = 0; i < 64; i++)
+    {
+        auto& collider = colliders.emplace_back(std::make_unique<CircleCollider>());
+        collider->set_radius(0.1f);
+        collider->set_position(UnitVector(i * 10, i * 10));
+        space.add_collider(collider.get());
+    }
+
+    CircleCollider probe;
+    probe.set_radius(0.1f);
+    probe.set_position(UnitVector(-5000, -5000));
+    REQUIRE_FALSE(space.collides(probe));
+
+    SECTION("Moving a collider across the space")
+    {
+        colliders[0]->set_position(UnitVector(-5000, -5000));
+        REQUIRE(space.collides(probe));
+        colliders[0]->move(UnitVector(10000, 10000));
+        REQUIRE_FALSE(space.collides(probe));
+    }
+    SECTION("Removing a collider that moved since its insertion")
+    {
+        colliders[1]->set_position(UnitVector(-5000, -5000));
+        space.remove_collider(colliders[1].get());
+        REQUIRE_FALSE(space.collides(probe));
+        REQUIRE(space.get_collider_amount() == 63);
+    }
+    SECTION("Destroying a collider removes it from its CollisionSpace")
+    {
+        colliders[2]->set_position(UnitVector(-5000, -5000));
+        colliders.erase(colliders.begin() + 2);
+        REQUIRE_FALSE(space.collides(probe));
+        REQUIRE(space.get_collider_amount() == 63);
+    }
+}
+
+TEST_CASE("Colliding pairs are computed in a single pass", "[obe.Collision.CollisionSpace]")
+{
+    CollisionSpace space;
+    CircleCollider first;
+    CircleCollider second;
+    CircleCollider third;
+    for (CircleCollider* collider : { &first, &second, &third })
+    {
+        collider->set_radius(1.f);
+        space.add_collider(collider);
+    }
+    first.set_position(UnitVector(0, 0));
+    second.set_position(UnitVector(1, 0));
+    third.set_position(UnitVector(100, 0));
+
+    SECTION("Overlapping colliders are reported once")
+    {
+        space.step();
+        REQUIRE(space.get_collisions().size() == 1);
+        const auto [collider1, collider2] = space.get_collisions().front();
+        REQUIRE(((collider1 == &first && collider2 == &second)
+            || (collider1 == &second && collider2 == &first)));
+    }
+    SECTION("Blacklisted tags are ignored")
+    {
+        first.set_tag("player");
+        second.set_tag("bullet");
+        space.add_tag_to_blacklist("bullet", "player");
+        REQUIRE(space.find_collisions().empty());
+        REQUIRE_FALSE(space.collides(first));
+        space.remove_tag_to_blacklist("bullet", "player");
+        REQUIRE(space.find_collisions().size() == 1);
+    }
+    SECTION("Removed colliders are dropped from the last results")
+    {
+        space.step();
+        space.remove_collider(&second);
+        REQUIRE(space.get_collisions().empty());
+    }
+}
+TEST_CASE("Parallel narrow phase gives the same results as the serial one",
+    "[obe.Collision.CollisionSpace]")
+{
+    CollisionSpace space;
+    std::vector<std::unique_ptr<CircleCollider>> colliders;
+    for (int i = 0; i < 200; i++)
+    {
+        auto& collider = colliders.emplace_back(std::make_unique<CircleCollider>());
+        collider->set_radius(0.05f);
+        collider->set_position(UnitVector((i % 20) * 0.06, (i / 20) * 0.06));
+        space.add_collider(collider.get());
+    }
+    CircleCollider mover;
+    mover.set_radius(0.3f);
+    mover.set_position(UnitVector(-1, 0.3));
+
+    const std::vector<CollisionPair> serial_collisions = space.find_collisions();
+    const std::vector<ReachableCollider> serial_reachable
+        = space.get_reachable_colliders(mover, UnitVector(3, 0));
+
+    obe::system::JobPool pool(3);
+    space.set_job_pool(&pool);
+    REQUIRE(space.find_collisions() == serial_collisions);
+    REQUIRE(space.get_reachable_colliders(mover, UnitVector(3, 0)) == serial_reachable);
+    REQUIRE_FALSE(serial_collisions.empty());
+}
+
+TEST_CASE("Sweeping returns every hit sorted by time of impact", "[obe.Collision.CollisionSpace]")
+{
+    CollisionSpace space;
+    CircleCollider far_wall;
+    CircleCollider near_wall;
+    CircleCollider out_of_path;
+    far_wall.set_position(UnitVector(8, 0));
+    near_wall.set_position(UnitVector(4, 0));
+    out_of_path.set_position(UnitVector(4, 5));
+    for (CircleCollider* collider : { &far_wall, &near_wall, &out_of_path })
+    {
+        collider->set_radius(0.5f);
+        space.add_collider(collider);
+    }
+
+    CircleCollider bullet;
+    bullet.set_radius(0.5f);
+    // Much faster than the size of the walls, a discrete check would miss both
+    const std::vector<SweepHit> hits = space.sweep(bullet, UnitVector(20, 0));
+    REQUIRE(hits.size() == 2);
+    REQUIRE(hits[0].collider == &near_wall);
+    REQUIRE(hits[1].collider == &far_wall);
+    REQUIRE(hits[0].toi == Catch::Approx(0.15).margin(0.01));
+    REQUIRE(hits[0].offset.x == Catch::Approx(3).margin(0.1));
+    REQUIRE(hits[0].normal.x == Catch::Approx(1).margin(0.01));
+
+    SECTION("Colliders moving apart do not block each other")
+    {
+        bullet.set_position(UnitVector(3.5, 0));
+        const std::vector<SweepHit> escape = space.sweep(bullet, UnitVector(-5, 0));
+        REQUIRE(escape.empty());
+    }
+}
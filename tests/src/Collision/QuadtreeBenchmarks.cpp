@@ -0,0 +1,311 @@
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <unordered_map>
+
+#include <catch_amalgamated.hpp>
+
+#include <Collision/CircleCollider.hpp>
+#include <Collision/Quadtree.hpp>
+
+using namespace obe::collision;
+using namespace obe::transform;
+
+namespace
+{
+    /**
+     * \brief Pointer based Quadtree the flat Quadtree replaced, kept as a reference
+     *        for the benchmarks (one heap allocated node and std::vector per node,
+     *        bounding boxes fetched from the Colliders on every access)
+     */
+    class LegacyQuadtree
+    {
+    private:
+        static constexpr auto Threshold = std::size_t(16);
+        static constexpr auto MaxDepth = std::size_t(8);
+
+        struct Node
+        {
+            std::array<std::unique_ptr<Node>, 4> children;
+            std::vector<const Collider*> values;
+            Node* parent = nullptr;
+            AABB box;
+        };
+
+        AABB m_box;
+        std::unique_ptr<Node> m_root;
+        std::unordered_map<const Collider*, Node*> m_locations;
+
+        static bool is_leaf(const Node* node)
+        {
+            return !static_cast<bool>(node->children[0]);
+        }
+
+        static AABB compute_box(const AABB& box, int i)
+        {
+            const UnitVector origin = box.get_position();
+            const UnitVector child_size = box.get_size() / 2.0;
+            const UnitVector offsets[4] = { UnitVector(0, 0), UnitVector(child_size.x, 0),
+                UnitVector(0, child_size.y), child_size };
+            return AABB(origin + offsets[i], child_size);
+        }
+
+        static int get_quadrant(const AABB& node_box, const AABB& value_box)
+        {
+            const UnitVector center = node_box.get_position(Referential::Center);
+            const bool north = value_box.get_position(Referential::Bottom).y < center.y;
+            const bool south = value_box.get_position(Referential::Top).y >= center.y;
+            if (value_box.get_position(Referential::Right).x < center.x)
+                return north ? 0 : (south ? 2 : -1);
+            if (value_box.get_position(Referential::Left).x >= center.x)
+                return north ? 1 : (south ? 3 : -1);
+            return -1;
+        }
+
+        void add_internal(Node* node, std::size_t depth, const Collider* value)
+        {
+            if (is_leaf(node))
+            {
+                if (depth >= MaxDepth || node->values.size() < Threshold)
+                {
+                    node->values.push_back(value);
+                    m_locations[value] = node;
+                    return;
+                }
+                split(node);
+            }
+            const int i = get_quadrant(node->box, value->get_bounding_box());
+            if (i != -1)
+                add_internal(node->children[i].get(), depth + 1, value);
+            else
+            {
+                node->values.push_back(value);
+                m_locations[value] = node;
+            }
+        }
+
+        void split(Node* node)
+        {
+            for (int i = 0; i < 4; ++i)
+            {
+                node->children[i] = std::make_unique<Node>();
+                node->children[i]->parent = node;
+                node->children[i]->box = compute_box(node->box, i);
+            }
+            std::vector<const Collider*> new_values;
+            for (const Collider* value : node->values)
+            {
+                const int i = get_quadrant(node->box, value->get_bounding_box());
+                if (i != -1)
+                {
+                    node->children[i]->values.push_back(value);
+                    m_locations[value] = node->children[i].get();
+                }
+                else
+                    new_values.push_back(value);
+            }
+            node->values = std::move(new_values);
+        }
+
+        bool try_merge(Node* node)
+        {
+            std::size_t values_amount = node->values.size();
+            for (const auto& child : node->children)
+            {
+                if (!is_leaf(child.get()))
+                    return false;
+                values_amount += child->values.size();
+            }
+            if (values_amount > Threshold)
+                return false;
+            for (auto& child : node->children)
+            {
+                for (const Collider* value : child->values)
+                {
+                    node->values.push_back(value);
+                    m_locations[value] = node;
+                }
+                child.reset();
+            }
+            return true;
+        }
+
+        void query_internal(
+            const Node* node, const AABB& query_box, std::vector<const Collider*>& values) const
+        {
+            for (const Collider* value : node->values)
+            {
+                if (query_box.intersects(value->get_bounding_box()))
+                    values.push_back(value);
+            }
+            if (!is_leaf(node))
+            {
+                for (const auto& child : node->children)
+                {
+                    if (query_box.intersects(child->box))
+                        query_internal(child.get(), query_box, values);
+                }
+            }
+        }
+
+    public:
+        explicit LegacyQuadtree(const AABB& box)
+            : m_box(box)
+        {
+            this->clear();
+        }
+
+        void clear()
+        {
+            m_root = std::make_unique<Node>();
+            m_root->box = m_box;
+            m_locations.clear();
+        }
+
+        void add(const Collider* value)
+        {
+            add_internal(m_root.get(), 0, value);
+        }
+
+        void remove(const Collider* value)
+        {
+            const auto location = m_locations.find(value);
+            if (location == m_locations.end())
+                return;
+            Node* node = location->second;
+            m_locations.erase(location);
+            std::erase(node->values, value);
+            for (Node* parent = node->parent; parent != nullptr; parent = parent->parent)
+            {
+                if (!try_merge(parent))
+                    break;
+            }
+        }
+
+        std::vector<const Collider*> query(const AABB& box) const
+        {
+            std::vector<const Collider*> values;
+            query_internal(m_root.get(), box, values);
+            return values;
+        }
+    };
+
+    const AABB BenchmarkArea(UnitVector(0, 0), UnitVector(64, 64));
+
+    std::vector<std::unique_ptr<CircleCollider>> make_colliders(std::size_t amount)
+    {
+        std::vector<std::unique_ptr<CircleCollider>> colliders;
+        colliders.reserve(amount);
+        for (std::size_t i = 0; i < amount; i++)
+        {
+            auto& collider = colliders.emplace_back(std::make_unique<CircleCollider>());
+            collider->set_radius(0.05f);
+            // Deterministic spread over the whole area
+            const double x = static_cast<double>((i * 7919) % 6337) / 100.0;
+            const double y = static_cast<double>((i * 104729) % 6271) / 100.0;
+            collider->set_position(UnitVector(x + 0.1, y + 0.1));
+        }
+        return colliders;
+    }
+
+    std::vector<AABB> make_queries(std::size_t amount)
+    {
+        std::vector<AABB> queries;
+        queries.reserve(amount);
+        for (std::size_t i = 0; i < amount; i++)
+        {
+            const double x = static_cast<double>((i * 331) % 6000) / 100.0;
+            const double y = static_cast<double>((i * 733) % 6000) / 100.0;
+            queries.emplace_back(UnitVector(x, y), UnitVector(2, 2));
+        }
+        return queries;
+    }
+
+    template <class Tree>
+    std::size_t run_queries(const Tree& tree, const std::vector<AABB>& queries)
+    {
+        std::size_t results = 0;
+        for (const AABB& query : queries)
+            results += tree.query(query).size();
+        return results;
+    }
+}
+
+TEST_CASE("Flat Quadtree finds the same values as the pointer based one", "[obe.Collision.Quadtree]")
+{
+    const auto colliders = make_colliders(2000);
+    Quadtree flat(BenchmarkArea, 4, 10);
+    LegacyQuadtree legacy(BenchmarkArea);
+    for (std::size_t i = 0; i < colliders.size(); i++)
+    {
+        flat.add(colliders[i].get());
+        legacy.add(colliders[i].get());
+    }
+    for (std::size_t i = 0; i < colliders.size(); i += 3)
+    {
+        flat.remove(colliders[i].get());
+        legacy.remove(colliders[i].get());
+    }
+    for (const AABB& query_box : make_queries(200))
+    {
+        std::vector<const Collider*> flat_results = flat.query(query_box);
+        std::vector<const Collider*> legacy_results = legacy.query(query_box);
+        std::sort(flat_results.begin(), flat_results.end());
+        std::sort(legacy_results.begin(), legacy_results.end());
+        REQUIRE(flat_results == legacy_results);
+    }
+}
+
+TEST_CASE("Quadtree throughput", "[.][benchmark][obe.Collision.Quadtree]")
+{
+    const auto colliders = make_colliders(10000);
+    const auto queries = make_queries(1000);
+
+    BENCHMARK("Legacy insert + remove")
+    {
+        LegacyQuadtree tree(BenchmarkArea);
+        for (const auto& collider : colliders)
+            tree.add(collider.get());
+        for (const auto& collider : colliders)
+            tree.remove(collider.get());
+        return tree.query(BenchmarkArea).size();
+    };
+    BENCHMARK("Flat insert + remove")
+    {
+        Quadtree tree(BenchmarkArea);
+        for (const auto& collider : colliders)
+            tree.add(collider.get());
+        for (const auto& collider : colliders)
+            tree.remove(collider.get());
+        return tree.query(BenchmarkArea).size();
+    };
+
+    LegacyQuadtree legacy(BenchmarkArea);
+    Quadtree flat(BenchmarkArea);
+    for (const auto& collider : colliders)
+    {
+        legacy.add(collider.get());
+        flat.add(collider.get());
+    }
+    BENCHMARK("Legacy query")
+    {
+        return run_queries(legacy, queries);
+    };
+    BENCHMARK("Flat query")
+    {
+        return run_queries(flat, queries);
+    };
+
+    BENCHMARK("Legacy clear + rebuild")
+    {
+        legacy.clear();
+        for (const auto& collider : colliders)
+            legacy.add(collider.get());
+    };
+    BENCHMARK("Flat clear + rebuild")
+    {
+        flat.clear();
+        for (const auto& collider : colliders)
+            flat.add(collider.get());
+    };
+}
@@ -0,0 +1,79 @@
+#include <filesystem>
+#include <fstream>
+
+#include <catch_amalgamated.hpp>
+
+#include <Config/CompiledVili.hpp>
+#include <Debug/Logger.hpp>
+
+#include <TestUtils.hpp>
+
+using namespace obe::config;
+
+namespace
+{
+    void write_file(const std::filesystem::path& path, const std::string& content)
+    {
+        std::ofstream(path, std::ios::binary) << content;
+    }
+
+    std::string read_file(const std::filesystem::path& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+}
+
+TEST_CASE("Compiled vili files are named after their source", "[obe.Config.CompiledVili]")
+{
+    REQUIRE(get_compiled_vili_path("Data/Scenes/level.vili") == "Data/Scenes/level.vilic");
+    REQUIRE(get_compiled_vili_path("Data/Scenes/level") == "Data/Scenes/level.vilic");
+}
+
+TEST_CASE("Vili files are loaded from their compiled version", "[obe.Config.CompiledVili]")
+{
+    obe::tests::ensure_logger();
+    const obe::tests::TemporaryDirectory root;
+    const std::string vili_path = (root / "scene.vili").string();
+    write_file(vili_path,
+        "name: \"Scene\"\n"
+        "tags: [\"solid\", \"\", \"water\"]\n"
+        "sizes: [1, -200, 70000, 0.1]\n"
+        "nested:\n"
+        "    a: 1\n    b: 2\n    c: 3\n    d: 4\n    e: 5\n    f: 6\n    g: 7\n    h: 8\n"
+        "    i: 9\n    j: 10\n    k: 11\n    l: 12\n    m: 13\n    n: 14\n    o: 15\n    p: 16\n"
+        "visible: true\n");
+    const vili::node parsed = load_vili_file(vili_path);
+
+    REQUIRE(compile_vili_file(vili_path));
+    REQUIRE(std::filesystem::exists(get_compiled_vili_path(vili_path)));
+
+    SECTION("The compiled version holds the same document")
+    {
+        REQUIRE(load_vili_file(vili_path) == parsed);
+        // The content of the compiled file is used as is when the source did not change
+        const std::string compiled_path = get_compiled_vili_path(vili_path);
+        const std::string compiled = read_file(compiled_path);
+        // "visible" is the last value of the document, true is encoded as 0xc3
+        REQUIRE(compiled.back() == '\xc3');
+        write_file(compiled_path, compiled.substr(0, compiled.size() - 1) + '\xc2');
+        REQUIRE(load_vili_file(vili_path).at("visible").as_boolean() == false);
+    }
+    SECTION("Modified files are parsed again")
+    {
+        write_file(vili_path, "name: \"Modified\"\n");
+        REQUIRE(load_vili_file(vili_path).at("name").as<vili::string>() == "Modified");
+    }
+    SECTION("Invalid compiled files are ignored")
+    {
+        const std::string compiled_path = get_compiled_vili_path(vili_path);
+        const std::string compiled = read_file(compiled_path);
+        write_file(compiled_path, compiled.substr(0, compiled.size() / 2));
+        REQUIRE(load_vili_file(vili_path) == parsed);
+    }
+    SECTION("Missing files can't be loaded")
+    {
+        REQUIRE_THROWS_AS(load_vili_file((root / "missing.vili").string()),
+            vili::exceptions::file_not_found);
+    }
+}
@@ -0,0 +1,87 @@
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <catch_amalgamated.hpp>
+
+#include <vili-msgpack/msgpack.hpp>
+
+namespace
+{
+    vili::node round_trip(const vili::node& node)
+    {
+        return vili::msgpack::from_string(vili::msgpack::to_string(node));
+    }
+
+    vili::node make_object(std::size_t size)
+    {
+        vili::node object = vili::object {};
+        for (std::size_t i = 0; i < size; i++)
+        {
+            object.emplace("key_" + std::to_string(i), vili::integer(i));
+        }
+        return object;
+    }
+}
+
+TEST_CASE("Objects of any size are round tripped", "[vili.msgpack]")
+{
+    // fixmap, map16 and map32 headers
+    for (const std::size_t size : { 15, 16, 300, 70000 })
+    {
+        const vili::node object = make_object(size);
+        const std::string encoded = vili::msgpack::to_string(object);
+        if (size >= 16)
+        {
+            REQUIRE(static_cast<unsigned char>(encoded[0]) == (size < 65535 ? 0xde : 0xdf));
+        }
+        REQUIRE(vili::msgpack::from_string(encoded) == object);
+    }
+}
+
+TEST_CASE("Strings inside arrays stay array elements", "[vili.msgpack]")
+{
+    const vili::node node = vili::object { { "tags", vili::array { "solid", "", "water" } },
+        { "nested", vili::array { vili::array { "a", 1 }, vili::object { { "b", "c" } } } } };
+    const vili::node decoded = round_trip(node);
+    REQUIRE(decoded == node);
+    REQUIRE(decoded.at("tags").size() == 3);
+    REQUIRE(decoded.at("tags").at(1).as<vili::string>().empty());
+}
+
+TEST_CASE("Numbers keep their precision", "[vili.msgpack]")
+{
+    for (const double number : { 0.5, 0.1, 1.0 / 3.0, -123456.789, 1e300 })
+    {
+        REQUIRE(round_trip(number).as<vili::number>() == number);
+    }
+    // Numbers stored without loss in single precision use float32
+    REQUIRE(vili::msgpack::to_string(0.5).size() == 5);
+    REQUIRE(vili::msgpack::to_string(0.1).size() == 9);
+}
+
+TEST_CASE("Integers of every width are round tripped", "[vili.msgpack]")
+{
+    const std::vector<vili::integer> integers = { 0, 1, 127, 128, 255, 256, 65535, 65536,
+        4294967296, -1, -32, -33, -128, -129, -32768, -32769, -2147483648, -2147483649,
+        std::numeric_limits<vili::integer>::max(), std::numeric_limits<vili::integer>::min() };
+    for (const vili::integer integer : integers)
+    {
+        INFO(integer);
+        REQUIRE(round_trip(integer).as<vili::integer>() == integer);
+    }
+}
+
+TEST_CASE("Truncated data is rejected", "[vili.msgpack]")
+{
+    const std::string encoded = vili::msgpack::to_string(vili::object {
+        { "name", "Scene" }, { "sizes", vili::array { 1, -200, 70000, 0.1 } } });
+    for (std::size_t size = 0; size < encoded.size(); size++)
+    {
+        INFO(size);
+        REQUIRE_THROWS(vili::msgpack::from_string(encoded.substr(0, size)));
+    }
+    // String and container lengths larger than the remaining data
+    REQUIRE_THROWS(vili::msgpack::from_string("\xdb\xff\xff\xff\xff"));
+    REQUIRE_THROWS(vili::msgpack::from_string("\xdd\xff\xff\xff\xff"));
+}
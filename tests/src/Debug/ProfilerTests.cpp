@@ -0,0 +1,83 @@
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include <catch_amalgamated.hpp>
+
+#include <Debug/Profiler.hpp>
+
+#include <TestUtils.hpp>
+
+using namespace obe::debug;
+
+TEST_CASE("Scopes are recorded per frame with their depth", "[obe.Debug.Profiler]")
+{
+    Profiler profiler;
+    profiler.begin_scope("Ignored");
+    profiler.end_scope();
+    profiler.set_enabled(true);
+
+    profiler.begin_scope("Update");
+    profiler.begin_scope("GameObject", "player");
+    profiler.end_scope();
+    profiler.begin_scope("GameObject", "enemy");
+    profiler.end_scope();
+    profiler.end_scope();
+    // Left open on purpose, closed when the frame ends
+    profiler.begin_scope("Render");
+    REQUIRE(profiler.get_last_frame_samples().empty());
+    profiler.next_frame();
+
+    const std::vector<ProfilerSample>& samples = profiler.get_last_frame_samples();
+    REQUIRE(samples.size() == 4);
+    REQUIRE(samples[0].name == "Update");
+    REQUIRE(samples[0].depth == 0);
+    REQUIRE(samples[1].detail == "player");
+    REQUIRE(samples[1].depth == 1);
+    REQUIRE(samples[2].detail == "enemy");
+    REQUIRE(samples[2].start >= samples[1].start + samples[1].duration);
+    REQUIRE(samples[3].name == "Render");
+    REQUIRE(samples[0].duration >= samples[1].duration + samples[2].duration);
+
+    const auto timings = profiler.get_last_frame_timings();
+    REQUIRE(timings.size() == 3);
+    REQUIRE(timings.at("GameObject") == samples[1].duration + samples[2].duration);
+
+    profiler.next_frame();
+    REQUIRE(profiler.get_last_frame_samples().empty());
+}
+
+TEST_CASE("Captured frames are exported as a Chrome trace", "[obe.Debug.Profiler]")
+{
+    Profiler profiler;
+    profiler.set_enabled(true);
+    profiler.start_capture(2);
+    for (int frame = 0; frame < 2; frame++)
+    {
+        profiler.begin_scope("Frame \"scope\"", "detail");
+        profiler.end_scope();
+        profiler.begin_scope("Dropped");
+        profiler.end_scope();
+        profiler.next_frame();
+    }
+    REQUIRE_FALSE(profiler.is_capturing());
+
+    const obe::tests::TemporaryDirectory directory;
+    const std::string path = (directory / "trace.json").string();
+    REQUIRE(profiler.save_chrome_trace(path));
+    std::stringstream trace;
+    trace << std::ifstream(path).rdbuf();
+
+    REQUIRE(trace.str().starts_with("{\"traceEvents\":["));
+    REQUIRE(trace.str().find("\"name\":\"Frame \\\"scope\\\"\"") != std::string::npos);
+    REQUIRE(trace.str().find("\"args\":{\"detail\":\"detail\"}") != std::string::npos);
+    // The capture stops after two samples, the second frame is not kept
+    const std::string events = trace.str();
+    std::size_t events_amount = 0;
+    for (std::size_t position = events.find("\"ph\":\"X\""); position != std::string::npos;
+         position = events.find("\"ph\":\"X\"", position + 1))
+    {
+        events_amount++;
+    }
+    REQUIRE(events_amount == 2);
+}
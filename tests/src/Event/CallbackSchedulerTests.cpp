@@ -0,0 +1,78 @@
+#include <vector>
+
+#include <catch_amalgamated.hpp>
+
+#include <Event/EventManager.hpp>
+
+#include <TestUtils.hpp>
+
+using namespace obe::event;
+
+namespace
+{
+    /**
+     * \brief Updates the EventManager `updates` times with `dt` and returns the
+     *        numbers of the updates which called the callback
+     */
+    std::vector<int> run_updates(
+        EventManager& manager, const int& calls, obe::time::TimeUnit dt, int updates)
+    {
+        std::vector<int> called_at;
+        for (int update = 1; update <= updates; update++)
+        {
+            const int calls_before = calls;
+            manager.update(dt);
+            if (calls != calls_before)
+            {
+                called_at.push_back(update);
+            }
+        }
+        return called_at;
+    }
+}
+
+TEST_CASE("Delayed callbacks are called once their delay elapsed", "[obe.Event.CallbackScheduler]")
+{
+    obe::tests::ensure_logger();
+    EventManager manager;
+    int calls = 0;
+    manager.schedule().after(1).run([&calls]() { calls++; });
+
+    REQUIRE(run_updates(manager, calls, 0.25, 8) == std::vector { 4 });
+    REQUIRE(calls == 1);
+
+    SECTION("Callbacks are not called without delta time")
+    {
+        manager.schedule().after(0.5).run([&calls]() { calls++; });
+        REQUIRE(run_updates(manager, calls, 0, 10).empty());
+        REQUIRE(run_updates(manager, calls, 0.5, 1) == std::vector { 1 });
+    }
+}
+
+TEST_CASE("Repeated callbacks are called at a fixed rate", "[obe.Event.CallbackScheduler]")
+{
+    obe::tests::ensure_logger();
+    EventManager manager;
+    int calls = 0;
+    CallbackScheduler& scheduler = manager.schedule().every(0.5);
+    scheduler.run([&calls]() { calls++; });
+
+    const std::vector expected = { 2, 4, 6, 8 };
+    REQUIRE(run_updates(manager, calls, 0.25, 8) == expected);
+
+    SECTION("The same time split in smaller steps gives the same calls")
+    {
+        EventManager split_manager;
+        int split_calls = 0;
+        split_manager.schedule().every(0.5).run([&split_calls]() { split_calls++; });
+        REQUIRE(run_updates(split_manager, split_calls, 0.125, 16)
+            == std::vector { 4, 8, 12, 16 });
+        REQUIRE(split_calls == calls);
+    }
+    SECTION("Stopped callbacks are not called anymore")
+    {
+        scheduler.stop();
+        REQUIRE(run_updates(manager, calls, 0.25, 8).empty());
+        REQUIRE(calls == 4);
+    }
+}
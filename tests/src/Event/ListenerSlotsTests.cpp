@@ -0,0 +1,82 @@
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <catch_amalgamated.hpp>
+
+#include <Event/ListenerSlots.hpp>
+
+using namespace obe::event;
+
+using Listener = std::function<void(std::vector<std::string>&)>;
+
+TEST_CASE("Listeners are called in slot order and reuse removed slots",
+    "[obe.Event.ListenerSlots]")
+{
+    ListenerSlots<Listener> slots;
+    const auto push = [](const std::string& value)
+    { return [value](std::vector<std::string>& calls) { calls.push_back(value); }; };
+
+    const ListenerHandle a = slots.add("a", push("a"));
+    const ListenerHandle b = slots.add("b", push("b"));
+    slots.add("c", push("c"));
+    REQUIRE(slots.add("a", push("other")) == a);
+    REQUIRE(slots.size() == 3);
+
+    std::vector<std::string> calls;
+    slots.for_each([&calls](const std::string&, const Listener& listener) { listener(calls); });
+    REQUIRE(calls == std::vector<std::string> { "a", "b", "c" });
+
+    REQUIRE(slots.remove(b));
+    REQUIRE_FALSE(slots.remove(b));
+    REQUIRE_FALSE(slots.remove("b"));
+    const ListenerHandle d = slots.add("d", push("d"));
+    REQUIRE(d.index == b.index);
+    REQUIRE(slots.get_id(d) == "d");
+
+    calls.clear();
+    slots.for_each([&calls](const std::string&, const Listener& listener) { listener(calls); });
+    REQUIRE(calls == std::vector<std::string> { "a", "d", "c" });
+}
+
+TEST_CASE("Changes made while iterating are applied after the iteration",
+    "[obe.Event.ListenerSlots]")
+{
+    ListenerSlots<Listener> slots;
+    std::vector<std::string> calls;
+    slots.add("first", [&slots](std::vector<std::string>& calls)
+        {
+            calls.push_back("first");
+            slots.remove("first");
+            slots.remove("second");
+            slots.add("third", [](std::vector<std::string>& calls) { calls.push_back("third"); });
+        });
+    slots.add("second", [](std::vector<std::string>& calls) { calls.push_back("second"); });
+
+    slots.for_each([&calls](const std::string&, const Listener& listener) { listener(calls); });
+    REQUIRE(calls == std::vector<std::string> { "first" });
+    REQUIRE(slots.size() == 1);
+    REQUIRE(slots.contains("third"));
+
+    calls.clear();
+    slots.for_each([&calls](const std::string&, const Listener& listener) { listener(calls); });
+    REQUIRE(calls == std::vector<std::string> { "third" });
+}
+
+TEST_CASE("Stale handles don't refer to the listener reusing their slot",
+    "[obe.Event.ListenerSlots]")
+{
+    ListenerSlots<Listener> slots;
+    const ListenerHandle first = slots.add("first", [](std::vector<std::string>&) {});
+    REQUIRE(slots.remove(first));
+    const ListenerHandle second = slots.add("second", [](std::vector<std::string>&) {});
+    REQUIRE(second.index == first.index);
+    REQUIRE_FALSE(second == first);
+
+    REQUIRE_FALSE(slots.get_id(first).has_value());
+    REQUIRE_FALSE(slots.remove(first));
+    REQUIRE(slots.contains("second"));
+    REQUIRE(slots.get_id(second) == "second");
+    REQUIRE(slots.remove(second));
+    REQUIRE(slots.size() == 0);
+}
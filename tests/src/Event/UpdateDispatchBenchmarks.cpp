@@ -0,0 +1,112 @@
+#include <string>
+
+#include <catch_amalgamated.hpp>
+
+#include <Event/EventGroup.hpp>
+
+#include <TestUtils.hpp>
+
+using namespace obe::event;
+
+namespace
+{
+    struct Update
+    {
+        static constexpr std::string_view id = "Update";
+        double dt;
+    };
+
+    const std::string UpdateDispatcherPath
+        = OBE_ENGINE_DIRECTORY "/Lib/Internal/UpdateDispatcher.lua";
+
+    sol::table load_update_dispatcher(sol::state& lua)
+    {
+        // EventGroup logs the Events it creates
+        obe::tests::ensure_logger();
+        lua.open_libraries(sol::lib::base, sol::lib::string, sol::lib::table);
+        lua.new_usertype<Update>("Update", "dt", &Update::dt);
+        // Stands for the environment of a scripted GameObject
+        lua.safe_script(R"(
+            function make_update_callback(calls)
+                local object = { elapsed = 0 };
+                return function(event)
+                    object.elapsed = object.elapsed + event.dt;
+                    calls[#calls + 1] = object;
+                end
+            end
+        )");
+        return lua.safe_script_file(UpdateDispatcherPath);
+    }
+
+    sol::protected_function make_update_callback(sol::state& lua, sol::table calls)
+    {
+        return lua["make_update_callback"](calls);
+    }
+}
+
+TEST_CASE("Update callbacks are called by a single listener", "[obe.Event.UpdateDispatcher]")
+{
+    sol::state lua;
+    sol::table dispatcher = load_update_dispatcher(lua);
+    sol::table calls = lua.create_table();
+    EventGroup group("Event", "Game");
+    group.add<Update>();
+    group.get("Update").add_external_listener("UpdateDispatcher",
+        LuaEventListener(dispatcher["dispatch"].get<sol::protected_function>()));
+
+    for (const std::string listener_id : { "a", "b", "c" })
+    {
+        dispatcher["add"](listener_id, make_update_callback(lua, calls));
+    }
+    group.trigger(Update { 0.5 });
+    REQUIRE(calls.size() == 3);
+    REQUIRE(calls.get<sol::table>(1).get<double>("elapsed") == 0.5);
+
+    dispatcher["remove"]("b");
+    group.trigger(Update { 0.5 });
+    REQUIRE(calls.size() == 5);
+    REQUIRE(calls.get<sol::table>(5).get<double>("elapsed") == 1.0);
+    REQUIRE(dispatcher["count"]().get<int>() == 2);
+
+    // Errors still stop the frame, like a failing listener does
+    dispatcher["add"](
+        "d", lua.safe_script("return function() error('failure') end").get<sol::function>());
+    REQUIRE_THROWS(group.trigger(Update { 0.5 }));
+}
+
+TEST_CASE("Update dispatch throughput", "[.][benchmark][obe.Event.UpdateDispatcher]")
+{
+    for (const std::size_t objects_amount : { 1000, 5000, 10000 })
+    {
+        sol::state lua;
+        sol::table dispatcher = load_update_dispatcher(lua);
+        sol::table calls = lua.create_table();
+        EventGroup listeners_group("Event", "Game");
+        listeners_group.add<Update>();
+        EventGroup batched_group("Event", "Game");
+        batched_group.add<Update>();
+        batched_group.get("Update").add_external_listener("UpdateDispatcher",
+            LuaEventListener(dispatcher["dispatch"].get<sol::protected_function>()));
+        for (std::size_t i = 0; i < objects_amount; i++)
+        {
+            const std::string listener_id = "object" + std::to_string(i);
+            listeners_group.get("Update").add_external_listener(
+                listener_id, LuaEventListener(make_update_callback(lua, calls)));
+            dispatcher["add"](listener_id, make_update_callback(lua, calls));
+        }
+        const std::string objects = std::to_string(objects_amount);
+
+        BENCHMARK("One listener per object (" + objects + " objects)")
+        {
+            calls.clear();
+            listeners_group.trigger(Update { 0.016 });
+            return calls.size();
+        };
+        BENCHMARK("Batched dispatch (" + objects + " objects)")
+        {
+            calls.clear();
+            batched_group.trigger(Update { 0.016 });
+            return calls.size();
+        };
+    }
+}
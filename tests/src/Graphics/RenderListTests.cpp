@@ -0,0 +1,140 @@
+#include <vector>
+
+#include <catch_amalgamated.hpp>
+
+#include <Graphics/RenderList.hpp>
+
+using namespace obe::graphics;
+
+namespace
+{
+    class TestRenderable : public Renderable
+    {
+    public:
+        using Renderable::Renderable;
+        void draw(RenderTarget&, const obe::scene::Camera&) override
+        {
+        }
+        // Some Renderables change their layers without notifying their RenderList
+        void set_layer_silently(int32_t layer)
+        {
+            m_layer = layer;
+        }
+    };
+
+    std::vector<Renderable*> sorted(std::initializer_list<Renderable*> renderables)
+    {
+        return renderables;
+    }
+}
+
+TEST_CASE("Renderables are inserted by layer then sublayer", "[obe.Graphics.RenderList]")
+{
+    TestRenderable back(2, 1);
+    TestRenderable middle_back(1, 2);
+    TestRenderable middle(1, 1);
+    TestRenderable middle_again(1, 1);
+    TestRenderable front(0, 5);
+
+    RenderList list;
+    list.add(&middle);
+    list.add(&front);
+    list.add(&back);
+    list.add(&middle_again);
+    list.add(&middle_back);
+    // Renderables with the same layers keep their insertion order
+    REQUIRE(list.get_renderables()
+        == sorted({ &back, &middle_back, &middle, &middle_again, &front }));
+
+    SECTION("Adding a Renderable twice does nothing")
+    {
+        list.add(&middle);
+        REQUIRE(list.size() == 5);
+    }
+    SECTION("Renderables are moved when their layers change")
+    {
+        front.set_layer(3);
+        middle.set_sublayer(0);
+        REQUIRE(list.get_renderables()
+            == sorted({ &front, &back, &middle_back, &middle_again, &middle }));
+    }
+    SECTION("Many moves sort the whole list")
+    {
+        back.set_layer(-1);
+        middle_back.set_layer(-1);
+        front.set_layer(5);
+        REQUIRE(list.get_renderables()
+            == sorted({ &front, &middle, &middle_again, &middle_back, &back }));
+    }
+    SECTION("Renderables are moved from their previous RenderList")
+    {
+        RenderList other;
+        other.add(&middle);
+        REQUIRE(other.get_renderables() == sorted({ &middle }));
+        REQUIRE(list.get_renderables() == sorted({ &back, &middle_back, &middle_again, &front }));
+    }
+}
+
+TEST_CASE("A few moved Renderables are inserted again at their position",
+    "[obe.Graphics.RenderList]")
+{
+    std::vector<TestRenderable> renderables(16, TestRenderable(0, 1));
+    RenderList list;
+    for (TestRenderable& renderable : renderables)
+    {
+        list.add(&renderable);
+    }
+    renderables[3].set_layer(1);
+    renderables[0].set_sublayer(0);
+    std::vector<Renderable*> expected = { &renderables[3] };
+    for (std::size_t i = 1; i < renderables.size(); i++)
+    {
+        if (i != 3)
+        {
+            expected.push_back(&renderables[i]);
+        }
+    }
+    expected.push_back(&renderables[0]);
+    REQUIRE(list.get_renderables() == expected);
+}
+
+TEST_CASE("Renderables are removed from their RenderList", "[obe.Graphics.RenderList]")
+{
+    TestRenderable first(1, 1);
+    TestRenderable second(1, 1);
+    TestRenderable third(0, 1);
+    RenderList list;
+    list.add(&first);
+    list.add(&second);
+    list.add(&third);
+
+    SECTION("Removed Renderables keep the order of the others")
+    {
+        list.remove(&first);
+        REQUIRE(list.get_renderables() == sorted({ &second, &third }));
+        // Removing a Renderable which is not in the list does nothing
+        list.remove(&first);
+        REQUIRE(list.size() == 2);
+    }
+    SECTION("Moved Renderables can be removed before the moves are applied")
+    {
+        first.set_layer(-3);
+        list.remove(&first);
+        REQUIRE(list.get_renderables() == sorted({ &second, &third }));
+    }
+    SECTION("Renderables whose layers changed silently can be removed")
+    {
+        third.set_layer_silently(4);
+        list.remove(&third);
+        REQUIRE(list.get_renderables() == sorted({ &first, &second }));
+    }
+    SECTION("Destroyed Renderables leave their RenderList")
+    {
+        {
+            TestRenderable temporary(1, 1);
+            list.add(&temporary);
+            REQUIRE(list.size() == 4);
+        }
+        REQUIRE(list.get_renderables() == sorted({ &first, &second, &third }));
+    }
+}
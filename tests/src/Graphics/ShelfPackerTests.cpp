@@ -0,0 +1,77 @@
+#include <catch_amalgamated.hpp>
+
+#include <Graphics/ShelfPacker.hpp>
+
+using namespace obe::graphics;
+
+namespace
+{
+    bool is_placed_at(const std::optional<ShelfPacker::Placement>& placement, std::size_t page,
+        unsigned int x, unsigned int y)
+    {
+        return placement && placement->page == page && placement->x == x && placement->y == y;
+    }
+}
+
+TEST_CASE("Rectangles are placed on shelves", "[obe.Graphics.ShelfPacker]")
+{
+    ShelfPacker packer(100);
+    REQUIRE(packer.get_pages_amount() == 0);
+
+    REQUIRE(is_placed_at(packer.allocate(40, 20), 0, 0, 0));
+    REQUIRE(packer.get_pages_amount() == 1);
+    // Rectangles a bit shorter than the shelf reuse it
+    REQUIRE(is_placed_at(packer.allocate(40, 16), 0, 40, 0));
+    // Rectangles much shorter or taller than the shelf open a new one
+    REQUIRE(is_placed_at(packer.allocate(10, 10), 0, 0, 20));
+    REQUIRE(is_placed_at(packer.allocate(10, 30), 0, 0, 30));
+    // The first shelf is full past 100 pixels
+    REQUIRE(is_placed_at(packer.allocate(30, 20), 0, 0, 60));
+    REQUIRE(is_placed_at(packer.allocate(20, 20), 0, 80, 0));
+
+    const std::vector<ShelfPacker::Shelf>& shelves = packer.get_shelves(0);
+    REQUIRE(shelves.size() == 4);
+    REQUIRE(shelves[0].width_used == 100);
+    REQUIRE(shelves[3].y == 60);
+    REQUIRE(shelves[3].height == 20);
+}
+
+TEST_CASE("New pages are added when the pages are full", "[obe.Graphics.ShelfPacker]")
+{
+    ShelfPacker packer(64);
+    REQUIRE(is_placed_at(packer.allocate(64, 40), 0, 0, 0));
+    REQUIRE(is_placed_at(packer.allocate(64, 40), 1, 0, 0));
+    // Smaller rectangles still go to the first page with enough room
+    REQUIRE(is_placed_at(packer.allocate(32, 24), 0, 0, 40));
+    REQUIRE(packer.get_pages_amount() == 2);
+
+    SECTION("Rectangles bigger than a page are rejected")
+    {
+        REQUIRE_FALSE(packer.allocate(65, 1));
+        REQUIRE_FALSE(packer.allocate(1, 65));
+        REQUIRE(packer.get_pages_amount() == 2);
+    }
+    SECTION("Clearing the packer removes every page")
+    {
+        packer.clear();
+        REQUIRE(packer.get_pages_amount() == 0);
+        REQUIRE(is_placed_at(packer.allocate(64, 40), 0, 0, 0));
+    }
+}
+
+TEST_CASE("Pages can be restored from their shelves", "[obe.Graphics.ShelfPacker]")
+{
+    ShelfPacker packer(100);
+    REQUIRE(packer.add_page({ { 0, 20, 100 }, { 20, 50, 30 } }));
+    // The restored shelves are used for the next rectangles
+    REQUIRE(is_placed_at(packer.allocate(20, 40), 0, 30, 20));
+    REQUIRE(is_placed_at(packer.allocate(20, 30), 0, 0, 70));
+
+    SECTION("Invalid shelves are rejected")
+    {
+        REQUIRE_FALSE(packer.add_page({ { 0, 20, 101 } }));
+        REQUIRE_FALSE(packer.add_page({ { 90, 20, 10 } }));
+        REQUIRE_FALSE(packer.add_page({ { 0, 20, 10 }, { 10, 20, 10 } }));
+        REQUIRE(packer.get_pages_amount() == 1);
+    }
+}
@@ -0,0 +1,52 @@
+#include <catch_amalgamated.hpp>
+
+#include <Graphics/PositionTransformers.hpp>
+#include <Graphics/Sprite.hpp>
+#include <Scene/Camera.hpp>
+
+#include <TestUtils.hpp>
+
+using namespace obe;
+
+TEST_CASE("Sprites are in view when they cover a part of the Camera view",
+    "[obe.Graphics.Sprite]")
+{
+    tests::ensure_logger();
+    transform::UnitVector::init(800, 600);
+    graphics::init_position_transformers();
+    scene::Camera camera;
+    camera.set_size(1);
+    camera.set_position(transform::UnitVector(0, 0));
+
+    graphics::Sprite sprite("sprite");
+    sprite.set_position(transform::UnitVector(100, 100, transform::Units::ScenePixels));
+    sprite.set_size(transform::UnitVector(50, 50, transform::Units::ScenePixels));
+    REQUIRE(sprite.is_in_view(camera));
+
+    SECTION("Sprites sticking out of the view are in view")
+    {
+        sprite.set_position(transform::UnitVector(-25, 575, transform::Units::ScenePixels));
+        REQUIRE(sprite.is_in_view(camera));
+    }
+    SECTION("Sprites outside of the view are not")
+    {
+        camera.set_position(transform::UnitVector(1000, 0, transform::Units::ScenePixels));
+        REQUIRE_FALSE(sprite.is_in_view(camera));
+        camera.set_position(transform::UnitVector(0, 200, transform::Units::ScenePixels));
+        REQUIRE_FALSE(sprite.is_in_view(camera));
+    }
+    SECTION("Rotated Sprites use their bounding box")
+    {
+        sprite.set_position(transform::UnitVector(-60, 0, transform::Units::ScenePixels));
+        REQUIRE_FALSE(sprite.is_in_view(camera));
+        // Rotated around its center, the Sprite reaches x = -35 + 25 * sqrt(2) > 0
+        sprite.set_rotation(45);
+        REQUIRE(sprite.is_in_view(camera));
+    }
+    SECTION("Selected Sprites are always in view as their handle can be visible")
+    {
+        camera.set_position(transform::UnitVector(1000, 0, transform::Units::ScenePixels));
+        sprite.select();
+        REQUIRE(sprite.is_in_view(camera));
+    }
+}
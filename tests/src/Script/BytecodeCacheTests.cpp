@@ -0,0 +1,101 @@
+#include <filesystem>
+#include <fstream>
+
+#include <catch_amalgamated.hpp>
+
+#include <Script/BytecodeCache.hpp>
+
+#include <TestUtils.hpp>
+
+using namespace obe::script;
+
+namespace
+{
+    void write_script(const std::filesystem::path& path, const std::string& content)
+    {
+        std::ofstream(path, std::ios::binary) << content;
+    }
+
+    std::size_t count_files(const std::filesystem::path& directory)
+    {
+        return std::distance(std::filesystem::directory_iterator(directory),
+            std::filesystem::directory_iterator());
+    }
+}
+
+TEST_CASE("Bytecode is reused from the cache directory", "[obe.Script.BytecodeCache]")
+{
+    const obe::tests::TemporaryDirectory root;
+    const std::filesystem::path cache_directory = root / "cache";
+    const std::string script_path = (root / "script.lua").string();
+    write_script(script_path, "#!shebang\nreturn 1 + 1");
+
+    sol::state lua;
+    BytecodeCache cache;
+    cache.set_directory(cache_directory.string());
+    {
+        sol::load_result script = cache.load_file(lua, script_path);
+        REQUIRE(script.valid());
+        REQUIRE(script.get<sol::protected_function>()().get<int>() == 2);
+    }
+    REQUIRE(count_files(cache_directory) == 1);
+
+    SECTION("A new cache loads the bytecode written on disk")
+    {
+        // The source is only read to be hashed, the bytecode comes from the cache
+        BytecodeCache other_cache;
+        other_cache.set_directory(cache_directory.string());
+        REQUIRE(other_cache.precompile(lua, script_path));
+        sol::load_result script = other_cache.load_file(lua, script_path);
+        REQUIRE(script.valid());
+        REQUIRE(script.get<sol::protected_function>()().get<int>() == 2);
+        REQUIRE(count_files(cache_directory) == 1);
+    }
+    SECTION("Modified scripts are compiled again")
+    {
+        write_script(script_path, "return 'modified script'");
+        sol::load_result script = cache.load_file(lua, script_path);
+        REQUIRE(script.valid());
+        REQUIRE(script.get<sol::protected_function>()().get<std::string>() == "modified script");
+        // The bytecode of the previous version is removed
+        REQUIRE(count_files(cache_directory) == 1);
+    }
+    SECTION("Scripts with the same content keep their own path")
+    {
+        lua.open_libraries(sol::lib::debug);
+        const std::string source = "return debug.getinfo(1, 'S').source";
+        const std::string first_path = (root / "first.lua").string();
+        const std::string second_path = (root / "second.lua").string();
+        write_script(first_path, source);
+        write_script(second_path, source);
+        for (const std::string& path : { first_path, second_path, first_path })
+        {
+            BytecodeCache other_cache;
+            other_cache.set_directory(cache_directory.string());
+            sol::load_result script = other_cache.load_file(lua, path);
+            REQUIRE(script.valid());
+            REQUIRE(script.get<sol::protected_function>()().get<std::string>() == "@" + path);
+        }
+        REQUIRE(count_files(cache_directory) == 3);
+    }
+    SECTION("Invalid bytecode on disk is replaced")
+    {
+        const std::filesystem::path cached_file
+            = std::filesystem::directory_iterator(cache_directory)->path();
+        write_script(cached_file, "\x1bLua but not bytecode");
+        BytecodeCache other_cache;
+        other_cache.set_directory(cache_directory.string());
+        sol::load_result script = other_cache.load_file(lua, script_path);
+        REQUIRE(script.valid());
+        REQUIRE(script.get<sol::protected_function>()().get<int>() == 2);
+    }
+    SECTION("Syntax errors are reported with the script path")
+    {
+        write_script(script_path, "return +");
+        sol::load_result script = cache.load_file(lua, script_path);
+        REQUIRE_FALSE(script.valid());
+        REQUIRE(std::string(script.get<sol::error>().what()).find(script_path)
+            != std::string::npos);
+        REQUIRE_FALSE(cache.precompile(lua, script_path));
+    }
+}
@@ -0,0 +1,89 @@
+#include <catch_amalgamated.hpp>
+
+#include <Debug/Logger.hpp>
+#include <Script/GarbageCollector.hpp>
+
+#include <TestUtils.hpp>
+
+using namespace obe::script;
+
+namespace
+{
+    void make_garbage(sol::state& lua)
+    {
+        lua.safe_script("for i = 1, 20000 do local garbage = { i, tostring(i) } end");
+    }
+}
+
+TEST_CASE("Garbage is only collected when the collector is driven", "[obe.Script.GarbageCollector]")
+{
+    obe::tests::ensure_logger();
+    sol::state lua;
+    lua.open_libraries(sol::lib::base);
+    GarbageCollector collector(lua);
+    collector.set_step_size(1024);
+    collector.set_pause(100000);
+    collector.set_enabled(true);
+
+    const std::size_t initial_heap = collector.get_heap_size();
+    make_garbage(lua);
+    const std::size_t heap_with_garbage = collector.get_heap_size();
+    REQUIRE(heap_with_garbage > initial_heap);
+
+    SECTION("No collection without slack below the pause threshold")
+    {
+        collector.end_frame();
+        REQUIRE(collector.get_statistics().steps == 0);
+        REQUIRE(collector.get_heap_size() >= heap_with_garbage);
+    }
+    SECTION("Garbage is collected in the slack of a frame")
+    {
+        collector.set_budget(1.0);
+        while (collector.get_statistics().cycles == 0)
+        {
+            collector.collect_in_slack(1.0);
+            collector.end_frame();
+        }
+        REQUIRE(collector.get_heap_size() < heap_with_garbage);
+        REQUIRE(collector.get_statistics().forced_frames == 0);
+        REQUIRE(collector.get_statistics().max_frame_pause > 0);
+    }
+    SECTION("Collection is forced once the heap passes the pause threshold")
+    {
+        collector.set_pause(100);
+        collector.set_limit(100000);
+        collector.set_budget(0);
+        collector.collect_in_slack(1.0);
+        REQUIRE(collector.get_statistics().steps == 0);
+        collector.end_frame();
+        // A single step is done per frame when no budget is left
+        REQUIRE(collector.get_statistics().steps == 1);
+        REQUIRE(collector.get_statistics().forced_frames == 1);
+    }
+    SECTION("A full collection is done once the heap passes the limit")
+    {
+        collector.set_pause(100);
+        collector.set_limit(150);
+        collector.set_budget(0);
+        collector.collect_in_slack(1.0);
+        REQUIRE(collector.get_statistics().full_collections == 1);
+        REQUIRE(collector.get_statistics().steps == 0);
+        REQUIRE(collector.get_heap_size() < heap_with_garbage);
+        collector.end_frame();
+        REQUIRE(collector.get_statistics().full_collections == 1);
+    }
+}
+
+TEST_CASE("The previous mode of the Lua collector is restored when disabled",
+    "[obe.Script.GarbageCollector]")
+{
+    obe::tests::ensure_logger();
+    sol::state lua;
+    lua_gc(lua.lua_state(), LUA_GCGEN, 0, 0);
+    GarbageCollector collector(lua);
+    collector.set_enabled(true);
+    REQUIRE(lua_gc(lua.lua_state(), LUA_GCISRUNNING) == 0);
+    collector.set_enabled(false);
+    REQUIRE(lua_gc(lua.lua_state(), LUA_GCISRUNNING) == 1);
+    REQUIRE(lua_gc(lua.lua_state(), LUA_GCINC, 0, 0, 0) == LUA_GCGEN);
+}
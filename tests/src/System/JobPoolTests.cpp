@@ -0,0 +1,38 @@
+#include <numeric>
+
+#include <catch_amalgamated.hpp>
+
+#include <System/JobPool.hpp>
+
+using namespace obe::system;
+
+TEST_CASE("Ranges given to parallel_for cover every index once", "[obe.System.JobPool]")
+{
+    JobPool pool(3);
+    REQUIRE(pool.get_workers_amount() == 3);
+
+    std::vector<int> hits(1000, 0);
+    std::atomic<bool> aligned_ranges = true;
+    pool.parallel_for(hits.size(), 7,
+        [&hits, &aligned_ranges](std::size_t begin, std::size_t end)
+        {
+            if (begin % 7 != 0)
+                aligned_ranges = false;
+            for (std::size_t i = begin; i < end; i++)
+                hits[i]++;
+        });
+    REQUIRE(aligned_ranges);
+    REQUIRE(std::accumulate(hits.begin(), hits.end(), 0) == 1000);
+    REQUIRE(std::all_of(hits.begin(), hits.end(), [](int hit) { return hit == 1; }));
+
+    SECTION("Exceptions thrown by a range are forwarded to the caller")
+    {
+        REQUIRE_THROWS_AS(pool.parallel_for(100, 1,
+                              [](std::size_t begin, std::size_t)
+                              {
+                                  if (begin == 42)
+                                      throw std::runtime_error("failure");
+                              }),
+            std::runtime_error);
+    }
+}
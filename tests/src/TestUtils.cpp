@@ -0,0 +1,42 @@
+#include <random>
+
+#include <Debug/Logger.hpp>
+
+#include <TestUtils.hpp>
+
+namespace obe::tests
+{
+    void ensure_logger()
+    {
+        if (!debug::Log)
+        {
+            debug::Log = std::make_shared<spdlog::logger>("Log");
+        }
+    }
+
+    TemporaryDirectory::TemporaryDirectory()
+    {
+        static std::mt19937_64 generator(std::random_device {}());
+        do
+        {
+            m_path = std::filesystem::temp_directory_path()
+                / ("obe_tests_" + std::to_string(generator()));
+        } while (!std::filesystem::create_directories(m_path));
+    }
+
+    TemporaryDirectory::~TemporaryDirectory()
+    {
+        std::error_code error;
+        std::filesystem::remove_all(m_path, error);
+    }
+
+    const std::filesystem::path& TemporaryDirectory::path() const
+    {
+        return m_path;
+    }
+
+    std::filesystem::path TemporaryDirectory::operator/(std::string_view name) const
+    {
+        return m_path / name;
+    }
+}
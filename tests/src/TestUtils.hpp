@@ -0,0 +1,39 @@
+#pragma once
+
+#include <filesystem>
+#include <string_view>
+
+/**
+ * \brief Helpers shared by the test cases
+ */
+namespace obe::tests
+{
+    /**
+     * \brief Creates the engine logger for code that logs, the messages are discarded
+     */
+    void ensure_logger();
+
+    /**
+     * \brief Empty directory which is removed with its content on destruction,
+     *        every instance gets its own path so tests never share files
+     */
+    class TemporaryDirectory
+    {
+    private:
+        std::filesystem::path m_path;
+
+    public:
+        TemporaryDirectory();
+        ~TemporaryDirectory();
+        TemporaryDirectory(const TemporaryDirectory&) = delete;
+        TemporaryDirectory& operator=(const TemporaryDirectory&) = delete;
+        /**
+         * \brief Path of the directory
+         */
+        [[nodiscard]] const std::filesystem::path& path() const;
+        /**
+         * \brief Path of an entry of the directory
+         */
+        std::filesystem::path operator/(std::string_view name) const;
+    };
+}
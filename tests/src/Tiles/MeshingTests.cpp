@@ -0,0 +1,73 @@
+#include <catch_amalgamated.hpp>
+
+#include <Tiles/Meshing.hpp>
+
+using namespace obe::tiles;
+
+TEST_CASE("Solid tiles are merged in rectangles", "[obe.Tiles.Meshing]")
+{
+    SECTION("A full grid is a single rectangle")
+    {
+        // clang-format off
+        const std::vector<uint32_t> groups = {
+            1, 1, 1,
+            1, 1, 1 };
+        // clang-format on
+        REQUIRE(merge_tiles(groups, 3) == std::vector { TileRectangle { 0, 0, 3, 2, 1 } });
+    }
+    SECTION("Rectangles only grow downwards with whole rows")
+    {
+        // clang-format off
+        const std::vector<uint32_t> groups = {
+            1, 1, 1,
+            1, 0, 0,
+            1, 0, 0 };
+        // clang-format on
+        REQUIRE(merge_tiles(groups, 3)
+            == std::vector { TileRectangle { 0, 0, 3, 1, 1 }, TileRectangle { 0, 1, 1, 2, 1 } });
+    }
+    SECTION("The first row decides the width of the rectangle")
+    {
+        // clang-format off
+        const std::vector<uint32_t> groups = {
+            1, 0, 0,
+            1, 1, 1 };
+        // clang-format on
+        REQUIRE(merge_tiles(groups, 3)
+            == std::vector { TileRectangle { 0, 0, 1, 2, 1 }, TileRectangle { 1, 1, 2, 1, 1 } });
+    }
+}
+
+TEST_CASE("Gaps and collision groups split the rectangles", "[obe.Tiles.Meshing]")
+{
+    SECTION("Tiles which are not solid are never covered")
+    {
+        // clang-format off
+        const std::vector<uint32_t> groups = {
+            1, 0, 1,
+            1, 0, 1,
+            0, 0, 0,
+            1, 1, 1 };
+        // clang-format on
+        REQUIRE(merge_tiles(groups, 3)
+            == std::vector { TileRectangle { 0, 0, 1, 2, 1 }, TileRectangle { 2, 0, 1, 2, 1 },
+                TileRectangle { 0, 3, 3, 1, 1 } });
+    }
+    SECTION("Tiles of different groups are never merged")
+    {
+        // clang-format off
+        const std::vector<uint32_t> groups = {
+            1, 1, 2,
+            1, 1, 2,
+            2, 2, 2 };
+        // clang-format on
+        REQUIRE(merge_tiles(groups, 3)
+            == std::vector { TileRectangle { 0, 0, 2, 2, 1 }, TileRectangle { 2, 0, 1, 3, 2 },
+                TileRectangle { 0, 2, 2, 1, 2 } });
+    }
+    SECTION("Empty grids have no rectangle")
+    {
+        REQUIRE(merge_tiles({ 0, 0, 0, 0 }, 2).empty());
+        REQUIRE(merge_tiles({}, 0).empty());
+    }
+}
@@ -0,0 +1,330 @@
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+#include <catch_amalgamated.hpp>
+
+#include <Event/EventManager.hpp>
+#include <Scene/Scene.hpp>
+#include <Tiles/Scene.hpp>
+
+#include <TestUtils.hpp>
+
+using namespace obe;
+
+namespace
+{
+    constexpr vili::integer Empty = 0;
+    constexpr vili::integer Grass = 1;
+    // Tile with a collider on its lower half
+    constexpr vili::integer Slab = 2;
+    // Tile with a collider covering the whole tile
+    constexpr vili::integer Wall = 3;
+    // Tile with a collider covering the whole tile and a smaller one on its top
+    constexpr vili::integer Pillar = 4;
+    // Animated tile showing the tiles 5, 6 and 7 for 0.5, 0.25 and 0.25 seconds
+    constexpr vili::integer Water = 5;
+
+    /**
+     * \brief Map with a single tileset of 16x16 pixels tiles without image so
+     *        it can be loaded without a window
+     */
+    vili::node make_map(vili::integer width, vili::integer height,
+        const std::vector<uint32_t>& tiles, vili::node options = vili::object {})
+    {
+        vili::node tiles_data = vili::array {};
+        for (const uint32_t tile : tiles)
+        {
+            tiles_data.push(static_cast<vili::integer>(tile));
+        }
+        vili::node map = vili::object { { "width", width }, { "height", height },
+            { "tileWidth", 16 }, { "tileHeight", 16 },
+            { "sources",
+                vili::object { { "terrain",
+                    vili::object { { "firstTileId", 1 }, { "columns", 4 }, { "tilecount", 16 },
+                        { "tile", vili::object { { "width", 16 }, { "height", 16 } } },
+                        { "animations",
+                            vili::array { vili::object { { "frames",
+                                vili::array {
+                                    vili::object { { "tileid", Water - 1 }, { "duration", 0.5 } },
+                                    vili::object { { "tileid", Water }, { "duration", 0.25 } },
+                                    vili::object {
+                                        { "tileid", Water + 1 }, { "duration", 0.25 } } } } } } },
+                        { "collisions",
+                            vili::array {
+                                vili::object { { "id", Slab - 1 }, { "type", "Rectangle" },
+                                    { "unit", "ScenePixels" }, { "x", 0 }, { "y", 8 },
+                                    { "width", 16 }, { "height", 8 } },
+                                vili::object { { "id", Wall - 1 }, { "type", "Rectangle" },
+                                    { "unit", "ScenePixels" }, { "x", 0 }, { "y", 0 },
+                                    { "width", 16 }, { "height", 16 } },
+                                vili::object { { "id", Pillar - 1 }, { "type", "Rectangle" },
+                                    { "unit", "ScenePixels" }, { "x", 0 }, { "y", 0 },
+                                    { "width", 16 }, { "height", 16 } },
+                                vili::object { { "id", Pillar - 1 }, { "type", "Rectangle" },
+                                    { "unit", "ScenePixels" }, { "x", 4 }, { "y", -4 },
+                                    { "width", 8 }, { "height", 4 } } } } } } } },
+            { "layers",
+                vili::object { { "ground",
+                    vili::object { { "layer", 1 }, { "x", 0 }, { "y", 0 }, { "width", width },
+                        { "height", height }, { "tiles", tiles_data } } } } } };
+        for (const auto& [key, value] : options.items())
+        {
+            map[key] = value;
+        }
+        return map;
+    }
+
+    // Created before the other members of TestScene as they log
+    struct Logger
+    {
+        Logger()
+        {
+            tests::ensure_logger();
+        }
+    };
+
+    class TestScene
+    {
+    public:
+        Logger logger;
+        event::EventManager events;
+        sol::state lua;
+        scene::Scene scene;
+        tiles::TileScene tiles;
+
+        explicit TestScene(const vili::node& map, double camera_size = 1)
+            : scene(events.create_namespace("Tests"), lua)
+            , tiles(scene)
+        {
+            transform::UnitVector::init(800, 600);
+            scene.get_camera().set_size(camera_size);
+            scene.get_camera().set_position(transform::UnitVector(0, 0));
+            tiles.load(map);
+        }
+    };
+
+    /**
+     * \brief Bounding boxes of the colliders of the Scene in pixels of the
+     *        tiles (one pixel per screen pixel with a Camera of size 1)
+     */
+    std::vector<std::array<double, 4>> get_colliders_pixels(const scene::Scene& scene)
+    {
+        // The screen is 600 pixels high for 2 SceneUnits
+        constexpr double pixels_per_unit = 300;
+        std::vector<std::array<double, 4>> boxes;
+        for (const collision::ColliderComponent* collider : scene.get_all_colliders())
+        {
+            const transform::AABB box = collider->get_inner_collider()->get_bounding_box();
+            const transform::UnitVector position
+                = box.get_position(transform::Referential::TopLeft);
+            const transform::UnitVector size = box.get_size();
+            boxes.push_back({ std::round(position.x * pixels_per_unit),
+                std::round(position.y * pixels_per_unit), std::round(size.x * pixels_per_unit),
+                std::round(size.y * pixels_per_unit) });
+        }
+        std::sort(boxes.begin(), boxes.end());
+        return boxes;
+    }
+
+    /**
+     * \brief Tile shown by the quad of the tile at (x, 0) in a chunk,
+     *        tiles are read from the texture coordinates of the quad
+     */
+    uint32_t get_shown_tile(const tiles::TileLayer& layer, std::size_t chunk, uint32_t x)
+    {
+        const sf::VertexArray& vertices = layer.get_chunk(chunk).vertices_by_tileset.at(1);
+        for (std::size_t i = 0; i < vertices.getVertexCount(); i += 4)
+        {
+            if (vertices[i].position == sf::Vector2f(x * 16.f, 0))
+            {
+                const sf::Vector2f texture = vertices[i].texCoords;
+                // The tileset has 4 columns of 16x16 pixels tiles
+                return static_cast<uint32_t>(texture.x / 16 + texture.y / 16 * 4) + 1;
+            }
+        }
+        return 0;
+    }
+}
+
+TEST_CASE("Rebuilding a TileLayer replaces the colliders of its tiles", "[obe.Tiles.TileLayer]")
+{
+    // clang-format off
+    TestScene test(make_map(4, 3, {
+        Slab, Slab,  Grass, Wall,
+        Wall, Empty, Slab,  Wall,
+        Wall, Wall,  Grass, Grass }));
+    // clang-format on
+    tiles::TileLayer& layer = test.tiles.get_layer("ground");
+    // 3 Slab colliders, then the walls are merged in 3 colliders
+    REQUIRE(test.scene.get_collider_amount() == 6);
+
+    layer.build();
+    REQUIRE(test.scene.get_collider_amount() == 6);
+    layer.build();
+    REQUIRE(test.scene.get_collider_amount() == 6);
+
+    SECTION("Replacing a tile replaces its colliders")
+    {
+        layer.set_tile(0, 0, Grass);
+        REQUIRE(test.scene.get_collider_amount() == 5);
+        layer.set_tile(1, 1, Slab);
+        layer.set_tile(1, 1, Slab);
+        REQUIRE(test.scene.get_collider_amount() == 6);
+        layer.build();
+        REQUIRE(test.scene.get_collider_amount() == 6);
+    }
+}
+
+TEST_CASE("TileLayers are split in chunks", "[obe.Tiles.TileLayer]")
+{
+    const std::vector<uint32_t> tiles(10 * 7, Grass);
+
+    SECTION("Chunks are built with the TileLayer unless they are streamed")
+    {
+        TestScene test(make_map(10, 7, tiles, vili::object { { "chunkSize", 4 } }));
+        const tiles::TileLayer& layer = test.tiles.get_layer("ground");
+        // Incomplete chunks are kept on the right and bottom borders
+        REQUIRE(layer.get_chunks_amount() == 3 * 2);
+        REQUIRE(layer.get_loaded_chunks_amount() == 3 * 2);
+    }
+    SECTION("Streamed chunks are only built once the Camera gets close to them")
+    {
+        TestScene test(
+            make_map(10, 7, tiles, vili::object { { "chunkSize", 4 }, { "streaming", true } }));
+        const tiles::TileLayer& layer = test.tiles.get_layer("ground");
+        REQUIRE(layer.get_chunks_amount() == 3 * 2);
+        REQUIRE(layer.get_loaded_chunks_amount() == 0);
+    }
+}
+
+TEST_CASE("Streamed chunks are loaded and unloaded around the Camera", "[obe.Tiles.TileLayer]")
+{
+    // 64x64 tiles of 16 pixels in chunks of 8x8 tiles (128 pixels)
+    TestScene test(make_map(64, 64, std::vector<uint32_t>(64 * 64, Grass),
+        vili::object { { "chunkSize", 8 }, { "streaming", true }, { "streamingMargin", 0 } }));
+    tiles::TileLayer& layer = test.tiles.get_layer("ground");
+    scene::Camera& camera = test.scene.get_camera();
+    REQUIRE(layer.get_chunks_amount() == 64);
+
+    // The view covers 800x600 pixels, 7 columns and 5 rows of chunks
+    layer.update_chunks(camera);
+    REQUIRE(layer.get_loaded_chunks_amount() == 7 * 5);
+    // Streaming the same view again keeps the same chunks
+    layer.update_chunks(camera);
+    REQUIRE(layer.get_loaded_chunks_amount() == 7 * 5);
+
+    SECTION("Chunks are kept until they are one chunk away from the view")
+    {
+        // The first column is still within a chunk of the view, the last one is loaded
+        camera.set_position(transform::UnitVector(200, 0, transform::Units::ScenePixels));
+        layer.update_chunks(camera);
+        REQUIRE(layer.get_loaded_chunks_amount() == 8 * 5);
+        // The first two columns are too far, the third one is kept
+        camera.set_position(transform::UnitVector(400, 0, transform::Units::ScenePixels));
+        layer.update_chunks(camera);
+        REQUIRE(layer.get_loaded_chunks_amount() == 6 * 5);
+    }
+    SECTION("Chunks are unloaded when the Camera leaves the TileLayer")
+    {
+        camera.set_position(transform::UnitVector(3000, 3000, transform::Units::ScenePixels));
+        layer.update_chunks(camera);
+        REQUIRE(layer.get_loaded_chunks_amount() == 0);
+        camera.set_position(transform::UnitVector(0, 0, transform::Units::ScenePixels));
+        layer.update_chunks(camera);
+        REQUIRE(layer.get_loaded_chunks_amount() == 7 * 5);
+    }
+    SECTION("Rebuilding the TileLayer unloads its streamed chunks")
+    {
+        layer.build();
+        REQUIRE(layer.get_loaded_chunks_amount() == 0);
+    }
+}
+
+TEST_CASE("Tile colliders don't depend on the Camera size", "[obe.Tiles.TileLayer]")
+{
+    const double camera_size = GENERATE(1.0, 0.5, 3.0);
+    TestScene test(make_map(3, 1, { Slab, Wall, Wall }), camera_size);
+
+    // The Slab collider keeps its offset, the walls are merged
+    REQUIRE(get_colliders_pixels(test.scene)
+        == std::vector<std::array<double, 4>> { { 0, 8, 16, 8 }, { 16, 0, 32, 16 } });
+}
+
+TEST_CASE("Only tiles with a single whole tile collider are merged", "[obe.Tiles.TileLayer]")
+{
+    TestScene test(make_map(3, 1, { Pillar, Pillar, Wall }));
+
+    // Merging the pillars would lose their second collider
+    REQUIRE(get_colliders_pixels(test.scene)
+        == std::vector<std::array<double, 4>> { { 0, 0, 16, 16 }, { 4, -4, 8, 4 },
+            { 16, 0, 16, 16 }, { 20, -4, 8, 4 }, { 32, 0, 16, 16 } });
+}
+
+TEST_CASE("Animated tiles skip the frames covered by a large delta time",
+    "[obe.Tiles.TileLayer]")
+{
+    TestScene test(make_map(1, 1, { Water }));
+    const tiles::AnimatedTile& water = *test.tiles.get_tile_animation(Water);
+    REQUIRE(water.get_frame_index() == 0);
+
+    // A whole loop and the first frame are skipped
+    test.tiles.update(1.6);
+    REQUIRE(water.get_frame_index() == 1);
+    // The time spent in the current frame is kept
+    test.tiles.update(0.4);
+    REQUIRE(water.get_frame_index() == 0);
+    test.tiles.update(0);
+    REQUIRE(water.get_frame_index() == 0);
+    test.tiles.update(3.55);
+    REQUIRE(water.get_frame_index() == 1);
+    test.tiles.update(0.3);
+    REQUIRE(water.get_frame_index() == 2);
+}
+
+TEST_CASE("Animated quads are only rewritten when their chunk is visible",
+    "[obe.Tiles.TileLayer]")
+{
+    // 8 chunks of 128 pixels, the view covers the first 800 pixels
+    std::vector<uint32_t> tiles(64, Grass);
+    tiles.front() = Water;
+    tiles.back() = Water;
+    TestScene test(make_map(64, 1, tiles, vili::object { { "chunkSize", 8 } }));
+    tiles::TileLayer& layer = test.tiles.get_layer("ground");
+    scene::Camera& camera = test.scene.get_camera();
+    REQUIRE(get_shown_tile(layer, 0, 0) == Water);
+    REQUIRE(get_shown_tile(layer, 7, 63) == Water);
+
+    // Changing frame doesn't touch the quads
+    test.tiles.update(0.5);
+    REQUIRE(get_shown_tile(layer, 0, 0) == Water);
+    REQUIRE(get_shown_tile(layer, 7, 63) == Water);
+
+    layer.update_chunks(camera);
+    REQUIRE(get_shown_tile(layer, 0, 0) == Water + 1);
+    REQUIRE(get_shown_tile(layer, 7, 63) == Water);
+
+    // Hidden chunks catch up once they are visible
+    test.tiles.update(0.25);
+    camera.set_position(transform::UnitVector(400, 0, transform::Units::ScenePixels));
+    layer.update_chunks(camera);
+    REQUIRE(get_shown_tile(layer, 0, 0) == Water + 1);
+    REQUIRE(get_shown_tile(layer, 7, 63) == Water + 2);
+}
+
+TEST_CASE("Chunks are not culled when the Scene culling is disabled", "[obe.Tiles.TileLayer]")
+{
+    std::vector<uint32_t> tiles(64, Grass);
+    tiles.back() = Water;
+    TestScene test(make_map(64, 1, tiles, vili::object { { "chunkSize", 8 } }));
+    tiles::TileLayer& layer = test.tiles.get_layer("ground");
+    scene::SceneRenderOptions options = test.scene.get_render_options();
+    options.culling = false;
+    test.scene.set_render_options(options);
+
+    // The last chunk is out of the view but it is drawn anyway
+    test.tiles.update(0.5);
+    layer.update_chunks(test.scene.get_camera());
+    REQUIRE(get_shown_tile(layer, 7, 63) == Water + 1);
+}
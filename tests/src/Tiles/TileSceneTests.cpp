@@ -0,0 +1,134 @@
+#include <catch_amalgamated.hpp>
+
+#include <Event/EventManager.hpp>
+#include <Scene/Scene.hpp>
+#include <Tiles/Scene.hpp>
+
+#include <TestUtils.hpp>
+
+using namespace obe;
+
+namespace
+{
+    constexpr vili::integer FlipHorizontal = 0x80000000;
+
+    vili::node make_frames(std::initializer_list<vili::integer> tiles)
+    {
+        vili::node frames = vili::array {};
+        for (const vili::integer tile : tiles)
+        {
+            frames.push(vili::object { { "tileid", tile }, { "duration", 0.5 } });
+        }
+        return frames;
+    }
+
+    /**
+     * \brief Map with two tilesets without image, "terrain" (tiles 1 to 16)
+     *        and "props" (tiles 17 to 20)
+     */
+    vili::node make_map(vili::integer tile)
+    {
+        const vili::node tile_size = vili::object { { "width", 16 }, { "height", 16 } };
+        return vili::object { { "width", 1 }, { "height", 1 }, { "tileWidth", 16 },
+            { "tileHeight", 16 },
+            { "sources",
+                vili::object {
+                    { "terrain",
+                        vili::object { { "firstTileId", 1 }, { "columns", 4 },
+                            { "tilecount", 16 }, { "tile", tile_size },
+                            { "animations",
+                                vili::array { vili::object { { "frames", make_frames({ 4, 5 }) } },
+                                    vili::object { { "frames", make_frames({ 4, 6 }) } } } } } },
+                    { "props",
+                        vili::object { { "firstTileId", 17 }, { "columns", 2 },
+                            { "tilecount", 4 }, { "tile", tile_size },
+                            { "animations",
+                                vili::array {
+                                    vili::object { { "frames", make_frames({ 1, 2 }) } } } },
+                            { "collisions",
+                                vili::array { vili::object { { "id", 0 }, { "type", "Rectangle" },
+                                    { "unit", "ScenePixels" }, { "x", 0 }, { "y", 8 },
+                                    { "width", 16 }, { "height", 8 } } } },
+                            { "objects",
+                                vili::array { vili::object { { "tileId", 2 },
+                                    { "id", "chest_{index}" }, { "type", "Chest" },
+                                    { "Requires", vili::object {} } } } } } } } },
+            { "layers",
+                vili::object { { "ground",
+                    vili::object { { "layer", 1 }, { "x", 0 }, { "y", 0 }, { "width", 1 },
+                        { "height", 1 }, { "tiles", vili::array { tile } } } } } } };
+    }
+
+    // Created before the other members of TestScene as they log
+    struct Logger
+    {
+        Logger()
+        {
+            tests::ensure_logger();
+        }
+    };
+
+    class TestScene
+    {
+    public:
+        Logger logger;
+        event::EventManager events;
+        sol::state lua;
+        scene::Scene scene;
+        tiles::TileScene tiles;
+
+        explicit TestScene(const vili::node& map)
+            : scene(events.create_namespace("Tests"), lua)
+            , tiles(scene)
+        {
+            transform::UnitVector::init(800, 600);
+            tiles.load(map);
+        }
+    };
+}
+
+TEST_CASE("Tiles are looked up by their id", "[obe.Tiles.TileScene]")
+{
+    TestScene test(make_map(0));
+    const tiles::TileScene& tiles = test.tiles;
+
+    SECTION("Animations are found from their first tile")
+    {
+        // Animation frames are local to their tileset
+        REQUIRE(tiles.get_tile_animation(5) != nullptr);
+        REQUIRE(tiles.get_tile_animation(5)->get_current_tile_id() == 5);
+        REQUIRE(tiles.get_tile_animation(18) != nullptr);
+        REQUIRE(tiles.get_tile_animation(18)->get_current_tile_id() == 18);
+        // The other frames don't start an animation
+        REQUIRE(tiles.get_tile_animation(6) == nullptr);
+        REQUIRE(tiles.get_tile_animation(19) == nullptr);
+        REQUIRE(tiles.get_tile_animation(4) == nullptr);
+    }
+    SECTION("The first animation of a tile is used")
+    {
+        REQUIRE(tiles.get_animated_tiles().size() == 3);
+        REQUIRE(tiles.get_tile_animation(5) == tiles.get_animated_tiles()[0]);
+    }
+    SECTION("Collider models use the local tile ids of their tileset")
+    {
+        REQUIRE(tiles.get_tile_collider_models(17).size() == 1);
+        REQUIRE(tiles.get_tile_collider_models(1).empty());
+        REQUIRE(tiles.get_tile_collider_models(0).empty());
+    }
+    SECTION("GameObject models use the global tile id in tileId")
+    {
+        // The object is declared in props but its tileId is not offset
+        const std::vector<vili::node>& models = tiles.get_tile_game_objects_models(2);
+        REQUIRE(models.size() == 1);
+        REQUIRE(models[0].at("type").as<vili::string>() == "Chest");
+        REQUIRE(tiles.get_tile_game_objects_models(18).empty());
+    }
+}
+
+TEST_CASE("Flipped tiles use the models of their tile", "[obe.Tiles.TileScene]")
+{
+    // The lookups expect tile ids without their flip flags
+    TestScene test(make_map(17 | FlipHorizontal));
+    REQUIRE(test.tiles.get_tile_collider_models(17 | FlipHorizontal).empty());
+    REQUIRE(test.scene.get_collider_amount() == 1);
+}